@@ -429,6 +429,22 @@ typedef struct otMessageQueueInfo
     uint32_t mTotalBytes;  ///< Total number of bytes used by all messages in the queue.
 } otMessageQueueInfo;
 
+/**
+ * Represents information about message buffers used by messages of a given type.
+ */
+typedef struct otMessageTypeBufferInfo
+{
+    uint16_t mNumBuffers; ///< Number of buffers currently used by messages of this type.
+
+    /**
+     * The maximum number of buffers used by messages of this type at the same time since OT stack initialization or
+     * last call to `otMessageResetBufferInfo()`.
+     */
+    uint16_t mMaxUsedBuffers;
+
+    uint32_t mNumAllocFailures; ///< Number of failed buffer allocations for messages of this type.
+} otMessageTypeBufferInfo;
+
 /**
  * Represents the message buffer information for different queues used by OpenThread stack.
  */
@@ -451,6 +467,17 @@ typedef struct otBufferInfo
     otMessageQueueInfo mCoapQueue;            ///< Info about CoAP/TMF send queue.
     otMessageQueueInfo mCoapSecureQueue;      ///< Info about CoAP secure send queue.
     otMessageQueueInfo mApplicationCoapQueue; ///< Info about application CoAP send queue.
+
+    uint32_t mMaxUsedBuffersAge; ///< Time (in msec) since `mMaxUsedBuffers` was last reached.
+    uint32_t mNumAllocFailures;  ///< Number of failed buffer allocations (all message types).
+
+    otMessageTypeBufferInfo mIp6Messages;          ///< Info about buffers used by IPv6 messages.
+    otMessageTypeBufferInfo m6loMessages;          ///< Info about buffers used by 6LoWPAN messages.
+    otMessageTypeBufferInfo mSupervisionMessages;  ///< Info about buffers used by child supervision messages.
+    otMessageTypeBufferInfo mMacEmptyDataMessages; ///< Info about buffers used by empty MAC data messages.
+    otMessageTypeBufferInfo mIp4Messages;          ///< Info about buffers used by IPv4 (NAT64) messages.
+    otMessageTypeBufferInfo mBleMessages;          ///< Info about buffers used by BLE messages.
+    otMessageTypeBufferInfo mOtherMessages;        ///< Info about buffers used by other messages.
 } otBufferInfo;
 
 /**
@@ -517,9 +544,10 @@ otMessage *otMessageQueueGetNext(otMessageQueue *aQueue, const otMessage *aMessa
 void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 
 /**
- * Reset the Message Buffer information counter tracking the maximum number buffers in use at the same time.
+ * Reset the Message Buffer information counters tracking the maximum number buffers in use at the same time.
  *
- * This resets `mMaxUsedBuffers` in `otBufferInfo`.
+ * This resets `mMaxUsedBuffers` and `mNumAllocFailures` in `otBufferInfo`, including the ones tracked for each message
+ * type.
  *
  * @param[in]   aInstance    A pointer to the OpenThread instance.
  */
@@ -1138,6 +1138,40 @@ void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance);
  */
 void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance);
 
+/**
+ * Represents a change to the source address match table.
+ */
+typedef struct otRadioSrcMatchEntry
+{
+    otExtAddress   mExtAddress;   ///< The extended address stored in little-endian byte order (if `!mIsShort`).
+    otShortAddress mShortAddress; ///< The short address (if `mIsShort`).
+    bool           mIsShort : 1;  ///< TRUE for a short address, FALSE for an extended address.
+    bool           mIsAdd : 1;    ///< TRUE to add the address, FALSE to remove it.
+} otRadioSrcMatchEntry;
+
+/**
+ * Applies a list of changes to the source address match table.
+ *
+ * This is an optional platform API. It allows a radio whose source address match table is costly to access (e.g.,
+ * an RCP connected to the host) to apply several changes in a single operation instead of one call per address.
+ *
+ * The entries are applied in order. Removing an address which is not in the table is not an error. If an entry cannot
+ * be applied, the remaining entries are skipped and the error is returned. The entries before it may remain applied.
+ *
+ * If @p aNumEntries is zero, the table is not changed and the return value indicates whether the API is supported.
+ *
+ * @param[in]  aInstance    The OpenThread instance structure.
+ * @param[in]  aEntries     A pointer to the array of changes.
+ * @param[in]  aNumEntries  The number of entries in @p aEntries.
+ *
+ * @retval OT_ERROR_NONE             Successfully applied all the changes.
+ * @retval OT_ERROR_NO_BUFS          No available entry in the source match table.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The API is not supported. The per-address APIs must be used instead.
+ */
+otError otPlatRadioUpdateSrcMatchEntries(otInstance                 *aInstance,
+                                         const otRadioSrcMatchEntry *aEntries,
+                                         uint16_t                    aNumEntries);
+
 /**
  * Get the radio supported channel mask that the device is allowed to be on.
  *
@@ -142,6 +142,22 @@ typedef struct otSrpServerResponseCounters
     uint32_t mOther;         ///< The number of other responses.
 } otSrpServerResponseCounters;
 
+/**
+ * Includes the statistics of SRP update SIG(0) signature verifications by the SRP server.
+ *
+ * The latency of a signature verification is measured from when the SIG(0) record of the SRP update is parsed to
+ * when its verification completes. It includes the time the update waits in the verification queue when the
+ * asynchronous signature verification is enabled.
+ */
+typedef struct otSrpServerSignatureVerifyCounters
+{
+    uint32_t mNumVerified;  ///< Number of signatures successfully verified.
+    uint32_t mNumFailed;    ///< Number of signatures which failed verification.
+    uint32_t mNumCacheHits; ///< Number of signatures accepted from the verified signature cache.
+    uint32_t mTotalLatency; ///< Sum of latencies (in msec) of all signature verifications (including cache hits).
+    uint32_t mMaxLatency;   ///< Maximum latency (in msec) of a signature verification.
+} otSrpServerSignatureVerifyCounters;
+
 /**
  * Returns the domain authorized to the SRP server.
  *
@@ -456,6 +472,15 @@ const otSrpServerHost *otSrpServerGetNextHost(otInstance *aInstance, const otSrp
  */
 const otSrpServerResponseCounters *otSrpServerGetResponseCounters(otInstance *aInstance);
 
+/**
+ * Returns the signature verification counters of the SRP server.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns  A pointer to the signature verification counters of the SRP server.
+ */
+const otSrpServerSignatureVerifyCounters *otSrpServerGetSignatureVerifyCounters(otInstance *aInstance);
+
 /**
  * Tells if the SRP service host has been deleted.
  *
@@ -114,6 +114,16 @@ typedef struct otCacheEntryInfo
     uint16_t          mRetryDelay;         ///< Retry delay in seconds (applicable if in query-retry state).
 } otCacheEntryInfo;
 
+/**
+ * Represents the EID cache counters.
+ */
+typedef struct otCacheCounters
+{
+    uint32_t mLookupHits;   ///< Number of lookups that found a usable (cached or snooped) entry.
+    uint32_t mLookupMisses; ///< Number of lookups that did not find a usable entry.
+    uint32_t mEvictions;    ///< Number of entries evicted to make room for a new entry.
+} otCacheCounters;
+
 /**
  * Represents an iterator used for iterating through the EID cache table entries.
  *
@@ -644,6 +654,24 @@ otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntr
  */
 void otThreadClearEidCache(otInstance *aInstance);
 
+/**
+ * Gets the EID cache counters.
+ *
+ * The counters can be used to check how effective the EID cache is and to tune its size (number of entries).
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the EID cache counters.
+ */
+const otCacheCounters *otThreadGetCacheCounters(otInstance *aInstance);
+
+/**
+ * Resets the EID cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ */
+void otThreadResetCacheCounters(otInstance *aInstance);
+
 /**
  * Get the Thread PSKc
  *
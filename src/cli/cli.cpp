@@ -1146,6 +1146,12 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
         const char                             *mName;
     };
 
+    struct TypeBufferInfoName
+    {
+        const otMessageTypeBufferInfo otBufferInfo::*mTypePtr;
+        const char                                  *mName;
+    };
+
     static const BufferInfoName kBufferInfoNames[] = {
         {&otBufferInfo::m6loSendQueue, "6lo send"},
         {&otBufferInfo::m6loReassemblyQueue, "6lo reas"},
@@ -1157,6 +1163,16 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
         {&otBufferInfo::mApplicationCoapQueue, "application coap"},
     };
 
+    static const TypeBufferInfoName kTypeBufferInfoNames[] = {
+        {&otBufferInfo::mIp6Messages, "ip6"},
+        {&otBufferInfo::m6loMessages, "6lo"},
+        {&otBufferInfo::mSupervisionMessages, "supervision"},
+        {&otBufferInfo::mMacEmptyDataMessages, "mac empty data"},
+        {&otBufferInfo::mIp4Messages, "ip4"},
+        {&otBufferInfo::mBleMessages, "ble"},
+        {&otBufferInfo::mOtherMessages, "other"},
+    };
+
     otError error = OT_ERROR_NONE;
 
     if (aArgs[0].IsEmpty())
@@ -1175,6 +1191,53 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
                        (bufferInfo.*info.mQueuePtr).mNumBuffers, ToUlong((bufferInfo.*info.mQueuePtr).mTotalBytes));
         }
     }
+    /**
+     * @cli bufferinfo types
+     * @code
+     * bufferinfo types
+     * max-used: 12
+     * max-used-age: 73520
+     * alloc-failures: 0
+     * ip6: 0 8 0
+     * 6lo: 1 4 0
+     * supervision: 0 1 0
+     * mac empty data: 0 0 0
+     * ip4: 0 0 0
+     * ble: 0 0 0
+     * other: 2 5 0
+     * Done
+     * @endcode
+     * @par
+     * Gets the message buffer usage information per message type.
+     * *   `max-used` displays max number of used buffers at the same time since OT stack
+     *     initialization or last `bufferinfo reset`.
+     * *   `max-used-age` displays the time in milliseconds since `max-used` was last reached.
+     * *   `alloc-failures` displays the number of failed buffer allocations.
+     * @par
+     * Each following line represents info about a message type:
+     * *   The first number shows number of buffers currently used by messages of the type.
+     * *   The second number shows max number of buffers used at the same time by messages of the type.
+     * *   The third number shows number of failed buffer allocations for messages of the type.
+     * @sa otMessageGetBufferInfo
+     */
+    else if (aArgs[0] == "types")
+    {
+        otBufferInfo bufferInfo;
+
+        otMessageGetBufferInfo(GetInstancePtr(), &bufferInfo);
+
+        OutputLine("max-used: %u", bufferInfo.mMaxUsedBuffers);
+        OutputLine("max-used-age: %lu", ToUlong(bufferInfo.mMaxUsedBuffersAge));
+        OutputLine("alloc-failures: %lu", ToUlong(bufferInfo.mNumAllocFailures));
+
+        for (const TypeBufferInfoName &info : kTypeBufferInfoNames)
+        {
+            const otMessageTypeBufferInfo &typeInfo = bufferInfo.*info.mTypePtr;
+
+            OutputLine("%s: %u %u %lu", info.mName, typeInfo.mNumBuffers, typeInfo.mMaxUsedBuffers,
+                       ToUlong(typeInfo.mNumAllocFailures));
+        }
+    }
     /**
      * @cli bufferinfo reset
      * @code
@@ -2918,6 +2981,46 @@ template <> otError Interpreter::Process<Cmd("eidcache")>(Arg aArgs[])
     {
         otThreadClearEidCache(GetInstancePtr());
     }
+    else if (aArgs[0] == "counters")
+    {
+        /**
+         * @cli eidcache counters
+         * @code
+         * eidcache counters
+         * LookupHits: 120
+         * LookupMisses: 4
+         * Evictions: 0
+         * Done
+         * @endcode
+         * @par api_copy
+         * #otThreadGetCacheCounters
+         */
+        if (aArgs[1].IsEmpty())
+        {
+            const otCacheCounters *counters = otThreadGetCacheCounters(GetInstancePtr());
+
+            OutputLine("LookupHits: %lu", ToUlong(counters->mLookupHits));
+            OutputLine("LookupMisses: %lu", ToUlong(counters->mLookupMisses));
+            OutputLine("Evictions: %lu", ToUlong(counters->mEvictions));
+        }
+        /**
+         * @cli eidcache counters reset
+         * @code
+         * eidcache counters reset
+         * Done
+         * @endcode
+         * @par api_copy
+         * #otThreadResetCacheCounters
+         */
+        else if (aArgs[1] == "reset")
+        {
+            otThreadResetCacheCounters(GetInstancePtr());
+        }
+        else
+        {
+            error = OT_ERROR_INVALID_ARGS;
+        }
+    }
     else
     {
         error = OT_ERROR_INVALID_ARGS;
@@ -302,6 +302,40 @@ exit:
     return error;
 }
 
+/**
+ * @cli srp server verifycounters
+ * @code
+ * srp server verifycounters
+ * verified: 12
+ * failed: 0
+ * cache hits: 2
+ * total latency: 54
+ * max latency: 8
+ * Done
+ * @endcode
+ * @par
+ * Prints the SRP update SIG(0) signature verification counters. The latencies are in milliseconds.
+ * @sa otSrpServerGetSignatureVerifyCounters
+ */
+template <> otError SrpServer::Process<Cmd("verifycounters")>(Arg aArgs[])
+{
+    otError                                   error = OT_ERROR_NONE;
+    const otSrpServerSignatureVerifyCounters *counters;
+
+    VerifyOrExit(aArgs[0].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+
+    counters = otSrpServerGetSignatureVerifyCounters(GetInstancePtr());
+
+    OutputLine("verified: %lu", ToUlong(counters->mNumVerified));
+    OutputLine("failed: %lu", ToUlong(counters->mNumFailed));
+    OutputLine("cache hits: %lu", ToUlong(counters->mNumCacheHits));
+    OutputLine("total latency: %lu", ToUlong(counters->mTotalLatency));
+    OutputLine("max latency: %lu", ToUlong(counters->mMaxLatency));
+
+exit:
+    return error;
+}
+
 /**
  * @cli srp server lease (get,set)
  * @code
@@ -622,7 +656,7 @@ otError SrpServer::Process(Arg aArgs[])
         CmdEntry("faststart"),
 #endif
         CmdEntry("host"),      CmdEntry("lease"),  CmdEntry("port"),   CmdEntry("seqnum"),
-        CmdEntry("service"),   CmdEntry("state"),  CmdEntry("ttl"),
+        CmdEntry("service"),   CmdEntry("state"),  CmdEntry("ttl"),    CmdEntry("verifycounters"),
     };
 
     static_assert(BinarySearch::IsSorted(kCommands), "kCommands is not sorted");
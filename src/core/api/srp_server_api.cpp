@@ -144,6 +144,11 @@ const otSrpServerResponseCounters *otSrpServerGetResponseCounters(otInstance *aI
     return AsCoreType(aInstance).Get<Srp::Server>().GetResponseCounters();
 }
 
+const otSrpServerSignatureVerifyCounters *otSrpServerGetSignatureVerifyCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<Srp::Server>().GetSignatureVerifyCounters();
+}
+
 bool otSrpServerHostIsDeleted(const otSrpServerHost *aHost) { return AsCoreType(aHost).IsDeleted(); }
 
 const char *otSrpServerHostGetFullName(const otSrpServerHost *aHost) { return AsCoreType(aHost).GetFullName(); }
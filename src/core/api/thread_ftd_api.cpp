@@ -262,6 +262,16 @@ otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntr
 
 void otThreadClearEidCache(otInstance *aInstance) { AsCoreType(aInstance).Get<AddressResolver>().Clear(); }
 
+const otCacheCounters *otThreadGetCacheCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<AddressResolver>().GetCounters();
+}
+
+void otThreadResetCacheCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<AddressResolver>().ResetCounters();
+}
+
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
 void otThreadSetSteeringData(otInstance *aInstance, const otExtAddress *aExtAddress)
 {
@@ -33,27 +33,45 @@
 
 #include "crc.hpp"
 
+#include "common/message.hpp"
+
 namespace ot {
 
-template <typename UintType> UintType CrcCalculator<UintType>::FeedByte(uint8_t aByte)
+template <typename UintType>
+UintType CrcCalculator<UintType>::UpdateBitwise(UintType aCrc, UintType aPolynomial, uint8_t aByte)
 {
-    static constexpr UintType kMsb      = kIsUint16 ? (1u << 15) : (1u << 31);
-    static constexpr uint8_t  kBitShift = kIsUint16 ? 8 : 24;
-
-    mCrc ^= (static_cast<UintType>(aByte) << kBitShift);
+    aCrc ^= (static_cast<UintType>(aByte) << kBitShift);
 
     for (uint8_t i = 8; i > 0; i--)
     {
-        bool msbIsSet = (mCrc & kMsb);
+        bool msbIsSet = (aCrc & kMsb);
 
-        mCrc <<= 1;
+        aCrc <<= 1;
 
         if (msbIsSet)
         {
-            mCrc ^= mPolynomial;
+            aCrc ^= aPolynomial;
         }
     }
 
+    return aCrc;
+}
+
+template <typename UintType> UintType CrcCalculator<UintType>::FeedByte(uint8_t aByte)
+{
+#if OPENTHREAD_CONFIG_CRC_TABLE_SLICES
+    const Table *table = Table::Find(mPolynomial);
+
+    if (table != nullptr)
+    {
+        mCrc = UpdateWithTable(*table, mCrc, aByte);
+    }
+    else
+#endif
+    {
+        mCrc = UpdateBitwise(mCrc, mPolynomial, aByte);
+    }
+
     return mCrc;
 }
 
@@ -61,14 +79,170 @@ template <typename UintType> UintType CrcCalculator<UintType>::FeedBytes(const v
 {
     const uint8_t *bytes = reinterpret_cast<const uint8_t *>(aBytes);
 
-    while (aLength-- > 0)
+#if OPENTHREAD_CONFIG_CRC_TABLE_SLICES
+    const Table *table = Table::Find(mPolynomial);
+
+    if (table != nullptr)
+    {
+        if (kNumSlices >= sizeof(UintType))
+        {
+            for (; aLength >= kNumSlices; aLength -= kNumSlices, bytes += kNumSlices)
+            {
+                mCrc = UpdateWithTable(*table, mCrc, bytes);
+            }
+        }
+
+        while (aLength-- > 0)
+        {
+            mCrc = UpdateWithTable(*table, mCrc, *bytes++);
+        }
+    }
+    else
+#endif
     {
-        FeedByte(*bytes++);
+        while (aLength-- > 0)
+        {
+            mCrc = UpdateBitwise(mCrc, mPolynomial, *bytes++);
+        }
     }
 
     return mCrc;
 }
 
+#if OPENTHREAD_CONFIG_CRC_TABLE_SLICES
+
+namespace {
+
+// `MakeValueList<N>::Type` is `ValueList<0, 1, ..., N - 1>`, used to
+// expand the table entries as a parameter pack.
+
+template <uint16_t... kValues> struct ValueList
+{
+};
+
+template <uint16_t kCount, uint16_t... kValues> struct MakeValueList : MakeValueList<kCount - 1, kCount - 1, kValues...>
+{
+};
+
+template <uint16_t... kValues> struct MakeValueList<0, kValues...>
+{
+    typedef ValueList<kValues...> Type;
+};
+
+} // namespace
+
+template <typename UintType> struct CrcCalculator<UintType>::Table
+{
+    // `mRows[k].mEntries[b]` is the CRC of byte `b` followed by `k`
+    // zero bytes (starting from a zero CRC). Tables are generated at
+    // compile time (using C++11 `constexpr` functions) for the known
+    // polynomials, so they are placed in read-only memory.
+
+    struct Row
+    {
+        UintType mEntries[kNumByteValues];
+    };
+
+    static constexpr UintType ShiftBits(UintType aPolynomial, UintType aCrc, uint8_t aNumBits)
+    {
+        return (aNumBits == 0) ? aCrc
+                               : ShiftBits(aPolynomial,
+                                           static_cast<UintType>((aCrc << 1) ^ ((aCrc & kMsb) ? aPolynomial : 0)),
+                                           static_cast<uint8_t>(aNumBits - 1));
+    }
+
+    static constexpr UintType GenerateEntry(UintType aPolynomial, uint8_t aSlice, uint16_t aValue)
+    {
+        return ShiftBits(aPolynomial, static_cast<UintType>(static_cast<UintType>(aValue) << kBitShift),
+                         static_cast<uint8_t>(8 * (aSlice + 1)));
+    }
+
+    template <uint16_t... kValues>
+    static constexpr Row GenerateRow(UintType aPolynomial, uint8_t aSlice, ValueList<kValues...>)
+    {
+        return Row{{GenerateEntry(aPolynomial, aSlice, kValues)...}};
+    }
+
+    template <uint16_t... kSlices> static constexpr Table Generate(UintType aPolynomial, ValueList<kSlices...>)
+    {
+        return Table{{GenerateRow(aPolynomial, static_cast<uint8_t>(kSlices),
+                                  typename MakeValueList<kNumByteValues>::Type())...}};
+    }
+
+    static constexpr Table Generate(UintType aPolynomial)
+    {
+        return Generate(aPolynomial, typename MakeValueList<kNumSlices>::Type());
+    }
+
+    // Returns `nullptr` for polynomials without a generated table,
+    // which then use the bit-wise algorithm.
+    static const Table *Find(UintType aPolynomial);
+
+    Row mRows[kNumSlices];
+};
+
+template <typename UintType>
+UintType CrcCalculator<UintType>::UpdateWithTable(const Table &aTable, UintType aCrc, uint8_t aByte)
+{
+    uint8_t index = static_cast<uint8_t>((aCrc >> kBitShift) ^ aByte);
+
+    return static_cast<UintType>(aCrc << 8) ^ aTable.mRows[0].mEntries[index];
+}
+
+template <typename UintType>
+UintType CrcCalculator<UintType>::UpdateWithTable(const Table &aTable, UintType aCrc, const uint8_t *aSlice)
+{
+    // Since the CRC is linear, feeding `kNumSlices` bytes is the same
+    // as XORing the CRC of each byte followed by the remaining number
+    // of zero bytes, after the current CRC is XORed into the leading
+    // bytes (MSB first).
+
+    UintType crc = 0;
+
+    for (uint8_t i = 0; i < kNumSlices; i++)
+    {
+        uint8_t byte = aSlice[i];
+
+        if (i < sizeof(UintType))
+        {
+            byte ^= static_cast<uint8_t>(aCrc >> (kBitShift - 8 * i));
+        }
+
+        crc ^= aTable.mRows[kNumSlices - 1 - i].mEntries[byte];
+    }
+
+    return crc;
+}
+
+template <> const CrcCalculator<uint16_t>::Table *CrcCalculator<uint16_t>::Table::Find(uint16_t aPolynomial)
+{
+    static constexpr Table kCrc16CcittTable = Generate(kCrc16CcittPolynomial);
+    static constexpr Table kCrc16AnsiTable  = Generate(kCrc16AnsiPolynomial);
+
+    const Table *table = nullptr;
+
+    if (aPolynomial == kCrc16CcittPolynomial)
+    {
+        table = &kCrc16CcittTable;
+    }
+    else if (aPolynomial == kCrc16AnsiPolynomial)
+    {
+        table = &kCrc16AnsiTable;
+    }
+
+    return table;
+}
+
+template <> const CrcCalculator<uint32_t>::Table *CrcCalculator<uint32_t>::Table::Find(uint32_t aPolynomial)
+{
+    static constexpr Table kCrc32AnsiTable = Generate(kCrc32AnsiPolynomial);
+
+    return (aPolynomial == kCrc32AnsiPolynomial) ? &kCrc32AnsiTable : nullptr;
+}
+
+#endif // OPENTHREAD_CONFIG_CRC_TABLE_SLICES
+
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
 template <typename UintType>
 UintType CrcCalculator<UintType>::Feed(const Message &aMessage, const OffsetRange &aOffsetRange)
 {
@@ -85,6 +259,7 @@ UintType CrcCalculator<UintType>::Feed(const Message &aMessage, const OffsetRang
 
     return mCrc;
 }
+#endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 
 template class CrcCalculator<uint16_t>;
 template class CrcCalculator<uint32_t>;
@@ -36,11 +36,13 @@
 
 #include "openthread-core-config.h"
 
-#include "common/message.hpp"
 #include "common/type_traits.hpp"
 
 namespace ot {
 
+class Message;
+class OffsetRange;
+
 constexpr uint16_t kCrc16CcittPolynomial = 0x1021; ///< CRC16-CCITT Polynomial (x^16 + x^12 + x^5 + 1)
 constexpr uint16_t kCrc16AnsiPolynomial  = 0x8005; ///< CRC16-ANSI Polynomial  (x^16 + x^15 + x^2 + 1)
 
@@ -63,6 +65,9 @@ template <typename UintType> class CrcCalculator
 
     static_assert(kIsUint16 || kIsUint32, "UintType MUST be either `uint16_t` or `uint32_t`");
 
+    static constexpr UintType kMsb      = kIsUint16 ? (1u << 15) : (1u << 31);
+    static constexpr uint8_t  kBitShift = kIsUint16 ? 8 : 24;
+
 public:
     /**
      * Initializes the `CrcCalculator` object.
@@ -127,6 +132,24 @@ public:
     UintType Feed(const Message &aMessage, const OffsetRange &aOffsetRange);
 
 private:
+    static UintType UpdateBitwise(UintType aCrc, UintType aPolynomial, uint8_t aByte);
+
+#if OPENTHREAD_CONFIG_CRC_TABLE_SLICES
+    static constexpr uint8_t  kNumSlices     = OPENTHREAD_CONFIG_CRC_TABLE_SLICES;
+    static constexpr uint16_t kNumByteValues = 256;
+
+    static_assert(kNumSlices == 1 || kNumSlices == 4 || kNumSlices == 8, "CRC_TABLE_SLICES MUST be 0, 1, 4, or 8");
+
+    struct Table;
+
+    static UintType UpdateWithTable(const Table &aTable, UintType aCrc, uint8_t aByte);
+    static UintType UpdateWithTable(const Table &aTable, UintType aCrc, const uint8_t *aSlice);
+#endif
+
+    // The class layout does not depend on `CRC_TABLE_SLICES` (the
+    // table is looked up from `mPolynomial`), so code built with a
+    // different config can share `CrcCalculator` objects.
+
     UintType mPolynomial;
     UintType mCrc;
 };
@@ -41,6 +41,11 @@
 #error "OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE conflicts with OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT."
 #endif
 
+#if (OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0) && \
+    (OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE || OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT)
+#error "OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS requires the OT internal message pool."
+#endif
+
 namespace ot {
 
 RegisterLogModule("Message");
@@ -52,7 +57,18 @@ MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mNumAllocated(0)
     , mMaxAllocated(0)
+    , mMaxAllocatedTime(TimerMilli::GetNow())
+    , mNumAllocFailures(0)
 {
+    ClearAllBytes(mTypeBufferInfo);
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+    for (LargeBuffer &largeBuffer : mLargeBuffers)
+    {
+        mFreeLargeBuffers.Push(largeBuffer);
+    }
+#endif
+
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
 #endif
@@ -67,14 +83,16 @@ Message *MessagePool::Allocate(Message::Type aType, uint16_t aReserveHeader, con
     Error    error = kErrorNone;
     Message *message;
 
-    VerifyOrExit((message = static_cast<Message *>(NewBuffer(aSettings.GetPriority()))) != nullptr);
+    VerifyOrExit((message = static_cast<Message *>(NewBuffer(aType, aSettings.GetPriority()))) != nullptr);
 
     ClearAllBytes(*message);
 
 #if OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
     message->GetMetadata().mInstance = &GetInstance();
 #endif
-    message->SetType(aType);
+    // The buffer is already accounted to `aType` by `NewBuffer()`, so
+    // the type is set directly instead of using `SetType()`.
+    message->GetMetadata().mType = aType;
     message->SetReserved(aReserveHeader);
     message->SetLinkSecurityEnabled(aSettings.IsLinkSecurityEnabled());
     message->SetLoopbackToHostAllowed(OPENTHREAD_CONFIG_IP6_ALLOW_LOOP_BACK_HOST_DATAGRAMS);
@@ -105,11 +123,13 @@ void MessagePool::Free(Message *aMessage)
 {
     OT_ASSERT(!aMessage->IsInAQueue());
 
-    FreeBuffers(static_cast<Buffer *>(aMessage));
+    FreeBuffers(static_cast<Buffer *>(aMessage), aMessage->GetType());
 }
 
-Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
+Buffer *MessagePool::NewBuffer(Message::Type aType, Message::Priority aPriority)
 {
+    otMessageTypeBufferInfo &typeInfo = mTypeBufferInfo[aType];
+
     Buffer *buffer = nullptr;
 
     while ((
@@ -126,37 +146,112 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
     }
 
     mNumAllocated++;
-    mMaxAllocated = Max(mMaxAllocated, mNumAllocated);
+
+    if (mNumAllocated > mMaxAllocated)
+    {
+        mMaxAllocated     = mNumAllocated;
+        mMaxAllocatedTime = TimerMilli::GetNow();
+    }
+
+    typeInfo.mNumBuffers++;
+    typeInfo.mMaxUsedBuffers = Max(typeInfo.mMaxUsedBuffers, typeInfo.mNumBuffers);
 
     buffer->SetNextBuffer(nullptr);
 
 exit:
     if (buffer == nullptr)
     {
+        mNumAllocFailures++;
+        typeInfo.mNumAllocFailures++;
         LogInfo("No available message buffer");
     }
 
     return buffer;
 }
 
-void MessagePool::FreeBuffers(Buffer *aBuffer)
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+Buffer *MessagePool::NewLargeBuffer(Message::Type aType)
+{
+    // Unlike `NewBuffer()`, no queued message is evicted when no
+    // large buffer is available. The caller falls back to using
+    // regular buffers instead.
+
+    otMessageTypeBufferInfo &typeInfo = mTypeBufferInfo[aType];
+    Buffer                  *buffer   = mFreeLargeBuffers.Pop();
+
+    VerifyOrExit(buffer != nullptr);
+
+    mNumAllocated++;
+
+    if (mNumAllocated > mMaxAllocated)
+    {
+        mMaxAllocated     = mNumAllocated;
+        mMaxAllocatedTime = TimerMilli::GetNow();
+    }
+
+    typeInfo.mNumBuffers++;
+    typeInfo.mMaxUsedBuffers = Max(typeInfo.mMaxUsedBuffers, typeInfo.mNumBuffers);
+
+    buffer->SetNextBuffer(nullptr);
+
+exit:
+    return buffer;
+}
+#endif
+
+void MessagePool::FreeBuffers(Buffer *aBuffer, Message::Type aType)
 {
     while (aBuffer != nullptr)
     {
         Buffer *next = aBuffer->GetNextBuffer();
+
+        mTypeBufferInfo[aType].mNumBuffers--;
+        mNumAllocated--;
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+        if (IsLargeBuffer(*aBuffer))
+        {
+            mFreeLargeBuffers.Push(*aBuffer);
+        }
+        else
+#endif
+        {
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-        Heap::Free(aBuffer);
+            Heap::Free(aBuffer);
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
-        otPlatMessagePoolFree(&GetInstance(), aBuffer);
+            otPlatMessagePoolFree(&GetInstance(), aBuffer);
 #else
-        mBufferPool.Free(*aBuffer);
+            mBufferPool.Free(*aBuffer);
 #endif
-        mNumAllocated--;
+        }
 
         aBuffer = next;
     }
 }
 
+void MessagePool::UpdateTypeBufferInfo(Message::Type aOldType, Message::Type aNewType, uint16_t aNumBuffers)
+{
+    otMessageTypeBufferInfo &newTypeInfo = mTypeBufferInfo[aNewType];
+
+    mTypeBufferInfo[aOldType].mNumBuffers -= aNumBuffers;
+
+    newTypeInfo.mNumBuffers += aNumBuffers;
+    newTypeInfo.mMaxUsedBuffers = Max(newTypeInfo.mMaxUsedBuffers, newTypeInfo.mNumBuffers);
+}
+
+void MessagePool::ResetBufferStats(void)
+{
+    mMaxAllocated     = mNumAllocated;
+    mMaxAllocatedTime = TimerMilli::GetNow();
+    mNumAllocFailures = 0;
+
+    for (otMessageTypeBufferInfo &typeInfo : mTypeBufferInfo)
+    {
+        typeInfo.mMaxUsedBuffers   = typeInfo.mNumBuffers;
+        typeInfo.mNumAllocFailures = 0;
+    }
+}
+
 Error MessagePool::ReclaimBuffers(Message::Priority aPriority)
 {
     return Get<MeshForwarder>().EvictMessage(aPriority, MeshForwarder::kEvictReasonNoMessageBuffer);
@@ -176,6 +271,9 @@ uint16_t MessagePool::GetFreeBufferCount(void) const
     rval = otPlatMessagePoolNumFreeBuffers(&GetInstance());
 #else
     rval = kNumBuffers - mNumAllocated;
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+    rval += kNumLargeBuffers;
+#endif
 #endif
 
     return rval;
@@ -192,7 +290,7 @@ uint16_t MessagePool::GetTotalBufferCount(void) const
     SetToUintMax(rval);
 #endif
 #else
-    rval = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
+    rval = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS + OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS;
 #endif
 
     return rval;
@@ -240,19 +338,43 @@ Error Message::ResizeMessage(uint16_t aLength)
     {
         if (curBuffer->GetNextBuffer() == nullptr)
         {
-            curBuffer->SetNextBuffer(Get<MessagePool>().NewBuffer(GetPriority()));
-            VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = kErrorNoBufs);
+            Buffer *newBuffer = nullptr;
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+            // Use a large buffer only if it leaves at most a regular
+            // buffer worth of its data space unused.
+
+            if (aLength - curLength >= kLargeBufferDataSize - kBufferDataSize)
+            {
+                newBuffer = Get<MessagePool>().NewLargeBuffer(GetType());
+            }
+
+            if (newBuffer == nullptr)
+#endif
+            {
+                newBuffer = Get<MessagePool>().NewBuffer(GetType(), GetPriority());
+            }
+
+            VerifyOrExit(newBuffer != nullptr, error = kErrorNoBufs);
+            curBuffer->SetNextBuffer(newBuffer);
         }
 
         curBuffer = curBuffer->GetNextBuffer();
-        curLength += kBufferDataSize;
+        curLength += GetBufferDataSize(*curBuffer);
     }
 
     lastBuffer = curBuffer;
     curBuffer  = curBuffer->GetNextBuffer();
     lastBuffer->SetNextBuffer(nullptr);
 
-    Get<MessagePool>().FreeBuffers(curBuffer);
+#if OPENTHREAD_CONFIG_MESSAGE_CHUNK_CURSOR_ENABLE
+    if (curBuffer != nullptr)
+    {
+        ResetChunkCursor();
+    }
+#endif
+
+    Get<MessagePool>().FreeBuffers(curBuffer, GetType());
 
 exit:
     return error;
@@ -299,6 +421,15 @@ exit:
     return error;
 }
 
+void Message::SetType(Type aType)
+{
+    if (aType != GetType())
+    {
+        Get<MessagePool>().UpdateTypeBufferInfo(GetType(), aType, GetBufferCount());
+        GetMetadata().mType = aType;
+    }
+}
+
 uint8_t Message::GetBufferCount(void) const
 {
     uint8_t rval = 1;
@@ -311,6 +442,19 @@ uint8_t Message::GetBufferCount(void) const
     return rval;
 }
 
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+const uint8_t *Message::GetBufferData(const Buffer &aBuffer) const
+{
+    return Get<MessagePool>().IsLargeBuffer(aBuffer) ? static_cast<const LargeBuffer &>(aBuffer).GetData()
+                                                     : aBuffer.GetData();
+}
+
+uint16_t Message::GetBufferDataSize(const Buffer &aBuffer) const
+{
+    return Get<MessagePool>().IsLargeBuffer(aBuffer) ? kLargeBufferDataSize : kBufferDataSize;
+}
+#endif
+
 void Message::MoveOffset(int16_t aDelta)
 {
     int32_t newOffset = static_cast<int32_t>(GetOffset()) + aDelta;
@@ -428,11 +572,17 @@ Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
 
     while (aLength > GetReserved())
     {
-        VerifyOrExit((newBuffer = Get<MessagePool>().NewBuffer(GetPriority())) != nullptr, error = kErrorNoBufs);
+        VerifyOrExit((newBuffer = Get<MessagePool>().NewBuffer(GetType(), GetPriority())) != nullptr,
+                     error = kErrorNoBufs);
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
 
+#if OPENTHREAD_CONFIG_MESSAGE_CHUNK_CURSOR_ENABLE
+        // All buffers after the head are now shifted by one.
+        ResetChunkCursor();
+#endif
+
         if (GetReserved() < sizeof(mBuffer.mHead.mData))
         {
             // Copy payload from the first buffer.
@@ -545,6 +695,8 @@ void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk)
     // its length. The `aLength` is also decreased by the chunk
     // length.
 
+    uint16_t bufferOffset;
+
     VerifyOrExit(aOffset < GetLength(), aChunk.SetLength(0));
 
     if (!CanAddSafely<uint16_t>(aOffset, aLength) || (aOffset + aLength >= GetLength()))
@@ -564,25 +716,44 @@ void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk)
         ExitNow();
     }
 
-    aOffset -= kHeadBufferDataSize;
+    // Find the `Buffer` matching the offset. `bufferOffset` tracks
+    // the offset of the first data byte in `aChunk.GetBuffer()`.
 
-    // Find the `Buffer` matching the offset
+    bufferOffset = kHeadBufferDataSize;
+    aChunk.SetBuffer(GetNextBuffer());
 
-    while (true)
+#if OPENTHREAD_CONFIG_MESSAGE_CHUNK_CURSOR_ENABLE
+    // Resume from the last visited buffer if it is not past the
+    // requested offset.
+
+    if ((GetMetadata().mCursorBuffer != nullptr) && (aOffset >= GetMetadata().mCursorOffset))
     {
-        aChunk.SetBuffer(aChunk.GetBuffer()->GetNextBuffer());
+        aChunk.SetBuffer(GetMetadata().mCursorBuffer);
+        bufferOffset = GetMetadata().mCursorOffset;
+    }
+#endif
 
+    while (true)
+    {
         OT_ASSERT(aChunk.GetBuffer() != nullptr);
 
-        if (aOffset < kBufferDataSize)
+        if (aOffset - bufferOffset < GetBufferDataSize(*aChunk.GetBuffer()))
         {
-            aChunk.Init(aChunk.GetBuffer()->GetData() + aOffset, kBufferDataSize - aOffset);
-            ExitNow();
+            break;
         }
 
-        aOffset -= kBufferDataSize;
+        bufferOffset += GetBufferDataSize(*aChunk.GetBuffer());
+        aChunk.SetBuffer(aChunk.GetBuffer()->GetNextBuffer());
     }
 
+#if OPENTHREAD_CONFIG_MESSAGE_CHUNK_CURSOR_ENABLE
+    AsNonConst(this)->GetMetadata().mCursorBuffer = aChunk.GetBuffer();
+    AsNonConst(this)->GetMetadata().mCursorOffset = bufferOffset;
+#endif
+
+    aOffset -= bufferOffset;
+    aChunk.Init(GetBufferData(*aChunk.GetBuffer()) + aOffset, GetBufferDataSize(*aChunk.GetBuffer()) - aOffset);
+
 exit:
     if (aChunk.GetLength() > aLength)
     {
@@ -606,7 +777,7 @@ void Message::GetNextChunk(uint16_t &aLength, Chunk &aChunk) const
 
     OT_ASSERT(aChunk.GetBuffer() != nullptr);
 
-    aChunk.Init(aChunk.GetBuffer()->GetData(), kBufferDataSize);
+    aChunk.Init(GetBufferData(*aChunk.GetBuffer()), GetBufferDataSize(*aChunk.GetBuffer()));
 
     if (aChunk.GetLength() > aLength)
     {
@@ -913,6 +1084,63 @@ void Message::MarkAsNotInAQueue(void)
     GetMetadata().mInPriorityQ = false;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// MessageReader
+
+MessageReader::MessageReader(const Message &aMessage, const OffsetRange &aOffsetRange)
+    : mMessage(&aMessage)
+    , mOffset(aOffsetRange.GetOffset())
+    , mLength(aOffsetRange.GetLength())
+{
+    mMessage->GetFirstChunk(mOffset, mLength, mChunk);
+
+    if (mOffset >= mMessage->GetLength())
+    {
+        mLength = 0;
+    }
+}
+
+MessageReader::MessageReader(const Message &aMessage)
+    : mMessage(&aMessage)
+    , mOffset(aMessage.GetOffset())
+    , mLength(aMessage.DetermineLengthAfterOffset())
+{
+    mMessage->GetFirstChunk(mOffset, mLength, mChunk);
+}
+
+Error MessageReader::Advance(uint8_t *aBuf, uint16_t aLength)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aLength <= GetRemainingLength(), error = kErrorParse);
+
+    mOffset += aLength;
+
+    while (aLength > 0)
+    {
+        uint16_t length;
+
+        if (mChunk.GetLength() == 0)
+        {
+            mMessage->GetNextChunk(mLength, mChunk);
+        }
+
+        length = Min(aLength, mChunk.GetLength());
+
+        if (aBuf != nullptr)
+        {
+            memcpy(aBuf, mChunk.GetBytes(), length);
+            aBuf += length;
+        }
+
+        mChunk.Init(mChunk.GetBytes() + length, mChunk.GetLength() - length);
+        aLength -= length;
+    }
+
+exit:
+    return error;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // MessageQueue
 
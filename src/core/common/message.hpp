@@ -149,6 +149,7 @@ class PlatTcp;
 class Message;
 class MessagePool;
 class MessageQueue;
+class MessageReader;
 class PriorityQueue;
 
 /**
@@ -178,6 +179,9 @@ class Buffer : public otMessageBuffer, public LinkedListEntry<Buffer>
 
 public:
     static constexpr uint16_t kSize = OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE; ///< Size of buffer in bytes.
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+    static constexpr uint16_t kLargeSize = OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE; ///< Size of large buffer.
+#endif
 
     typedef otMessageTxCallback TxCallback; ///< Message TX callback.
 
@@ -254,6 +258,10 @@ protected:
         LqiAverager mLqiAverager; // The averager maintaining the Link quality indicator (LQI) average.
 #if OPENTHREAD_FTD
         ChildMask mChildMask; // ChildMask to indicate which sleepy children need to receive this.
+#endif
+#if OPENTHREAD_CONFIG_MESSAGE_CHUNK_CURSOR_ENABLE
+        const Buffer *mCursorBuffer; // Last visited (non-head) buffer, or `nullptr` if none.
+        uint16_t      mCursorOffset; // Offset (including reserved bytes) of the first data byte in `mCursorBuffer`.
 #endif
     };
 
@@ -261,6 +269,9 @@ protected:
 
     static constexpr uint16_t kBufferDataSize     = kSize - sizeof(otMessageBuffer);
     static constexpr uint16_t kHeadBufferDataSize = kBufferDataSize - sizeof(Metadata);
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+    static constexpr uint16_t kLargeBufferDataSize = kLargeSize - sizeof(otMessageBuffer);
+#endif
 
     Metadata       &GetMetadata(void) { return mBuffer.mHead.mMetadata; }
     const Metadata &GetMetadata(void) const { return mBuffer.mHead.mMetadata; }
@@ -286,12 +297,41 @@ private:
 static_assert(sizeof(Buffer) >= Buffer::kSize,
               "Buffer size is not valid. Increase OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE.");
 
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+
+/**
+ * Represents a large message buffer.
+ *
+ * A `LargeBuffer` is a `Buffer` followed by extra bytes. Its data spans `kLargeBufferDataSize` bytes following the
+ * `otMessageBuffer` header and is accessed through `LargeBuffer::GetData()` (never through `Buffer::GetData()`). A
+ * large buffer is never used as the first buffer of a message.
+ */
+class LargeBuffer : public Buffer
+{
+    friend class Message;
+
+protected:
+    static constexpr uint16_t kDataOffset = sizeof(otMessageBuffer);
+
+    uint8_t       *GetData(void) { return reinterpret_cast<uint8_t *>(this) + kDataOffset; }
+    const uint8_t *GetData(void) const { return reinterpret_cast<const uint8_t *>(this) + kDataOffset; }
+
+    uint8_t mExtraData[kLargeSize - kSize];
+};
+
+static_assert(Buffer::kLargeSize > 2 * Buffer::kSize,
+              "Large buffer size is not valid. Increase OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE.");
+static_assert(sizeof(LargeBuffer) >= Buffer::kLargeSize, "LargeBuffer size is not valid");
+
+#endif
+
 /**
  * Represents a message.
  */
 class Message : public otMessage, public Buffer, public GetProvider<Message>
 {
     friend class Checksum;
+    friend class MessageReader;
     friend class CrcCalculator<uint16_t>;
     friend class CrcCalculator<uint32_t>;
     friend class Crypto::HmacSha256;
@@ -568,9 +608,11 @@ public:
     /**
      * Sets the message type.
      *
+     * The buffers used by the message are accounted to the new type in `MessagePool` buffer info.
+     *
      * @param[in]  aType  The message type.
      */
-    void SetType(Type aType) { GetMetadata().mType = aType; }
+    void SetType(Type aType);
 
     /**
      * Returns the sub type of the message.
@@ -1668,6 +1710,18 @@ private:
         AsConst(this)->GetNextChunk(aLength, static_cast<Chunk &>(aChunk));
     }
 
+#if OPENTHREAD_CONFIG_MESSAGE_CHUNK_CURSOR_ENABLE
+    void ResetChunkCursor(void) { GetMetadata().mCursorBuffer = nullptr; }
+#endif
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+    const uint8_t *GetBufferData(const Buffer &aBuffer) const;
+    uint16_t       GetBufferDataSize(const Buffer &aBuffer) const;
+#else
+    const uint8_t *GetBufferData(const Buffer &aBuffer) const { return aBuffer.GetData(); }
+    uint16_t       GetBufferDataSize(const Buffer &) const { return kBufferDataSize; }
+#endif
+
     void MarkAsNotInAQueue(void);
     bool IsInAQueue(void) const { return (Prev() != this); }
     bool IsInAPriorityQueue(void) const { return GetMetadata().mInPriorityQ; }
@@ -1686,6 +1740,97 @@ private:
     Error ResizeMessage(uint16_t aLength);
 };
 
+/**
+ * Implements a sequential reader over an offset range in a `Message`.
+ *
+ * `Message::Read()` at a given offset needs to locate the buffer containing the offset on every call. `MessageReader`
+ * instead tracks its current position within the message buffer chain, so consecutive reads (e.g., parsing a sequence
+ * of headers or TLVs) advance without walking the chain again.
+ *
+ * The message MUST NOT be modified (e.g., its length changed, or a header prepended or removed) while a
+ * `MessageReader` is in use.
+ */
+class MessageReader
+{
+public:
+    /**
+     * Initializes the `MessageReader` to read from a given offset range in a message.
+     *
+     * The offset range is limited to the message length.
+     *
+     * @param[in] aMessage      The message to read from.
+     * @param[in] aOffsetRange  The offset range in @p aMessage to read from.
+     */
+    MessageReader(const Message &aMessage, const OffsetRange &aOffsetRange);
+
+    /**
+     * Initializes the `MessageReader` to read from the message offset (`Message::GetOffset()`) to its end.
+     *
+     * @param[in] aMessage      The message to read from.
+     */
+    explicit MessageReader(const Message &aMessage);
+
+    /**
+     * Gets the current read offset in the message.
+     *
+     * @returns The current read offset.
+     */
+    uint16_t GetOffset(void) const { return mOffset; }
+
+    /**
+     * Gets the number of remaining bytes to read.
+     *
+     * @returns The remaining length.
+     */
+    uint16_t GetRemainingLength(void) const { return mChunk.GetLength() + mLength; }
+
+    /**
+     * Reads a given number of bytes and advances the reader.
+     *
+     * @param[out] aBuf     A pointer to a data buffer to copy the read bytes into.
+     * @param[in]  aLength  Number of bytes to read.
+     *
+     * @retval kErrorNone     Requested bytes were successfully read. The reader is advanced.
+     * @retval kErrorParse    Not enough bytes remaining to read the requested @p aLength. The reader is unchanged.
+     */
+    Error ReadBytes(void *aBuf, uint16_t aLength) { return Advance(static_cast<uint8_t *>(aBuf), aLength); }
+
+    /**
+     * Reads an object and advances the reader.
+     *
+     * @tparam     ObjectType   The object type to read.
+     *
+     * @param[out] aObject      A reference to the object to read into.
+     *
+     * @retval kErrorNone     Object @p aObject was successfully read. The reader is advanced.
+     * @retval kErrorParse    Not enough bytes remaining to read the entire object. The reader is unchanged.
+     */
+    template <typename ObjectType> Error Read(ObjectType &aObject)
+    {
+        static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+
+        return ReadBytes(&aObject, sizeof(ObjectType));
+    }
+
+    /**
+     * Skips over a given number of bytes.
+     *
+     * @param[in]  aLength  Number of bytes to skip.
+     *
+     * @retval kErrorNone     Successfully skipped @p aLength bytes.
+     * @retval kErrorParse    Fewer than @p aLength bytes remaining. The reader is unchanged.
+     */
+    Error Skip(uint16_t aLength) { return Advance(nullptr, aLength); }
+
+private:
+    Error Advance(uint8_t *aBuf, uint16_t aLength);
+
+    const Message *mMessage;
+    Message::Chunk mChunk;  // Unread part of current chunk.
+    uint16_t       mOffset; // Current read offset.
+    uint16_t       mLength; // Remaining length after `mChunk`.
+};
+
 /**
  * Implements a message queue.
  */
@@ -2019,6 +2164,8 @@ public:
     /**
      * Returns the number of free buffers.
      *
+     * Large buffers (`OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS`) are included, each counted as one buffer.
+     *
      * @returns The number of free buffers, or 0xffff (UINT16_MAX) if number is unknown.
      */
     uint16_t GetFreeBufferCount(void) const;
@@ -2026,37 +2173,86 @@ public:
     /**
      * Returns the total number of buffers.
      *
+     * Large buffers (`OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS`) are included, each counted as one buffer.
+     *
      * @returns The total number of buffers, or 0xffff (UINT16_MAX) if number is unknown.
      */
     uint16_t GetTotalBufferCount(void) const;
 
     /**
      * Returns the maximum number of buffers in use at the same time since OT stack initialization or
-     * since last call to `ResetMaxUsedBufferCount()`.
+     * since last call to `ResetBufferStats()`.
      *
      * @returns The maximum number of buffers in use at the same time so far (buffer allocation watermark).
      */
     uint16_t GetMaxUsedBufferCount(void) const { return mMaxAllocated; }
 
     /**
-     * Resets the tracked maximum number of buffers in use.
+     * Returns the time when the maximum number of buffers in use (`GetMaxUsedBufferCount()`) was last reached.
+     *
+     * @returns The time when the buffer allocation watermark was last reached.
+     */
+    TimeMilli GetMaxUsedBufferTime(void) const { return mMaxAllocatedTime; }
+
+    /**
+     * Returns the number of failed buffer allocations since OT stack initialization or since last call to
+     * `ResetBufferStats()`.
+     *
+     * A buffer allocation fails when no buffer is available and no queued message can be evicted to free one.
+     *
+     * @returns The number of failed buffer allocations.
+     */
+    uint32_t GetAllocFailureCount(void) const { return mNumAllocFailures; }
+
+    /**
+     * Returns the buffer usage info of messages of a given type.
+     *
+     * @param[in] aType  The message type.
+     *
+     * @returns The buffer usage info of messages of type @p aType.
+     */
+    const otMessageTypeBufferInfo &GetTypeBufferInfo(Message::Type aType) const { return mTypeBufferInfo[aType]; }
+
+    /**
+     * Resets the tracked maximum number of buffers in use and the allocation failure counters (including the
+     * per message type ones).
      *
      * @sa GetMaxUsedBufferCount
+     * @sa GetAllocFailureCount
      */
-    void ResetMaxUsedBufferCount(void) { mMaxAllocated = mNumAllocated; }
+    void ResetBufferStats(void);
 
 private:
     static constexpr uint16_t kNumBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
+    static constexpr uint8_t  kNumTypes   = Message::kTypeOther + 1;
 
-    Buffer *NewBuffer(Message::Priority aPriority);
-    void    FreeBuffers(Buffer *aBuffer);
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+    static constexpr uint16_t kNumLargeBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS;
+
+    Buffer *NewLargeBuffer(Message::Type aType);
+    bool    IsLargeBuffer(const Buffer &aBuffer) const
+    {
+        return (&mLargeBuffers[0] <= &aBuffer) && (&aBuffer < GetArrayEnd(mLargeBuffers));
+    }
+#endif
+
+    Buffer *NewBuffer(Message::Type aType, Message::Priority aPriority);
+    void    FreeBuffers(Buffer *aBuffer, Message::Type aType);
+    void    UpdateTypeBufferInfo(Message::Type aOldType, Message::Type aNewType, uint16_t aNumBuffers);
     Error   ReclaimBuffers(Message::Priority aPriority);
 
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     Pool<Buffer, kNumBuffers> mBufferPool;
 #endif
-    uint16_t mNumAllocated;
-    uint16_t mMaxAllocated;
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+    LargeBuffer        mLargeBuffers[kNumLargeBuffers];
+    LinkedList<Buffer> mFreeLargeBuffers;
+#endif
+    uint16_t                mNumAllocated;
+    uint16_t                mMaxAllocated;
+    TimeMilli               mMaxAllocatedTime;
+    uint32_t                mNumAllocFailures;
+    otMessageTypeBufferInfo mTypeBufferInfo[kNumTypes];
 };
 
 // Declare specializations of `Message::Clone<CloneMode>()` (implemented in `message.cpp`).
@@ -0,0 +1,284 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a case-insensitive name hash and a hash index of entries by name.
+ */
+
+#ifndef OT_CORE_COMMON_NAME_INDEX_HPP_
+#define OT_CORE_COMMON_NAME_INDEX_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+namespace ot {
+
+/**
+ * Calculates a case-insensitive hash (FNV-1a) over a name.
+ *
+ * Characters are converted to lowercase before being added, so two names which differ only in letter case (ASCII)
+ * have the same hash.
+ */
+class NameHash
+{
+public:
+    /**
+     * Initializes the `NameHash`.
+     */
+    NameHash(void)
+        : mHash(kOffsetBasis)
+    {
+    }
+
+    /**
+     * Adds a byte to the hash as is (no case conversion).
+     *
+     * @param[in] aByte   The byte to add.
+     */
+    void AddByte(uint8_t aByte) { mHash = (mHash ^ aByte) * kPrime; }
+
+    /**
+     * Adds a given number of characters to the hash, converting each to lowercase.
+     *
+     * @param[in] aChars   A pointer to the characters.
+     * @param[in] aLength  The number of characters to add.
+     */
+    void AddChars(const char *aChars, uint16_t aLength);
+
+    /**
+     * Adds a null-terminated string to the hash, converting each character to lowercase.
+     *
+     * @param[in] aString  The string to add.
+     */
+    void AddString(const char *aString);
+
+    /**
+     * Gets the current hash value.
+     *
+     * @returns The hash value.
+     */
+    uint32_t GetValue(void) const { return mHash; }
+
+    /**
+     * Calculates the case-insensitive hash of a null-terminated string.
+     *
+     * @param[in] aString  The string.
+     *
+     * @returns The hash value.
+     */
+    static uint32_t Calculate(const char *aString);
+
+private:
+    static constexpr uint32_t kOffsetBasis = 2166136261u;
+    static constexpr uint32_t kPrime       = 16777619u;
+
+    uint32_t mHash;
+};
+
+/**
+ * Represents the link of an entry in a `NameIndex`.
+ *
+ * An entry type that is indexed includes a `NameIndexLink` member per index it can be added to.
+ *
+ * @tparam EntryType  The entry type.
+ */
+template <typename EntryType> struct NameIndexLink
+{
+    /**
+     * Initializes the link (entry not in an index).
+     */
+    void Init(void)
+    {
+        mHash = 0;
+        mNext = nullptr;
+    }
+
+    uint32_t   mHash; ///< The hash of the indexed name.
+    EntryType *mNext; ///< The next entry in the same bucket.
+};
+
+/**
+ * Implements an intrusive hash index of entries by name.
+ *
+ * Each bucket is a singly linked list through the `kLink` member of the entries. Entries are added at the head of
+ * their bucket. The index does not own or allocate the entries, and the name of an entry must not change while it is
+ * in the index.
+ *
+ * The hash of a name is provided by the caller (e.g., using `NameHash`). Entries with the same hash are not
+ * necessarily matching, so the caller (or `FindMatching()`) checks the entry's full name.
+ *
+ * @tparam EntryType    The entry type.
+ * @tparam kLink        A pointer to the `NameIndexLink<EntryType>` member of `EntryType` used by the index.
+ * @tparam kNumBuckets  The number of buckets.
+ */
+template <typename EntryType, NameIndexLink<EntryType> EntryType::*kLink, uint16_t kNumBuckets> class NameIndex
+{
+    static_assert(kNumBuckets > 0, "kNumBuckets must be non-zero");
+
+public:
+    /**
+     * Initializes the `NameIndex` as empty.
+     */
+    NameIndex(void) { Clear(); }
+
+    /**
+     * Clears the index.
+     *
+     * The entries are not changed.
+     */
+    void Clear(void)
+    {
+        for (EntryType *&bucket : mBuckets)
+        {
+            bucket = nullptr;
+        }
+    }
+
+    /**
+     * Adds an entry to the index.
+     *
+     * @param[in] aEntry  The entry to add. MUST NOT be already in the index.
+     * @param[in] aHash   The hash of the entry's name.
+     */
+    void Add(EntryType &aEntry, uint32_t aHash)
+    {
+        EntryType *&bucket = GetBucket(aHash);
+
+        (aEntry.*kLink).mHash = aHash;
+        (aEntry.*kLink).mNext = bucket;
+        bucket                = &aEntry;
+    }
+
+    /**
+     * Removes an entry from the index.
+     *
+     * It is safe to call this method for an entry that is not in the index (its link must be initialized with
+     * `NameIndexLink::Init()` or from an earlier `Add()`). The index is then left unchanged.
+     *
+     * @param[in] aEntry  The entry to remove.
+     */
+    void Remove(EntryType &aEntry)
+    {
+        for (EntryType **entryPtr = &GetBucket((aEntry.*kLink).mHash); *entryPtr != nullptr;
+             entryPtr             = &((*entryPtr)->*kLink).mNext)
+        {
+            if (*entryPtr == &aEntry)
+            {
+                *entryPtr = (aEntry.*kLink).mNext;
+                break;
+            }
+        }
+    }
+
+    /**
+     * Finds the first entry in the index with a given hash.
+     *
+     * @param[in] aHash  The hash.
+     *
+     * @returns A pointer to the first entry with @p aHash, or `nullptr` if none.
+     */
+    EntryType *FindFirst(uint32_t aHash) const { return FindFrom(GetBucket(aHash), aHash); }
+
+    /**
+     * Finds the next entry in the index with the same hash as a given entry.
+     *
+     * @param[in] aEntry  The previous entry (MUST be in the index).
+     *
+     * @returns A pointer to the next entry with the same hash as @p aEntry, or `nullptr` if none.
+     */
+    EntryType *FindNext(const EntryType &aEntry) const
+    {
+        return FindFrom((aEntry.*kLink).mNext, (aEntry.*kLink).mHash);
+    }
+
+    /**
+     * Finds the first entry in the index with a given hash that matches a given name.
+     *
+     * `EntryType` MUST provide a `bool Matches(const NameType &aName) const` method.
+     *
+     * @tparam NameType  The name type.
+     *
+     * @param[in] aHash  The hash of @p aName.
+     * @param[in] aName  The name to match.
+     *
+     * @returns A pointer to the matching entry, or `nullptr` if none.
+     */
+    template <typename NameType> EntryType *FindMatching(uint32_t aHash, const NameType &aName) const
+    {
+        return FindMatchingFrom(FindFirst(aHash), aName);
+    }
+
+    /**
+     * Finds the next entry in the index after a given entry that matches a given name.
+     *
+     * `EntryType` MUST provide a `bool Matches(const NameType &aName) const` method.
+     *
+     * @tparam NameType  The name type.
+     *
+     * @param[in] aPrevEntry  The previous entry (MUST be in the index, and matching @p aName).
+     * @param[in] aName       The name to match.
+     *
+     * @returns A pointer to the next matching entry, or `nullptr` if none.
+     */
+    template <typename NameType> EntryType *FindNextMatching(const EntryType &aPrevEntry, const NameType &aName) const
+    {
+        return FindMatchingFrom(FindNext(aPrevEntry), aName);
+    }
+
+private:
+    static EntryType *FindFrom(EntryType *aEntry, uint32_t aHash)
+    {
+        while ((aEntry != nullptr) && ((aEntry->*kLink).mHash != aHash))
+        {
+            aEntry = (aEntry->*kLink).mNext;
+        }
+
+        return aEntry;
+    }
+
+    template <typename NameType> EntryType *FindMatchingFrom(EntryType *aEntry, const NameType &aName) const
+    {
+        while ((aEntry != nullptr) && !aEntry->Matches(aName))
+        {
+            aEntry = FindNext(*aEntry);
+        }
+
+        return aEntry;
+    }
+
+    EntryType       *&GetBucket(uint32_t aHash) { return mBuckets[aHash % kNumBuckets]; }
+    EntryType *const &GetBucket(uint32_t aHash) const { return mBuckets[aHash % kNumBuckets]; }
+
+    EntryType *mBuckets[kNumBuckets];
+};
+
+} // namespace ot
+
+#endif // OT_CORE_COMMON_NAME_INDEX_HPP_
@@ -33,6 +33,9 @@
 
 #include "timer.hpp"
 
+#include "common/bit_utils.hpp"
+#include "common/clearable.hpp"
+#include "common/code_utils.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -152,6 +155,393 @@ void TimerMilli::RemoveAll(Instance &aInstance) { aInstance.Get<Scheduler>().Rem
 //---------------------------------------------------------------------------------------------------------------------
 // `Timer::Scheduler`
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
+Timer::Scheduler::Scheduler(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mBase(0)
+    , mNumWheelTimers(0)
+    , mEarliest(nullptr)
+{
+    ClearAllBytes(mLists);
+    ClearAllBytes(mSlotBitmaps);
+}
+
+void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+
+    Remove(aTimer, aAlarmApi);
+
+    AdvanceBase(now);
+    Insert(aTimer, now);
+
+    if ((mEarliest == nullptr) || IsBefore(aTimer, *mEarliest))
+    {
+        mEarliest = &aTimer;
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    VerifyOrExit(aTimer.IsRunning());
+
+    Unlink(aTimer);
+    aTimer.SetNext(&aTimer);
+
+    if (mEarliest == &aTimer)
+    {
+        mEarliest = FindEarliest();
+        SetAlarm(aAlarmApi);
+    }
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
+{
+    if (mEarliest == nullptr)
+    {
+        aAlarmApi.AlarmStop(&GetInstance());
+    }
+    else
+    {
+        Time     now(aAlarmApi.AlarmGetNow());
+        uint32_t remaining;
+
+        remaining = mEarliest->mFireTime.DetermineRemainingDurationFrom(now);
+
+        aAlarmApi.AlarmStartAt(&GetInstance(), now.GetValue(), remaining);
+    }
+}
+
+void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
+{
+    Timer *timer = mEarliest;
+
+    if (timer)
+    {
+        Time now(aAlarmApi.AlarmGetNow());
+
+        if (now >= timer->mFireTime)
+        {
+            AdvanceBase(now);
+            Remove(*timer, aAlarmApi); // `Remove()` will `SetAlarm` for next timer if there is any.
+            timer->Fired();
+            ExitNow();
+        }
+    }
+
+    SetAlarm(aAlarmApi);
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    for (Timer *&head : mLists)
+    {
+        while (head != nullptr)
+        {
+            Timer *timer = head;
+
+            head = head->mNext;
+            timer->SetNext(timer);
+        }
+    }
+
+    ClearAllBytes(mSlotBitmaps);
+    mNumWheelTimers = 0;
+    mEarliest       = nullptr;
+
+    SetAlarm(aAlarmApi);
+}
+
+bool Timer::Scheduler::IsBefore(const Timer &aFirstTimer, const Timer &aSecondTimer) const
+{
+    // Indicates whether the fire time of the first timer is strictly
+    // before the fire time of the second timer. Both timers MUST be
+    // in the wheel or in the overdue list.
+
+    bool     retval;
+    bool     isFirstOverdue = (aFirstTimer.mListIndex == kOverdueList);
+    uint32_t base           = GetBaseValue();
+
+    if (isFirstOverdue != (aSecondTimer.mListIndex == kOverdueList))
+    {
+        retval = isFirstOverdue;
+    }
+    else if (isFirstOverdue)
+    {
+        retval = (base - aFirstTimer.mFireTime.GetValue()) > (base - aSecondTimer.mFireTime.GetValue());
+    }
+    else
+    {
+        retval = (aFirstTimer.mFireTime.GetValue() - base) < (aSecondTimer.mFireTime.GetValue() - base);
+    }
+
+    return retval;
+}
+
+void Timer::Scheduler::AdvanceBase(Time aNow)
+{
+    // Moves `mBase` forward towards `aNow` but never past the
+    // earliest timer in the wheel. On each level, the slot which
+    // `mBase` now points to contains timers that share all digits
+    // down to that level with `mBase`, so they are cascaded down
+    // to lower levels. Going from the top level down ensures that
+    // cascaded timers landing in a lower level `mBase` slot are
+    // themselves cascaded further.
+
+    uint32_t offset = aNow.GetValue() - GetBaseValue();
+
+    if (mNumWheelTimers == 0)
+    {
+        mBase += offset;
+        ExitNow();
+    }
+
+    VerifyOrExit(mEarliest->mListIndex != kOverdueList);
+
+    offset = Min(offset, mEarliest->mFireTime.GetValue() - GetBaseValue());
+    VerifyOrExit(offset != 0);
+
+    mBase += offset;
+
+    for (uint8_t level = kNumLevels - 1; level > 0; level--)
+    {
+        uint8_t digit = GetDigit(mBase, level);
+        Timer  *head;
+
+        if (!GetBit(mSlotBitmaps[level], digit))
+        {
+            continue;
+        }
+
+        head = mLists[level * kNumSlots + digit];
+
+        mLists[level * kNumSlots + digit] = nullptr;
+        ClearBit(mSlotBitmaps[level], digit);
+
+        while (head != nullptr)
+        {
+            Timer *timer = head;
+
+            head = head->mNext;
+            mNumWheelTimers--;
+            PlaceInWheel(*timer);
+        }
+    }
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::Insert(Timer &aTimer, Time aNow)
+{
+    // Like `DoesFireBefore()`, a fire time before `aNow` is treated
+    // as being in the past. If it is also before `mBase`, the timer
+    // goes into the overdue list, otherwise into the wheel.
+
+    if ((aTimer.mFireTime < aNow) && ((aNow - aTimer.mFireTime) > (aNow.GetValue() - GetBaseValue())))
+    {
+        InsertOverdue(aTimer);
+    }
+    else
+    {
+        PlaceInWheel(aTimer);
+    }
+}
+
+void Timer::Scheduler::InsertOverdue(Timer &aTimer)
+{
+    // Overdue list is sorted by fire time. A new timer is added after
+    // all existing timers with the same fire time.
+
+    Timer *&head = mLists[kOverdueList];
+    Timer  *next = head;
+
+    aTimer.mListIndex = kOverdueList;
+
+    while ((next != nullptr) && !IsBefore(aTimer, *next))
+    {
+        next = next->mNext;
+    }
+
+    if (next == nullptr)
+    {
+        AppendToList(head, aTimer);
+    }
+    else
+    {
+        aTimer.mNext = next;
+        aTimer.mPrev = next->mPrev;
+
+        if (next == head)
+        {
+            head = &aTimer;
+        }
+        else
+        {
+            next->mPrev->mNext = &aTimer;
+        }
+
+        next->mPrev = &aTimer;
+    }
+}
+
+void Timer::Scheduler::PlaceInWheel(Timer &aTimer)
+{
+    // The fire time is converted to a 64-bit key relative to `mBase`
+    // so that wrapping of the 32-bit time value does not affect the
+    // placement. The level is the highest one where the key and
+    // `mBase` have different digits (capped at the top level).
+
+    uint64_t key   = mBase + (aTimer.mFireTime.GetValue() - GetBaseValue());
+    uint64_t diff  = (key ^ mBase) >> kSlotBits;
+    uint8_t  level = 0;
+    uint8_t  digit;
+
+    while ((diff != 0) && (level < kNumLevels - 1))
+    {
+        diff >>= kSlotBits;
+        level++;
+    }
+
+    digit             = GetDigit(key, level);
+    aTimer.mListIndex = level * kNumSlots + digit;
+
+    AppendToList(mLists[aTimer.mListIndex], aTimer);
+    SetBit(mSlotBitmaps[level], digit);
+    mNumWheelTimers++;
+}
+
+void Timer::Scheduler::Unlink(Timer &aTimer)
+{
+    Timer *&head = mLists[aTimer.mListIndex];
+
+    if (&aTimer == head)
+    {
+        head = aTimer.mNext;
+
+        if (head != nullptr)
+        {
+            head->mPrev = aTimer.mPrev;
+        }
+    }
+    else
+    {
+        aTimer.mPrev->mNext = aTimer.mNext;
+
+        if (aTimer.mNext != nullptr)
+        {
+            aTimer.mNext->mPrev = aTimer.mPrev;
+        }
+        else
+        {
+            head->mPrev = aTimer.mPrev;
+        }
+    }
+
+    VerifyOrExit(aTimer.mListIndex != kOverdueList);
+
+    mNumWheelTimers--;
+
+    if (head == nullptr)
+    {
+        ClearBit(mSlotBitmaps[aTimer.mListIndex / kNumSlots], static_cast<uint8_t>(aTimer.mListIndex % kNumSlots));
+    }
+
+exit:
+    return;
+}
+
+Timer *Timer::Scheduler::FindEarliest(void) const
+{
+    Timer *earliest = mLists[kOverdueList];
+
+    VerifyOrExit(earliest == nullptr);
+
+    for (uint8_t level = 0; level < kNumLevels; level++)
+    {
+        uint32_t bitmap = mSlotBitmaps[level];
+        uint8_t  start;
+        uint8_t  digit;
+
+        if (bitmap == 0)
+        {
+            continue;
+        }
+
+        // Rotate the bitmap so that bit zero corresponds to the
+        // `mBase` digit and find the first non-empty slot from it.
+
+        start = GetDigit(mBase, level);
+
+        if (start != 0)
+        {
+            bitmap = (bitmap >> start) | (bitmap << (kNumSlots - start));
+        }
+
+        for (digit = start; !(bitmap & 1); bitmap >>= 1)
+        {
+            digit++;
+        }
+
+        earliest = mLists[level * kNumSlots + (digit % kNumSlots)];
+
+        // All timers in a level zero slot have the same fire time.
+        // On higher levels, the earliest timer in the slot is found
+        // (on a tie the one added first is picked).
+
+        for (Timer *timer = earliest->mNext; (level != 0) && (timer != nullptr); timer = timer->mNext)
+        {
+            if (IsBefore(*timer, *earliest))
+            {
+                earliest = timer;
+            }
+        }
+
+        break;
+    }
+
+exit:
+    return earliest;
+}
+
+uint8_t Timer::Scheduler::GetDigit(uint64_t aValue, uint8_t aLevel) const
+{
+    return static_cast<uint8_t>((aValue >> (aLevel * kSlotBits)) & (kNumSlots - 1));
+}
+
+void Timer::Scheduler::AppendToList(Timer *&aHead, Timer &aTimer)
+{
+    // The lists are doubly linked to allow removal in constant time.
+    // `mPrev` of the head entry points to the tail entry, and `mNext`
+    // of the tail entry is `nullptr` (so `IsRunning()` stays valid).
+
+    if (aHead == nullptr)
+    {
+        aHead        = &aTimer;
+        aTimer.mPrev = &aTimer;
+    }
+    else
+    {
+        Timer *tail = aHead->mPrev;
+
+        tail->mNext  = &aTimer;
+        aTimer.mPrev = tail;
+        aHead->mPrev = &aTimer;
+    }
+
+    aTimer.mNext = nullptr;
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
 void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
@@ -251,6 +641,8 @@ void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
     SetAlarm(aAlarmApi);
 }
 
+#endif // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
 {
     VerifyOrExit(otInstanceIsInitialized(aInstance));
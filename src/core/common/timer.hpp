@@ -222,10 +222,14 @@ protected:
             uint32_t (*AlarmGetNow)(void);
         };
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        explicit Scheduler(Instance &aInstance);
+#else
         explicit Scheduler(Instance &aInstance)
             : InstanceLocator(aInstance)
         {
         }
+#endif
 
         void Add(Timer &aTimer, const AlarmApi &aAlarmApi);
         void Remove(Timer &aTimer, const AlarmApi &aAlarmApi);
@@ -233,7 +237,39 @@ protected:
         void ProcessTimers(const AlarmApi &aAlarmApi);
         void SetAlarm(const AlarmApi &aAlarmApi);
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        // The timing wheel has `kNumLevels` levels, each with
+        // `kNumSlots` slots. A slot on level `n` covers a time span
+        // of `kNumSlots ^ n` ticks. A running timer is placed on the
+        // lowest level where its fire time shares all higher digits
+        // with `mBase`. Timers whose fire time is before `mBase` are
+        // kept in a separate sorted overdue list.
+
+        static constexpr uint8_t  kSlotBits    = 5;
+        static constexpr uint8_t  kNumSlots    = (1U << kSlotBits);
+        static constexpr uint8_t  kNumLevels   = 7; // 7 * 5 = 35 bits, covering the 32-bit time range with carry.
+        static constexpr uint16_t kOverdueList = kNumLevels * kNumSlots;
+
+        bool     IsBefore(const Timer &aFirstTimer, const Timer &aSecondTimer) const;
+        void     AdvanceBase(Time aNow);
+        void     Insert(Timer &aTimer, Time aNow);
+        void     InsertOverdue(Timer &aTimer);
+        void     PlaceInWheel(Timer &aTimer);
+        void     Unlink(Timer &aTimer);
+        Timer   *FindEarliest(void) const;
+        uint8_t  GetDigit(uint64_t aValue, uint8_t aLevel) const;
+        uint32_t GetBaseValue(void) const { return static_cast<uint32_t>(mBase); }
+
+        static void AppendToList(Timer *&aHead, Timer &aTimer);
+
+        Timer   *mLists[kOverdueList + 1];
+        uint32_t mSlotBitmaps[kNumLevels];
+        uint64_t mBase;
+        uint16_t mNumWheelTimers;
+        Timer   *mEarliest;
+#else
         LinkedList<Timer> mTimerList;
+#endif
     };
 
     Timer(Instance &aInstance, Handler aHandler)
@@ -249,6 +285,10 @@ protected:
     Handler mHandler;
     Time    mFireTime;
     Timer  *mNext;
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+    Timer   *mPrev; // On the list head, points to the list tail.
+    uint16_t mListIndex;
+#endif
 };
 
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance);
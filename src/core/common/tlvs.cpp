@@ -117,16 +117,57 @@ exit:
     return error;
 }
 
+Error Tlv::Info::ParseFrom(MessageReader &aReader)
+{
+    // Parses the TLV at the current `aReader` position and advances
+    // the reader past the TLV header only.
+
+    Error    error;
+    Tlv      tlv;
+    uint16_t tlvOffset = aReader.GetOffset();
+    uint16_t headerSize;
+    uint16_t length;
+
+    SuccessOrExit(error = aReader.Read(tlv));
+
+    mType = tlv.GetType();
+
+    if (!tlv.IsExtended())
+    {
+        mIsExtended = false;
+        headerSize  = sizeof(Tlv);
+        length      = tlv.GetLength();
+    }
+    else
+    {
+        SuccessOrExit(error = aReader.Read(length));
+
+        mIsExtended = true;
+        headerSize  = sizeof(ExtendedTlv);
+        length      = BigEndian::HostSwap16(length);
+    }
+
+    VerifyOrExit(length <= aReader.GetRemainingLength(), error = kErrorParse);
+
+    mTlvOffsetRange.Init(tlvOffset, static_cast<uint16_t>(headerSize + length));
+    mValueOffsetRange.Init(static_cast<uint16_t>(tlvOffset + headerSize), length);
+
+exit:
+    return error;
+}
+
 Error Tlv::Info::FindIn(const Message &aMessage, uint8_t aType)
 {
-    Error       error = kErrorNotFound;
-    OffsetRange offsetRange;
+    // Walks the TLVs with a `MessageReader` so that moving from one
+    // TLV to the next does not search the message buffer chain from
+    // its head again.
 
-    offsetRange.InitFromMessageOffsetToEnd(aMessage);
+    Error         error = kErrorNotFound;
+    MessageReader reader(aMessage);
 
     while (true)
     {
-        SuccessOrExit(ParseFrom(aMessage, offsetRange));
+        SuccessOrExit(ParseFrom(reader));
 
         if (mType == aType)
         {
@@ -134,7 +175,7 @@ Error Tlv::Info::FindIn(const Message &aMessage, uint8_t aType)
             ExitNow();
         }
 
-        offsetRange.AdvanceOffset(mTlvOffsetRange.GetLength());
+        SuccessOrExit(reader.Skip(GetLength()));
     }
 
 exit:
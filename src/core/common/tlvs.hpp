@@ -49,6 +49,7 @@
 namespace ot {
 
 class Message;
+class MessageReader;
 
 /**
  * Implements TLV generation and parsing.
@@ -430,6 +431,7 @@ public:
         }
 
     private:
+        Error ParseFrom(MessageReader &aReader);
         template <typename UintType> Error ReadUintValue(const Message &aMessage, UintType &aValue) const;
         Error ReadStringValue(const Message &aMessage, uint8_t aMaxStringLength, char *aValue) const;
 
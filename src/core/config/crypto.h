@@ -81,6 +81,20 @@
 #define OPENTHREAD_CONFIG_CRYPTO_PLATFORM_CCM_ONE_SHOT_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CRYPTO_AES_HW_ACCEL_ENABLE
+ *
+ * Define to 1 to let the bundled mbedTLS use CPU AES instructions (AES-NI on x86-64, ARMv8 crypto extension on
+ * AArch64 when the compiler targets it).
+ *
+ * Only applicable with OPENTHREAD_CONFIG_CRYPTO_LIB_MBEDTLS or OPENTHREAD_CONFIG_CRYPTO_LIB_PSA using the bundled
+ * mbedTLS configuration. AES-NI support is detected at run time, falling back to the software implementation.
+ * Disabled by default since the accelerated mbedTLS modules depend on the mbedTLS version and toolchain in use.
+ */
+#ifndef OPENTHREAD_CONFIG_CRYPTO_AES_HW_ACCEL_ENABLE
+#define OPENTHREAD_CONFIG_CRYPTO_AES_HW_ACCEL_ENABLE 0
+#endif
+
 #if OPENTHREAD_CONFIG_CRYPTO_LIB == OPENTHREAD_CONFIG_CRYPTO_LIB_PLATFORM
 
 /**
@@ -151,6 +151,19 @@
 #define OPENTHREAD_CONFIG_MULTICAST_DNS_MOCK_PLAT_APIS_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MULTICAST_DNS_NAME_INDEX_SIZE
+ *
+ * Specifies the number of hash buckets used by the mDNS module to index registered host and service entries by name
+ * and by service type.
+ *
+ * The indexes let received questions and records be matched against registered entries without scanning all of
+ * them. Each index uses one pointer per bucket.
+ */
+#ifndef OPENTHREAD_CONFIG_MULTICAST_DNS_NAME_INDEX_SIZE
+#define OPENTHREAD_CONFIG_MULTICAST_DNS_NAME_INDEX_SIZE 32
+#endif
+
 /**
  * @}
  */
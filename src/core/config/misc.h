@@ -113,6 +113,20 @@
 #define OPENTHREAD_CONFIG_DETERMINISTIC_ECDSA_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+ *
+ * Define to 1 to use a hierarchical timing wheel in `TimerMilli` and `TimerMicro` schedulers.
+ *
+ * By default the timer schedulers keep the running timers in a sorted linked list, so starting or re-starting a timer
+ * requires a linear walk of the list. The timing wheel makes start and stop constant time at the cost of extra RAM
+ * for the wheel slots (per scheduler) and two additional fields in every `Timer`. It is intended for devices running
+ * a large number of timers concurrently (e.g., a Border Router).
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_UPTIME_ENABLE
  *
@@ -179,6 +193,72 @@
 #define OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+ *
+ * Define to 1 to enable the compiled route table in Leader Network Data.
+ *
+ * When enabled, the external route and default route entries in the Network Data are compiled into a table each time
+ * the Network Data changes, so that route lookups for forwarded off-mesh traffic do not need to parse the Network
+ * Data TLVs.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_PREFIXES
+ *
+ * Specifies the maximum number of prefixes in the compiled Network Data route table.
+ *
+ * If the Network Data contains more prefixes with route entries, route lookups fall back to parsing the Network Data
+ * TLVs.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_PREFIXES
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_PREFIXES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_ENTRIES
+ *
+ * Specifies the maximum number of route entries (across all prefixes) in the compiled Network Data route table.
+ *
+ * If the Network Data contains more route entries, route lookups fall back to parsing the Network Data TLVs.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_ENTRIES 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+ *
+ * Define to 1 to enable the compiled 6LoWPAN context table in Leader Network Data.
+ *
+ * When enabled, the 6LoWPAN contexts in the Network Data are compiled into a table each time the Network Data changes,
+ * so that finding the context for an address (on compression) or for a Context ID (on decompression) does not need to
+ * parse the Network Data TLVs.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CRC_TABLE_SLICES
+ *
+ * Selects the algorithm used by `CrcCalculator` (CRC16/CRC32 computations).
+ *
+ * - 0: Bit-wise computation (no tables).
+ * - 1: Table-driven computation, one byte per lookup.
+ * - 4 or 8: Slice-by-4 or slice-by-8 table-driven computation, processing four or eight bytes per iteration.
+ *
+ * The tables are generated at compile time for the CRC16-CCITT, CRC16-ANSI, and CRC32-ANSI polynomials and are placed
+ * in read-only memory, taking `256 * slices` CRC-sized entries per polynomial (e.g., 8 KB for slice-by-8 CRC32). CRC
+ * computations using other polynomials fall back to the bit-wise algorithm.
+ */
+#ifndef OPENTHREAD_CONFIG_CRC_TABLE_SLICES
+#define OPENTHREAD_CONFIG_CRC_TABLE_SLICES 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
  *
@@ -217,6 +297,53 @@
 #define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE (sizeof(void *) * 32)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+ *
+ * The number of large message buffers in the buffer pool.
+ *
+ * Large buffers are an additional buffer size class (of `OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE` bytes) used to
+ * hold the data of large messages (e.g., reassembled IPv6 datagrams) in fewer buffers. The first buffer of a message
+ * is always a regular buffer. A large buffer is used when a message grows by at least the data size of a large buffer
+ * minus the data size of a regular buffer, so that at most a regular buffer worth of space is left unused. If no large
+ * buffer is available, regular buffers are used instead. A large buffer is counted as one buffer in the message
+ * buffer stats (free, total, and maximum used).
+ *
+ * Applicable only when the OT internal message pool is used, i.e., when `OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE`
+ * and `OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT` are not set. Set to zero to disable large buffers.
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS
+#define OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE
+ *
+ * The size of a large message buffer in bytes.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS` is non-zero. MUST be larger than twice
+ * `OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE`.
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_MESSAGE_LARGE_BUFFER_SIZE (OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE * 4)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_CHUNK_CURSOR_ENABLE
+ *
+ * Define to 1 to cache the last visited buffer in each message.
+ *
+ * When enabled, an access at a message offset past the first buffer (read, write, compare) resumes the walk of the
+ * buffer chain from the last visited buffer when possible, instead of always starting from the head. This speeds up
+ * parsing of large messages spanning many buffers using small reads at increasing offsets.
+ *
+ * The cursor is kept in the message metadata which reduces the data capacity of the first buffer by the size of a
+ * pointer and a `uint16_t` (plus padding).
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_CHUNK_CURSOR_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_CHUNK_CURSOR_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER
  *
@@ -111,6 +111,56 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_SERVICE_UPDATE_TIMEOUT ((4 * 250u) + 250u)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+ *
+ * Specifies the number of hash buckets used by SRP server to index registered hosts by their full name and services
+ * by their instance name.
+ *
+ * The indexes are used to find an existing host and to check for name conflicts when processing an SRP update.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+ *
+ * Define to 1 to enable asynchronous verification of SRP update signatures.
+ *
+ * When enabled, a received SRP update is parsed and then queued, and its SIG(0) signature is verified later from a
+ * tasklet. At most `OPENTHREAD_CONFIG_SRP_SERVER_VERIFY_BATCH_SIZE` signatures are verified per tasklet run, so that a
+ * burst of SRP updates (e.g., all clients re-registering after a Border Router reboot) does not block other tasks for
+ * the duration of all the ECDSA verifications.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_VERIFY_BATCH_SIZE
+ *
+ * Specifies the maximum number of SRP update signatures verified per tasklet run.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_VERIFY_BATCH_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_VERIFY_BATCH_SIZE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_VERIFIED_SIGNATURE_CACHE_SIZE
+ *
+ * Specifies the number of recently verified SRP update signatures remembered by SRP server.
+ *
+ * Each entry records the digest of a signed message together with its signature and the host key which verified it,
+ * so that a retransmission of the same SRP update does not require another ECDSA verification. Set to zero to disable
+ * the cache.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_VERIFIED_SIGNATURE_CACHE_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_VERIFIED_SIGNATURE_CACHE_SIZE 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
  *
@@ -59,6 +59,19 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+ *
+ * Define as 1 to maintain a hash index (keyed on the IID) over the EID-to-RLOC cache entries.
+ *
+ * The index allows the cache to be searched for an EID without walking the cache entry lists, which is useful when a
+ * large number of entries is used (e.g., on a Border Router). It uses `2 * OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES`
+ * additional `uint16_t` slots.
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES
  *
@@ -337,20 +337,30 @@ void AesCcm::Engine::Start(const Config &aConfig)
 void AesCcm::Engine::AddHeader(const void *aHeader, uint32_t aHeaderLength)
 {
     const uint8_t *headerBytes = reinterpret_cast<const uint8_t *>(aHeader);
+    uint32_t       offset      = 0;
 
     OT_ASSERT((aHeaderLength == 0) || aHeader != nullptr);
     OT_ASSERT(mHeaderCur + aHeaderLength <= mHeaderLength);
 
-    // process header
-    for (unsigned i = 0; i < aHeaderLength; i++)
+    // Process the header in segments up to the next block boundary,
+    // so that full blocks are absorbed into the CBC-MAC at once.
+
+    while (offset < aHeaderLength)
     {
+        uint16_t length;
+
         if (mBlockLength == sizeof(mBlock))
         {
             mEcb.Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
-        mBlock[mBlockLength++] ^= headerBytes[i];
+        length = static_cast<uint16_t>(Min<uint32_t>(aHeaderLength - offset, sizeof(mBlock) - mBlockLength));
+
+        XorBytes(&mBlock[mBlockLength], &headerBytes[offset], length);
+
+        mBlockLength += length;
+        offset += length;
     }
 
     mHeaderCur += aHeaderLength;
@@ -371,52 +381,92 @@ void AesCcm::Engine::AddPayload(void *aPlainText, void *aCipherText, uint32_t aL
 {
     uint8_t *plaintextBytes  = reinterpret_cast<uint8_t *>(aPlainText);
     uint8_t *ciphertextBytes = reinterpret_cast<uint8_t *>(aCipherText);
-    uint8_t  byte;
+    uint32_t offset          = 0;
 
     OT_ASSERT(mPlainTextCur + aLength <= mPlainTextLength);
 
-    for (unsigned i = 0; i < aLength; i++)
+    // The CTR key stream and the CBC-MAC block stay aligned over the
+    // payload (both start at payload offset zero). The payload is
+    // processed in segments up to the next block boundary, so a
+    // full block is handled by a single pass per segment instead of
+    // re-checking the block state for every byte. This also keeps
+    // partial blocks working when the payload is fed in arbitrary
+    // pieces (e.g., when walking `Message` chunks).
+
+    while (offset < aLength)
     {
-        if (mCtrLength == 16)
-        {
-            for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
-            {
-                if (++mCtr[j])
-                {
-                    break;
-                }
-            }
+        uint16_t length;
+        uint8_t *pad;
+        uint8_t *block;
 
+        if (mCtrLength == sizeof(mCtrPad))
+        {
+            IncrementCounter();
             mEcb.Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
+        if (mBlockLength == sizeof(mBlock))
+        {
+            mEcb.Encrypt(mBlock, mBlock);
+            mBlockLength = 0;
+        }
+
+        OT_ASSERT(mCtrLength == mBlockLength);
+
+        length = static_cast<uint16_t>(Min<uint32_t>(aLength - offset, sizeof(mCtrPad) - mCtrLength));
+        pad    = &mCtrPad[mCtrLength];
+        block  = &mBlock[mBlockLength];
+
         if (aOperation == kEncrypt)
         {
-            byte = plaintextBytes[i];
+            const uint8_t *input = &plaintextBytes[offset];
 
             if (ciphertextBytes != nullptr)
             {
-                ciphertextBytes[i] = byte ^ mCtrPad[mCtrLength++];
+                uint8_t *output = &ciphertextBytes[offset];
+
+                for (uint16_t i = 0; i < length; i++)
+                {
+                    uint8_t byte = input[i];
+
+                    output[i] = byte ^ pad[i];
+                    block[i] ^= byte;
+                }
+            }
+            else
+            {
+                XorBytes(block, input, length);
             }
         }
         else
         {
-            byte = ciphertextBytes[i] ^ mCtrPad[mCtrLength++];
+            const uint8_t *input = &ciphertextBytes[offset];
 
             if (plaintextBytes != nullptr)
             {
-                plaintextBytes[i] = byte;
-            }
-        }
+                uint8_t *output = &plaintextBytes[offset];
 
-        if (mBlockLength == sizeof(mBlock))
-        {
-            mEcb.Encrypt(mBlock, mBlock);
-            mBlockLength = 0;
+                for (uint16_t i = 0; i < length; i++)
+                {
+                    uint8_t byte = input[i] ^ pad[i];
+
+                    output[i] = byte;
+                    block[i] ^= byte;
+                }
+            }
+            else
+            {
+                for (uint16_t i = 0; i < length; i++)
+                {
+                    block[i] ^= input[i] ^ pad[i];
+                }
+            }
         }
 
-        mBlock[mBlockLength++] ^= byte;
+        mCtrLength += length;
+        mBlockLength += length;
+        offset += length;
     }
 
     mPlainTextCur += aLength;
@@ -433,6 +483,25 @@ void AesCcm::Engine::AddPayload(void *aPlainText, void *aCipherText, uint32_t aL
     }
 }
 
+void AesCcm::Engine::IncrementCounter(void)
+{
+    for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
+    {
+        if (++mCtr[j])
+        {
+            break;
+        }
+    }
+}
+
+void AesCcm::Engine::XorBytes(uint8_t *aBlock, const uint8_t *aBytes, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aBlock[i] ^= aBytes[i];
+    }
+}
+
 void AesCcm::Engine::Finalize(void *aTag)
 {
     uint8_t *tagBytes = reinterpret_cast<uint8_t *>(aTag);
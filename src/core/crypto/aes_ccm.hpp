@@ -266,6 +266,9 @@ private:
         void Finalize(void *aTag);
 
     private:
+        void        IncrementCounter(void);
+        static void XorBytes(uint8_t *aBlock, const uint8_t *aBytes, uint16_t aLength);
+
         AesEcb   mEcb;
         uint8_t  mBlock[AesEcb::kBlockSize];
         uint8_t  mCtr[AesEcb::kBlockSize];
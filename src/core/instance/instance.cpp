@@ -564,6 +564,17 @@ void Instance::GetBufferInfo(BufferInfo &aInfo)
     aInfo.mFreeBuffers    = Get<MessagePool>().GetFreeBufferCount();
     aInfo.mMaxUsedBuffers = Get<MessagePool>().GetMaxUsedBufferCount();
 
+    aInfo.mMaxUsedBuffersAge = TimerMilli::GetNow() - Get<MessagePool>().GetMaxUsedBufferTime();
+    aInfo.mNumAllocFailures  = Get<MessagePool>().GetAllocFailureCount();
+
+    aInfo.mIp6Messages          = Get<MessagePool>().GetTypeBufferInfo(Message::kTypeIp6);
+    aInfo.m6loMessages          = Get<MessagePool>().GetTypeBufferInfo(Message::kType6lowpan);
+    aInfo.mSupervisionMessages  = Get<MessagePool>().GetTypeBufferInfo(Message::kTypeSupervision);
+    aInfo.mMacEmptyDataMessages = Get<MessagePool>().GetTypeBufferInfo(Message::kTypeMacEmptyData);
+    aInfo.mIp4Messages          = Get<MessagePool>().GetTypeBufferInfo(Message::kTypeIp4);
+    aInfo.mBleMessages          = Get<MessagePool>().GetTypeBufferInfo(Message::kTypeBle);
+    aInfo.mOtherMessages        = Get<MessagePool>().GetTypeBufferInfo(Message::kTypeOther);
+
     Get<MeshForwarder>().GetQueueInfo(aInfo.m6loSendQueue, aInfo.m6loReassemblyQueue);
     Get<Ip6::Ip6>().GetSendQueueInfo(aInfo.mIp6Queue);
 
@@ -584,7 +595,7 @@ void Instance::GetBufferInfo(BufferInfo &aInfo)
 #endif
 }
 
-void Instance::ResetBufferInfo(void) { Get<MessagePool>().ResetMaxUsedBufferCount(); }
+void Instance::ResetBufferInfo(void) { Get<MessagePool>().ResetBufferStats(); }
 
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 
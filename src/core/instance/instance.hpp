@@ -468,10 +468,10 @@ public:
     void GetBufferInfo(BufferInfo &aInfo);
 
     /**
-     * Resets the Message Buffer information counter tracking maximum number buffers in use at the same
-     * time.
+     * Resets the Message Buffer information counters tracking maximum number buffers in use at the same
+     * time and failed buffer allocations.
      *
-     * Resets `mMaxUsedBuffers` in `BufferInfo`.
+     * Resets `mMaxUsedBuffers` and `mNumAllocFailures` in `BufferInfo` (including the per message type ones).
      */
     void ResetBufferInfo(void);
 
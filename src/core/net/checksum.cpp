@@ -74,24 +74,76 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // The one's complement sum of 16-bit words can be computed by
+    // adding wider big-endian words and folding the carries back,
+    // since 2^16 is 1 modulo 0xffff. We add 32-bit words to a 64-bit
+    // accumulator, which cannot overflow for a `uint16_t` length.
+
+    uint64_t sum;
+
+    if (mAtOddIndex && (aLength > 0))
+    {
+        AddUint8(*aBuffer++);
+        aLength--;
+    }
+
+    sum = mValue;
+
+    for (; aLength >= 2 * sizeof(uint32_t); aLength -= 2 * sizeof(uint32_t), aBuffer += 2 * sizeof(uint32_t))
     {
-        AddUint8(aBuffer[i]);
+        sum += BigEndian::ReadUint32(aBuffer);
+        sum += BigEndian::ReadUint32(aBuffer + sizeof(uint32_t));
+    }
+
+    if (aLength >= sizeof(uint32_t))
+    {
+        sum += BigEndian::ReadUint32(aBuffer);
+        aBuffer += sizeof(uint32_t);
+        aLength -= sizeof(uint32_t);
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    mValue = static_cast<uint16_t>(sum);
+
+    while (aLength-- > 0)
+    {
+        AddUint8(*aBuffer++);
     }
 }
 
-void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
+void Checksum::AddData(const Message &aMessage, const OffsetRange &aOffsetRange)
 {
-    uint16_t checksum = GetValue();
+    // Chunks can have odd lengths, `AddData()` tracks whether the
+    // next byte is at an odd index in the checksum data.
+
+    uint16_t       length = aOffsetRange.GetLength();
+    Message::Chunk chunk;
 
-    if (checksum != 0xffff)
+    aMessage.GetFirstChunk(aOffsetRange.GetOffset(), length, chunk);
+
+    while (chunk.GetLength() > 0)
     {
-        checksum = static_cast<uint16_t>(~checksum);
+        AddData(chunk.GetBytes(), chunk.GetLength());
+        aMessage.GetNextChunk(length, chunk);
     }
+}
 
-    checksum = BigEndian::HostSwap16(checksum);
+uint16_t Checksum::ToFieldValue(uint16_t aSum)
+{
+    // The checksum field is the one's complement of the sum. A sum
+    // of 0xffff is written as 0xffff (instead of zero) since a zero
+    // UDP checksum indicates that no checksum was computed.
 
-    aMessage.Write(aOffset, checksum);
+    return (aSum == 0xffff) ? aSum : static_cast<uint16_t>(~aSum);
+}
+
+void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
+{
+    aMessage.Write(aOffset, BigEndian::HostSwap16(ToFieldValue(GetValue())));
 }
 
 void Checksum::Calculate(const Ip6::Address &aSource,
@@ -99,25 +151,20 @@ void Checksum::Calculate(const Ip6::Address &aSource,
                          uint8_t             aIpProto,
                          const Message      &aMessage)
 {
-    Message::Chunk chunk;
-    uint16_t       length = aMessage.DetermineLengthAfterOffset();
+    OffsetRange offsetRange;
+
+    offsetRange.InitFromMessageOffsetToEnd(aMessage);
 
     // Pseudo-header for checksum calculation (RFC-2460).
 
     AddData(aSource.GetBytes(), sizeof(Ip6::Address));
     AddData(aDestination.GetBytes(), sizeof(Ip6::Address));
-    AddUint16(length);
+    AddUint16(offsetRange.GetLength());
     AddUint16(static_cast<uint16_t>(aIpProto));
 
     // Add message content (from offset to the end) to checksum.
 
-    aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
-
-    while (chunk.GetLength() > 0)
-    {
-        AddData(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(length, chunk);
-    }
+    AddData(aMessage, offsetRange);
 }
 
 void Checksum::Calculate(const Ip4::Address &aSource,
@@ -125,8 +172,9 @@ void Checksum::Calculate(const Ip4::Address &aSource,
                          uint8_t             aIpProto,
                          const Message      &aMessage)
 {
-    Message::Chunk chunk;
-    uint16_t       length = aMessage.DetermineLengthAfterOffset();
+    OffsetRange offsetRange;
+
+    offsetRange.InitFromMessageOffsetToEnd(aMessage);
 
     // Pseudo-header for checksum calculation (RFC-768/792/793).
     // Note: ICMP checksum won't count the pseudo header like TCP and UDP.
@@ -135,18 +183,12 @@ void Checksum::Calculate(const Ip4::Address &aSource,
         AddData(aSource.GetBytes(), sizeof(Ip4::Address));
         AddData(aDestination.GetBytes(), sizeof(Ip4::Address));
         AddUint16(static_cast<uint16_t>(aIpProto));
-        AddUint16(length);
+        AddUint16(offsetRange.GetLength());
     }
 
     // Add message content (from offset to the end) to checksum.
 
-    aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
-
-    while (chunk.GetLength() > 0)
-    {
-        AddData(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(length, chunk);
-    }
+    AddData(aMessage, offsetRange);
 }
 
 Error Checksum::VerifyMessageChecksum(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo, uint8_t aIpProto)
@@ -244,4 +286,33 @@ void Checksum::UpdateIp4HeaderChecksum(Ip4::Header &aHeader)
     aHeader.SetChecksum(static_cast<uint16_t>(~checksum.GetValue()));
 }
 
+uint16_t Checksum::AdjustChecksum(uint16_t    aChecksum,
+                                  const void *aOldData,
+                                  uint16_t    aOldLength,
+                                  const void *aNewData,
+                                  uint16_t    aNewLength)
+{
+    // RFC 1624 (Eqn. 3): HC' = ~(~HC + ~m + m'). The sum of the old
+    // data is removed by adding its one's complement.
+
+    Checksum oldData;
+    Checksum checksum;
+
+    oldData.AddData(reinterpret_cast<const uint8_t *>(aOldData), aOldLength);
+
+    checksum.mValue = static_cast<uint16_t>(~aChecksum);
+    checksum.AddUint16(static_cast<uint16_t>(~oldData.GetValue()));
+    checksum.AddData(reinterpret_cast<const uint8_t *>(aNewData), aNewLength);
+
+    return ToFieldValue(checksum.GetValue());
+}
+
+uint16_t Checksum::AdjustChecksum(uint16_t aChecksum, uint16_t aOldValue, uint16_t aNewValue)
+{
+    uint16_t oldValue = BigEndian::HostSwap16(aOldValue);
+    uint16_t newValue = BigEndian::HostSwap16(aNewValue);
+
+    return AdjustChecksum(aChecksum, &oldValue, sizeof(oldValue), &newValue, sizeof(newValue));
+}
+
 } // namespace ot
@@ -104,6 +104,56 @@ public:
      */
     static void UpdateIp4HeaderChecksum(Ip4::Header &aHeader);
 
+    /**
+     * Incrementally updates a checksum field value when some of the data covered by it is replaced (RFC 1624).
+     *
+     * The old and new data MUST each have an even length and start at an even offset within the covered data. Their
+     * lengths can differ, e.g., when an IPv6 pseudo-header address is replaced by an IPv4 one during NAT64
+     * translation.
+     *
+     * @param[in] aChecksum    The current checksum field value.
+     * @param[in] aOldData     A pointer to the data being removed.
+     * @param[in] aOldLength   The number of bytes in @p aOldData.
+     * @param[in] aNewData     A pointer to the data being added.
+     * @param[in] aNewLength   The number of bytes in @p aNewData.
+     *
+     * @returns The updated checksum field value.
+     */
+    static uint16_t AdjustChecksum(uint16_t    aChecksum,
+                                   const void *aOldData,
+                                   uint16_t    aOldLength,
+                                   const void *aNewData,
+                                   uint16_t    aNewLength);
+
+    /**
+     * Incrementally updates a checksum field value when an object covered by it is replaced (RFC 1624).
+     *
+     * @tparam OldType   The old object type (MUST have an even size).
+     * @tparam NewType   The new object type (MUST have an even size).
+     *
+     * @param[in] aChecksum   The current checksum field value.
+     * @param[in] aOld        The object being removed.
+     * @param[in] aNew        The object being added.
+     *
+     * @returns The updated checksum field value.
+     */
+    template <typename OldType, typename NewType>
+    static uint16_t AdjustChecksum(uint16_t aChecksum, const OldType &aOld, const NewType &aNew)
+    {
+        return AdjustChecksum(aChecksum, &aOld, sizeof(OldType), &aNew, sizeof(NewType));
+    }
+
+    /**
+     * Incrementally updates a checksum field value when a 16-bit field covered by it changes (RFC 1624).
+     *
+     * @param[in] aChecksum   The current checksum field value.
+     * @param[in] aOldValue   The old value of the 16-bit field.
+     * @param[in] aNewValue   The new value of the 16-bit field.
+     *
+     * @returns The updated checksum field value.
+     */
+    static uint16_t AdjustChecksum(uint16_t aChecksum, uint16_t aOldValue, uint16_t aNewValue);
+
 private:
     Checksum(void)
         : mValue(0)
@@ -115,6 +165,7 @@ private:
     void     AddUint8(uint8_t aUint8);
     void     AddUint16(uint16_t aUint16);
     void     AddData(const uint8_t *aBuffer, uint16_t aLength);
+    void     AddData(const Message &aMessage, const OffsetRange &aOffsetRange);
     void     WriteToMessage(uint16_t aOffset, Message &aMessage) const;
     void     Calculate(const Ip6::Address &aSource,
                        const Ip6::Address &aDestination,
@@ -125,6 +176,8 @@ private:
                        uint8_t             aIpProto,
                        const Message      &aMessage);
 
+    static uint16_t ToFieldValue(uint16_t aSum);
+
     static constexpr uint16_t kValidRxChecksum = 0xffff;
 
     uint16_t mValue;
@@ -154,6 +154,9 @@ Error Core::SetEnabled(bool aEnable, uint32_t aInfraIfIndex, Requester aRequeste
         mHostEntries.Clear();
         mServiceEntries.Clear();
         mServiceTypes.Clear();
+        mHostNameIndex.Clear();
+        mServiceNameIndex.Clear();
+        mServiceTypeIndex.Clear();
         mMultiPacketRxMessages.Clear();
         mTxMessageHistory.Clear();
         mEntryTimer.Stop();
@@ -274,6 +277,7 @@ Error Core::Register(const ItemInfo &aItemInfo, RequestId aRequestId, RegisterCa
         entry = EntryType::AllocateAndInit(GetInstance(), aItemInfo);
         OT_ASSERT(entry != nullptr);
         GetEntryList<EntryType>().Push(*entry);
+        AddToIndex(*entry);
     }
 
     entry->Register(aItemInfo, Callback(aRequestId, aCallback));
@@ -547,8 +551,65 @@ void Core::HandleEntryTimer(void)
     mEntryTimer.FireAtIfEarlier(context.mNextFireTime);
 }
 
+template <typename EntryType, typename IndexType>
+EntryType *Core::FindEntry(OwningList<EntryType> &aList, const IndexType &aIndex, const Name &aName)
+{
+    // Finds the entry in `aList` matching `aName` using its name
+    // index `aIndex`. If the name hash cannot be determined (e.g.,
+    // `aName` is not from a message), the whole list is searched.
+
+    EntryType *entry;
+    uint32_t   hash;
+
+    if (NameHash::Calculate(aName, hash) != kErrorNone)
+    {
+        ExitNow(entry = aList.FindMatching(aName));
+    }
+
+    entry = aIndex.FindMatching(hash, aName);
+
+exit:
+    return entry;
+}
+
+void Core::AddToIndex(HostEntry &aEntry)
+{
+    mHostNameIndex.Add(aEntry, NameHash::Calculate(/* aFirstLabel */ nullptr, aEntry.mName.AsCString()));
+}
+
+void Core::AddToIndex(ServiceEntry &aEntry)
+{
+    mServiceNameIndex.Add(aEntry,
+                          NameHash::Calculate(aEntry.mServiceInstance.AsCString(), aEntry.mServiceType.AsCString()));
+    mServiceTypeIndex.Add(aEntry, NameHash::Calculate(/* aFirstLabel */ nullptr, aEntry.mServiceType.AsCString()));
+}
+
+void Core::RemoveFromIndex(HostEntry &aEntry) { mHostNameIndex.Remove(aEntry); }
+
+void Core::RemoveFromIndex(ServiceEntry &aEntry)
+{
+    mServiceNameIndex.Remove(aEntry);
+    mServiceTypeIndex.Remove(aEntry);
+}
+
 void Core::RemoveEmptyEntries(void)
 {
+    for (HostEntry &entry : mHostEntries)
+    {
+        if (entry.Matches(Entry::kRemoving))
+        {
+            RemoveFromIndex(entry);
+        }
+    }
+
+    for (ServiceEntry &entry : mServiceEntries)
+    {
+        if (entry.Matches(Entry::kRemoving))
+        {
+            RemoveFromIndex(entry);
+        }
+    }
+
     mHostEntries.RemoveAndFreeAllMatching(Entry::kRemoving);
     mServiceEntries.RemoveAndFreeAllMatching(Entry::kRemoving);
 }
@@ -1725,6 +1786,92 @@ void Core::Entry::RecordAndTypeArray::Add(RecordInfo &aRecord, uint16_t aType)
     entry->mType   = aType;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Core::NameHash
+
+void Core::NameHash::AddLabel(const char *aLabel, uint8_t aLength)
+{
+    AddByte(aLength);
+    AddChars(aLabel, aLength);
+}
+
+void Core::NameHash::AddLabels(const char *aLabels)
+{
+    // Adds dot-separated labels from `aLabels`, ignoring an empty
+    // label after a trailing dot (e.g., "local.").
+
+    while (*aLabels != kNullChar)
+    {
+        const char *end = StringFind(aLabels, Name::kLabelSeparatorChar);
+
+        if (end == nullptr)
+        {
+            end = aLabels + StringLength(aLabels, Name::kMaxLabelSize);
+        }
+
+        AddLabel(aLabels, static_cast<uint8_t>(end - aLabels));
+
+        aLabels = (*end == kNullChar) ? end : end + 1;
+    }
+}
+
+uint32_t Core::NameHash::Calculate(const char *aFirstLabel, const char *aLabels)
+{
+    // Calculates the hash of the name `<aFirstLabel>.<aLabels>.local.`
+    // with `aFirstLabel` (if not `nullptr`) as a single label (which
+    // can contain dot characters).
+
+    NameHash hash;
+
+    if (aFirstLabel != nullptr)
+    {
+        hash.AddLabel(aFirstLabel, static_cast<uint8_t>(StringLength(aFirstLabel, Name::kMaxLabelSize)));
+    }
+
+    hash.AddLabels(aLabels);
+    hash.AddLabels(kLocalDomain);
+
+    return hash.GetValue();
+}
+
+Error Core::NameHash::Calculate(const Name &aName, uint32_t &aHash)
+{
+    // Calculates the hash of a name from a message, reading its
+    // labels one by one. Returns `kErrorInvalidArgs` if `aName` is
+    // not from a message, or error if the name cannot be parsed.
+
+    Error          error = kErrorNone;
+    NameHash       hash;
+    const Message *message;
+    uint16_t       offset;
+
+    VerifyOrExit(aName.IsFromMessage(), error = kErrorInvalidArgs);
+
+    message = &aName.GetAsMessage(offset);
+
+    while (true)
+    {
+        Name::LabelBuffer label;
+        uint8_t           labelLength = sizeof(label);
+
+        error = Name::ReadLabel(*message, offset, label, labelLength);
+
+        if (error == kErrorNotFound)
+        {
+            error = kErrorNone;
+            break;
+        }
+
+        SuccessOrExit(error);
+        hash.AddLabel(label, labelLength);
+    }
+
+    aHash = hash.GetValue();
+
+exit:
+    return error;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Core::LocalHost
 
@@ -4375,11 +4522,11 @@ void Core::RxMessage::ProcessQuestion(Question &aQuestion)
 
     // Check if question name matches a `HostEntry` or a `ServiceEntry`.
 
-    aQuestion.mEntry = Get<Core>().mHostEntries.FindMatching(name);
+    aQuestion.mEntry = FindEntry(Get<Core>().mHostEntries, Get<Core>().mHostNameIndex, name);
 
     if (aQuestion.mEntry == nullptr)
     {
-        aQuestion.mEntry        = Get<Core>().mServiceEntries.FindMatching(name);
+        aQuestion.mEntry        = FindEntry(Get<Core>().mServiceEntries, Get<Core>().mServiceNameIndex, name);
         aQuestion.mIsForService = (aQuestion.mEntry != nullptr);
     }
 
@@ -4415,9 +4562,11 @@ void Core::RxMessage::ProcessQuestion(Question &aQuestion)
         // the first match. `AnswerServiceTypeQuestion()` will start
         // from the saved entry and finds all the other matches.
 
-        bool              isSubType;
-        Name::LabelBuffer subLabel;
-        Name              baseType;
+        const ServiceTypeIndex &typeIndex = Get<Core>().mServiceTypeIndex;
+        bool                    isSubType;
+        Name::LabelBuffer       subLabel;
+        Name                    baseType;
+        uint32_t                typeHash;
 
         VerifyOrExit(QuestionMatches(aQuestion.mRrType, ResourceRecord::kTypePtr));
 
@@ -4428,20 +4577,23 @@ void Core::RxMessage::ProcessQuestion(Question &aQuestion)
             baseType = name;
         }
 
-        for (ServiceEntry &serviceEntry : Get<Core>().mServiceEntries)
+        SuccessOrExit(NameHash::Calculate(baseType, typeHash));
+
+        for (ServiceEntry *serviceEntry = typeIndex.FindFirst(typeHash); serviceEntry != nullptr;
+             serviceEntry               = typeIndex.FindNext(*serviceEntry))
         {
-            if ((serviceEntry.GetState() != Entry::kRegistered) || !serviceEntry.MatchesServiceType(baseType))
+            if ((serviceEntry->GetState() != Entry::kRegistered) || !serviceEntry->MatchesServiceType(baseType))
             {
                 continue;
             }
 
-            if (isSubType && !serviceEntry.CanAnswerSubType(subLabel))
+            if (isSubType && !serviceEntry->CanAnswerSubType(subLabel))
             {
                 continue;
             }
 
             aQuestion.mCanAnswer     = true;
-            aQuestion.mEntry         = &serviceEntry;
+            aQuestion.mEntry         = serviceEntry;
             aQuestion.mIsForService  = true;
             aQuestion.mIsServiceType = true;
             ExitNow();
@@ -4518,7 +4670,11 @@ void Core::RxMessage::AnswerServiceTypeQuestion(const Question   &aQuestion,
         subLabel = nullptr;
     }
 
-    for (ServiceEntry *serviceEntry = &aFirstEntry; serviceEntry != nullptr; serviceEntry = serviceEntry->GetNext())
+    // Iterate over the entries with the same service type hash
+    // (using `mServiceTypeIndex`) starting from `aFirstEntry`.
+
+    for (ServiceEntry *serviceEntry = &aFirstEntry; serviceEntry != nullptr;
+         serviceEntry               = Get<Core>().mServiceTypeIndex.FindNext(*serviceEntry))
     {
         bool shouldSuppress = false;
 
@@ -4812,14 +4968,14 @@ void Core::RxMessage::ProcessRecordForConflict(const Name &aName, const Resource
 
     VerifyOrExit(aRecord.GetTtl() > 0);
 
-    hostEntry = Get<Core>().mHostEntries.FindMatching(aName);
+    hostEntry = FindEntry(Get<Core>().mHostEntries, Get<Core>().mHostNameIndex, aName);
 
     if (hostEntry != nullptr)
     {
         hostEntry->HandleConflict();
     }
 
-    serviceEntry = Get<Core>().mServiceEntries.FindMatching(aName);
+    serviceEntry = FindEntry(Get<Core>().mServiceEntries, Get<Core>().mServiceNameIndex, aName);
 
     if (serviceEntry != nullptr)
     {
@@ -47,6 +47,7 @@
 #include "common/heap_string.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
+#include "common/name_index.hpp"
 #include "common/owned_ptr.hpp"
 #include "common/owning_list.hpp"
 #include "common/timer.hpp"
@@ -1232,6 +1233,21 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+    class NameHash : public ot::NameHash
+    {
+        // Calculates a case-insensitive hash over the labels of a
+        // name. Used to index entries by name.
+
+    public:
+        void AddLabel(const char *aLabel, uint8_t aLength);
+        void AddLabels(const char *aLabels);
+
+        static uint32_t Calculate(const char *aFirstLabel, const char *aLabels);
+        static Error    Calculate(const Name &aName, uint32_t &aHash);
+    };
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
     void HandleLocalHostEventTimer(void) { mLocalHost.HandleEventTimer(); }
 
     class LocalHost : public InstanceLocator
@@ -1278,6 +1294,7 @@ private:
 
     class HostEntry : public Entry, public LinkedListEntry<HostEntry>, public Heap::Allocatable<HostEntry>
     {
+        friend class Core;
         friend class LinkedListEntry<HostEntry>;
         friend class Entry;
         friend class ServiceEntry;
@@ -1339,17 +1356,19 @@ private:
 
         static void AppendEntryName(Entry &aEntry, TxMessage &aTxMessage, Section aSection);
 
-        HostEntry           *mNext;
-        Heap::String         mName;
-        AddrRecord           mIp6AddrRecord;
-        OwnedPtr<AddrRecord> mIp4AddrRecord;
-        uint16_t             mNameOffset;
+        HostEntry               *mNext;
+        NameIndexLink<HostEntry> mNameLink;
+        Heap::String             mName;
+        AddrRecord               mIp6AddrRecord;
+        OwnedPtr<AddrRecord>     mIp4AddrRecord;
+        uint16_t                 mNameOffset;
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
     class ServiceEntry : public Entry, public LinkedListEntry<ServiceEntry>, public Heap::Allocatable<ServiceEntry>
     {
+        friend class Core;
         friend class LinkedListEntry<ServiceEntry>;
         friend class Entry;
         friend class ServiceType;
@@ -1423,23 +1442,25 @@ private:
 
         static const uint8_t kEmptyTxtData[];
 
-        ServiceEntry       *mNext;
-        Heap::String        mServiceInstance;
-        Heap::String        mServiceType;
-        RecordInfo          mPtrRecord;
-        RecordInfo          mSrvRecord;
-        RecordInfo          mTxtRecord;
-        OwningList<SubType> mSubTypes;
-        Heap::String        mHostName;
-        Heap::Data          mTxtData;
-        uint16_t            mPriority;
-        uint16_t            mWeight;
-        uint16_t            mPort;
-        uint16_t            mServiceNameOffset;
-        uint16_t            mServiceTypeOffset;
-        uint16_t            mSubServiceTypeOffset;
-        uint16_t            mHostNameOffset;
-        bool                mIsAddedInServiceTypes;
+        ServiceEntry               *mNext;
+        NameIndexLink<ServiceEntry> mNameLink;
+        NameIndexLink<ServiceEntry> mTypeLink;
+        Heap::String                mServiceInstance;
+        Heap::String                mServiceType;
+        RecordInfo                  mPtrRecord;
+        RecordInfo                  mSrvRecord;
+        RecordInfo                  mTxtRecord;
+        OwningList<SubType>         mSubTypes;
+        Heap::String                mHostName;
+        Heap::Data                  mTxtData;
+        uint16_t                    mPriority;
+        uint16_t                    mWeight;
+        uint16_t                    mPort;
+        uint16_t                    mServiceNameOffset;
+        uint16_t                    mServiceTypeOffset;
+        uint16_t                    mSubServiceTypeOffset;
+        uint16_t                    mHostNameOffset;
+        bool                        mIsAddedInServiceTypes;
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -2327,6 +2348,12 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+    static constexpr uint16_t kNameIndexSize = OPENTHREAD_CONFIG_MULTICAST_DNS_NAME_INDEX_SIZE;
+
+    typedef NameIndex<HostEntry, &HostEntry::mNameLink, kNameIndexSize>       HostNameIndex;
+    typedef NameIndex<ServiceEntry, &ServiceEntry::mNameLink, kNameIndexSize> ServiceNameIndex;
+    typedef NameIndex<ServiceEntry, &ServiceEntry::mTypeLink, kNameIndexSize> ServiceTypeIndex;
+
     template <typename EntryType> OwningList<EntryType> &GetEntryList(void);
     template <typename EntryType, typename ItemInfo>
     Error Register(const ItemInfo &aItemInfo, RequestId aRequestId, RegisterCallback aCallback);
@@ -2357,12 +2384,19 @@ private:
     void      AddPassiveIp6AddrCache(const char *aHostName);
     TimeMilli RandomizeFirstProbeTxTime(void);
     TimeMilli RandomizeInitialQueryTxTime(void);
+    void      AddToIndex(HostEntry &aEntry);
+    void      AddToIndex(ServiceEntry &aEntry);
+    void      RemoveFromIndex(HostEntry &aEntry);
+    void      RemoveFromIndex(ServiceEntry &aEntry);
     void      RemoveEmptyEntries(void);
     void      HandleEntryTimer(void);
     void      HandleEntryTask(void);
     void      HandleCacheTimer(void);
     void      HandleCacheTask(void);
 
+    template <typename EntryType, typename IndexType>
+    static EntryType *FindEntry(OwningList<EntryType> &aList, const IndexType &aIndex, const Name &aName);
+
     static bool     IsKeyForService(const Key &aKey) { return aKey.mServiceType != nullptr; }
     static uint32_t DetermineTtl(uint32_t aTtl, uint32_t aDefaultTtl);
     static bool     NameMatch(const Heap::String &aHeapString, const char *aName);
@@ -2400,6 +2434,9 @@ private:
     OwningList<HostEntry>    mHostEntries;
     OwningList<ServiceEntry> mServiceEntries;
     OwningList<ServiceType>  mServiceTypes;
+    HostNameIndex            mHostNameIndex;
+    ServiceNameIndex         mServiceNameIndex;
+    ServiceTypeIndex         mServiceTypeIndex;
     MultiPacketRxMessages    mMultiPacketRxMessages;
     TimeMilli                mNextProbeTxTime;
     EntryTimer               mEntryTimer;
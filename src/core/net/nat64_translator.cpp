@@ -107,12 +107,22 @@ uint16_t Translator::GetDestinationPortOrIcmp4Id(const Ip4::Headers &aIp4Headers
     return aIp4Headers.IsIcmp4() ? aIp4Headers.GetIcmpHeader().GetId() : aIp4Headers.GetDestinationPort();
 }
 
+void Translator::WriteUdpOrTcpChecksum(Message &aMessage, bool aIsUdp, uint16_t aChecksum)
+{
+    // The UDP/TCP header is at offset 0 after the IP header is removed.
+
+    uint16_t offset = aIsUdp ? Ip6::UdpHeader::kChecksumFieldOffset : Ip6::TcpHeader::kChecksumFieldOffset;
+
+    aMessage.Write(offset, BigEndian::HostSwap16(aChecksum));
+}
+
 Error Translator::TranslateIp6ToIp4(Message &aMessage)
 {
     Error        error      = kErrorNone;
     DropReason   dropReason = kReasonUnknown;
     Ip6::Headers ip6Headers;
     Ip4::Header  ip4Header;
+    uint16_t     origSrcPort;
     uint16_t     srcPortOrId = 0;
     Mapping     *mapping     = nullptr;
 
@@ -155,6 +165,8 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
     srcPortOrId = GetSourcePortOrIcmp6Id(ip6Headers);
 #endif
 
+    origSrcPort = ip6Headers.GetSourcePort();
+
     aMessage.RemoveHeader(sizeof(Ip6::Header));
 
     ip4Header.Clear();
@@ -189,8 +201,25 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
     // TODO: Implement the logic for replying ICMP messages.
     ip4Header.SetTotalLength(sizeof(Ip4::Header) + aMessage.DetermineLengthAfterOffset());
 
-    Checksum::UpdateMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
-                                    ip4Header.GetProtocol());
+    if (ip6Headers.IsIcmp6())
+    {
+        Checksum::UpdateMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
+                                        ip4Header.GetProtocol());
+    }
+    else
+    {
+        // The UDP/TCP payload is unchanged, so the checksum is updated
+        // incrementally for the new pseudo-header addresses and the
+        // translated source port.
+
+        uint16_t checksum = ip6Headers.GetChecksum();
+
+        checksum = Checksum::AdjustChecksum(checksum, ip6Headers.GetSourceAddress(), ip4Header.GetSource());
+        checksum = Checksum::AdjustChecksum(checksum, ip6Headers.GetDestinationAddress(), ip4Header.GetDestination());
+        checksum = Checksum::AdjustChecksum(checksum, origSrcPort, srcPortOrId);
+        WriteUdpOrTcpChecksum(aMessage, ip6Headers.IsUdp(), checksum);
+    }
+
     Checksum::UpdateIp4HeaderChecksum(ip4Header);
 
     if (aMessage.Prepend(ip4Header) != kErrorNone)
@@ -221,6 +250,7 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
     DropReason   dropReason = kReasonUnknown;
     Ip6::Header  ip6Header;
     Ip4::Headers ip4Headers;
+    uint16_t     origDstPort;
     uint16_t     dstPortOrId = 0;
     Mapping     *mapping     = nullptr;
 
@@ -249,6 +279,8 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
     dstPortOrId = GetDestinationPortOrIcmp4Id(ip4Headers);
 #endif
 
+    origDstPort = ip4Headers.GetDestinationPort();
+
     aMessage.RemoveHeader(ip4Headers.GetIp4Header().GetHeaderLength());
 
     ip6Header.Clear();
@@ -287,8 +319,23 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
     // TODO: Implement the logic for replying ICMP datagrams.
     ip6Header.SetPayloadLength(aMessage.DetermineLengthAfterOffset());
 
-    Checksum::UpdateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
-                                    ip6Header.GetNextHeader());
+    // A zero UDP checksum in IPv4 indicates that no checksum was
+    // computed, so it cannot be updated incrementally.
+
+    if (ip4Headers.IsIcmp4() || (ip4Headers.IsUdp() && (ip4Headers.GetChecksum() == 0)))
+    {
+        Checksum::UpdateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
+                                        ip6Header.GetNextHeader());
+    }
+    else
+    {
+        uint16_t checksum = ip4Headers.GetChecksum();
+
+        checksum = Checksum::AdjustChecksum(checksum, ip4Headers.GetSourceAddress(), ip6Header.GetSource());
+        checksum = Checksum::AdjustChecksum(checksum, ip4Headers.GetDestinationAddress(), ip6Header.GetDestination());
+        checksum = Checksum::AdjustChecksum(checksum, origDstPort, dstPortOrId);
+        WriteUdpOrTcpChecksum(aMessage, ip4Headers.IsUdp(), checksum);
+    }
 
     if (aMessage.Prepend(ip6Header) != kErrorNone)
     {
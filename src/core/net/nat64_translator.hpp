@@ -361,6 +361,7 @@ private:
 
     static uint16_t GetSourcePortOrIcmp6Id(const Ip6::Headers &aIp6Headers);
     static uint16_t GetDestinationPortOrIcmp4Id(const Ip4::Headers &aIp4Headers);
+    static void     WriteUdpOrTcpChecksum(Message &aMessage, bool aIsUdp, uint16_t aChecksum);
 
     using TranslatorTimer = TimerMilliIn<Translator, &Translator::HandleTimer>;
 
@@ -80,6 +80,9 @@ Server::Server(Instance &aInstance)
     , mLeaseTimer(aInstance)
     , mOutstandingUpdatesTimer(aInstance)
     , mCompletedUpdateTask(aInstance)
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+    , mVerifyTask(aInstance)
+#endif
     , mServiceUpdateId(Random::NonCrypto::Generate<uint32_t>())
     , mPort(kUninitializedPort)
     , mState(kStateDisabled)
@@ -93,6 +96,7 @@ Server::Server(Instance &aInstance)
     , mFastStartMode(false)
 #endif
 {
+    mSignatureVerifyCounters.Clear();
     IgnoreError(SetDomain(kDefaultDomain));
 }
 
@@ -464,7 +468,7 @@ void Server::RemoveHost(Host *aHost, RetainName aRetainName)
     else
     {
         aHost->SetKeyLease(0);
-        IgnoreError(mHosts.Remove(*aHost));
+        UnlinkHost(*aHost);
         LogInfo("Fully remove host %s", aHost->GetFullName());
     }
 
@@ -496,30 +500,69 @@ exit:
     return;
 }
 
+Server::Host *Server::FindHost(const char *aFullName)
+{
+    return mHostIndex.FindMatching(NameHash::Calculate(aFullName), aFullName);
+}
+
+void Server::AddHost(Host &aHost)
+{
+    // Adds a committed `aHost` to `mHosts`, the name indexes, and
+    // `mLeaseQueue`. The caller must ensure `mLeaseQueue.Reserve()`
+    // succeeded before.
+
+    mHosts.Push(aHost);
+    mHostIndex.Add(aHost, NameHash::Calculate(aHost.GetFullName()));
+
+    for (Service &service : aHost.mServices)
+    {
+        mServiceIndex.Add(service, NameHash::Calculate(service.GetInstanceName()));
+    }
+
+    mLeaseQueue.Add(aHost);
+    mLeaseTimer.FireAtIfEarlier(aHost.mLeaseEventTime);
+}
+
+void Server::UnlinkHost(Host &aHost)
+{
+    IgnoreError(mHosts.Remove(aHost));
+    mHostIndex.Remove(aHost);
+
+    for (Service &service : aHost.mServices)
+    {
+        mServiceIndex.Remove(service);
+    }
+
+    mLeaseQueue.Remove(aHost);
+}
+
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool        hasConflicts = false;
-    const Host *existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const char *hostName     = aHost.GetFullName();
+    const Host *existingHost = mHostIndex.FindMatching(NameHash::Calculate(hostName), hostName);
 
     if ((existingHost != nullptr) && (aHost.mKey != existingHost->mKey))
     {
-        LogWarn("Name conflict: host name %s has already been allocated", aHost.GetFullName());
+        LogWarn("Name conflict: host name %s has already been allocated", hostName);
         ExitNow(hasConflicts = true);
     }
 
-    for (const Host &host : mHosts)
+    // Verify that no allocated services of other hosts have the
+    // same instance name.
+
+    for (const Service &service : aHost.mServices)
     {
-        if (aHost.mKey == host.mKey)
-        {
-            continue;
-        }
+        const char    *instanceName = service.GetInstanceName();
+        const Service *existingService;
 
-        // Verify that no allocated services have the same instance name.
-        for (const Service &service : aHost.mServices)
+        for (existingService = mServiceIndex.FindMatching(NameHash::Calculate(instanceName), instanceName);
+             existingService != nullptr;
+             existingService = mServiceIndex.FindNextMatching(*existingService, instanceName))
         {
-            if (host.HasService(service.GetInstanceName()))
+            if (aHost.mKey != existingService->mHost->mKey)
             {
-                LogWarn("Name conflict: service name %s has already been allocated", service.GetInstanceName());
+                LogWarn("Name conflict: service name %s has already been allocated", instanceName);
                 ExitNow(hasConflicts = true);
             }
         }
@@ -605,6 +648,12 @@ void Server::CommitSrpUpdate(Error                    aError,
     uint32_t grantedKeyLease = 0;
     bool     useShortLease   = aHost.ShouldUseShortLeaseOption();
 
+    if ((aError == kErrorNone) && (mState == kStateRunning))
+    {
+        // Ensure `mLeaseQueue` can track `aHost` before committing it.
+        aError = mLeaseQueue.Reserve();
+    }
+
     if (aError != kErrorNone || (mState != kStateRunning))
     {
         aHost.Free();
@@ -617,7 +666,12 @@ void Server::CommitSrpUpdate(Error                    aError,
     grantedKeyLease = useShortLease ? grantedLease : aLeaseConfig.GrantKeyLease(hostKeyLease);
     grantedTtl      = aTtlConfig.GrantTtl(grantedLease, aHost.GetTtl());
 
-    existingHost = mHosts.RemoveMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
+
+    if (existingHost != nullptr)
+    {
+        UnlinkHost(*existingHost);
+    }
 
     LogInfo("Committing update for %s host %s", (existingHost != nullptr) ? "existing" : "new", aHost.GetFullName());
     LogInfo("    Granted lease:%lu, key-lease:%lu, ttl:%lu", ToUlong(grantedLease), ToUlong(grantedKeyLease),
@@ -638,8 +692,6 @@ void Server::CommitSrpUpdate(Error                    aError,
         ExitNow();
     }
 
-    mHosts.Push(aHost);
-
     for (Service &service : aHost.mServices)
     {
         service.SetLease(service.mIsDeleted ? 0 : grantedLease);
@@ -719,10 +771,7 @@ void Server::CommitSrpUpdate(Error                    aError,
     }
 #endif
 
-    if (!aHost.IsDeleted())
-    {
-        mLeaseTimer.FireAtIfEarlier(Min(aHost.GetExpireTime(), aHost.GetKeyExpireTime()));
-    }
+    AddHost(aHost);
 
 exit:
     if (aMessageInfo != nullptr)
@@ -899,6 +948,17 @@ void Server::Stop(void)
         mOutstandingUpdates.Pop()->Free();
     }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+    while (!mPendingVerifications.IsEmpty())
+    {
+        PendingVerification *pending = mPendingVerifications.Pop();
+
+        pending->GetHost().Free();
+        pending->Free();
+    }
+#endif
+
+    mLeaseQueue.Free();
     mLeaseTimer.Stop();
     mOutstandingUpdatesTimer.Stop();
 
@@ -928,9 +988,9 @@ void Server::HandleNetDataPublisherEvent(NetworkData::Publisher::Event aEvent)
     }
 }
 
-const Server::UpdateMetadata *Server::FindOutstandingUpdate(const MessageMetadata &aMessageMetadata) const
+bool Server::HasOutstandingUpdate(const MessageMetadata &aMessageMetadata) const
 {
-    const UpdateMetadata *ret = nullptr;
+    bool has = false;
 
     VerifyOrExit(aMessageMetadata.IsDirectRxFromClient());
 
@@ -939,12 +999,16 @@ const Server::UpdateMetadata *Server::FindOutstandingUpdate(const MessageMetadat
         if (aMessageMetadata.mDnsHeader.GetMessageId() == update.GetDnsHeader().GetMessageId() &&
             aMessageMetadata.mMessageInfo->HasSamePeerAddrAndPort(update.GetMessageInfo()))
         {
-            ExitNow(ret = &update);
+            ExitNow(has = true);
         }
     }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+    has = mPendingVerifications.ContainsMatching(aMessageMetadata);
+#endif
+
 exit:
-    return ret;
+    return has;
 }
 
 void Server::ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata)
@@ -958,7 +1022,7 @@ void Server::ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata)
 
     SuccessOrExit(error = ProcessZoneSection(aMessage, aMetadata));
 
-    if (FindOutstandingUpdate(aMetadata) != nullptr)
+    if (HasOutstandingUpdate(aMetadata))
     {
         LogInfo("Drop duplicated SRP update request: MessageId=%u", aMetadata.mDnsHeader.GetMessageId());
 
@@ -975,17 +1039,17 @@ void Server::ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata)
     VerifyOrExit(host != nullptr, error = kErrorNoBufs);
     SuccessOrExit(error = ProcessUpdateSection(*host, aMessage, aMetadata));
 
-    // Parse lease time and validate signature.
+    // Parse lease time and read signature.
     SuccessOrExit(error = ProcessAdditionalSection(host, aMessage, aMetadata));
 
-#if OPENTHREAD_FTD
-    if (aMetadata.IsDirectRxFromClient())
-    {
-        UpdateAddrResolverCacheTable(*aMetadata.mMessageInfo, *host);
-    }
-#endif
-
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+    // The signature is verified later from `mVerifyTask` which then
+    // continues processing the update by calling `HandleUpdate()`.
+    error = QueueVerification(*host, aMetadata);
+#else
+    SuccessOrExit(error = VerifySignature(host->mKey, aMetadata));
     HandleUpdate(*host, aMetadata);
+#endif
 
 exit:
     if (error != kErrorNone)
@@ -1436,8 +1500,8 @@ Error Server::ProcessAdditionalSection(Host *aHost, const Message &aMessage, Mes
     VerifyOrExit(sigRecord.GetTypeCovered() == 0, error = kErrorFailed);
     VerifyOrExit(signatureLength == Crypto::Ecdsa::P256::Signature::kSize, error = kErrorParse);
 
-    SuccessOrExit(error = VerifySignature(aHost->mKey, aMessage, aMetadata.mDnsHeader, sigOffset, sigRdataOffset,
-                                          sigRecord.GetLength(), signerName));
+    SuccessOrExit(error = ReadSignature(aMessage, aMetadata.mDnsHeader, sigOffset, sigRdataOffset,
+                                        sigRecord.GetLength(), signerName, aMetadata));
 
     aMetadata.mOffset = offset;
 
@@ -1446,21 +1510,21 @@ exit:
     return error;
 }
 
-Error Server::VerifySignature(const Host::Key  &aKey,
-                              const Message    &aMessage,
-                              Dns::UpdateHeader aDnsHeader,
-                              uint16_t          aSigOffset,
-                              uint16_t          aSigRdataOffset,
-                              uint16_t          aSigRdataLength,
-                              const char       *aSignerName) const
+Error Server::ReadSignature(const Message    &aMessage,
+                            Dns::UpdateHeader aDnsHeader,
+                            uint16_t          aSigOffset,
+                            uint16_t          aSigRdataOffset,
+                            uint16_t          aSigRdataLength,
+                            const char       *aSignerName,
+                            MessageMetadata  &aMetadata) const
 {
-    Error                          error;
-    uint16_t                       offset = aMessage.GetOffset();
-    uint16_t                       signatureOffset;
-    Crypto::Sha256                 sha256;
-    Crypto::Sha256::Hash           hash;
-    Crypto::Ecdsa::P256::Signature signature;
-    Message                       *signerNameMessage = nullptr;
+    Error          error;
+    uint16_t       offset = aMessage.GetOffset();
+    uint16_t       signatureOffset;
+    Crypto::Sha256 sha256;
+    Message       *signerNameMessage = nullptr;
+
+    aMetadata.mVerifyStartTime = TimerMilli::GetNow();
 
     VerifyOrExit(aSigRdataLength >= Crypto::Ecdsa::P256::Signature::kSize, error = kErrorInvalidArgs);
 
@@ -1481,31 +1545,142 @@ Error Server::VerifySignature(const Host::Key  &aKey,
     sha256.Update(aDnsHeader);
     sha256.Update(aMessage, offset + sizeof(aDnsHeader), aSigOffset - offset - sizeof(aDnsHeader));
 
-    sha256.Finish(hash);
+    sha256.Finish(aMetadata.mSignedHash);
 
     signatureOffset = aSigRdataOffset + aSigRdataLength - Crypto::Ecdsa::P256::Signature::kSize;
-    SuccessOrExit(error = aMessage.Read(signatureOffset, signature));
+    SuccessOrExit(error = aMessage.Read(signatureOffset, aMetadata.mSignature));
+
+exit:
+    LogWarnOnError(error, "read message signature");
+    FreeMessage(signerNameMessage);
+    return error;
+}
+
+Error Server::VerifySignature(const Host::Key &aKey, const MessageMetadata &aMetadata)
+{
+    Error    error;
+    uint32_t latency;
+#if OPENTHREAD_CONFIG_SRP_SERVER_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+    Crypto::Sha256       sha256;
+    Crypto::Sha256::Hash fingerprint;
+
+    sha256.Start();
+    sha256.Update(aMetadata.mSignedHash);
+    sha256.Update(aMetadata.mSignature);
+    sha256.Update(aKey);
+    sha256.Finish(fingerprint);
 
-    error = aKey.Verify(hash, signature);
+    if (mVerifiedSignatures.Contains(fingerprint))
+    {
+        mSignatureVerifyCounters.mNumCacheHits++;
+        ExitNow(error = kErrorNone);
+    }
+#endif
+
+    error = aKey.Verify(aMetadata.mSignedHash, aMetadata.mSignature);
+
+    if (error == kErrorNone)
+    {
+        mSignatureVerifyCounters.mNumVerified++;
+#if OPENTHREAD_CONFIG_SRP_SERVER_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+        mVerifiedSignatures.Add(fingerprint);
+#endif
+    }
+    else
+    {
+        mSignatureVerifyCounters.mNumFailed++;
+    }
 
 exit:
+    latency = TimerMilli::GetNow() - aMetadata.mVerifyStartTime;
+    mSignatureVerifyCounters.mTotalLatency += latency;
+    mSignatureVerifyCounters.mMaxLatency = Max(mSignatureVerifyCounters.mMaxLatency, latency);
+
+    LogInfo("Signature verify %s, latency:%lu msec", ErrorToString(error), ToUlong(latency));
     LogWarnOnError(error, "verify message signature");
-    FreeMessage(signerNameMessage);
     return error;
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+
+Error Server::QueueVerification(Host &aHost, const MessageMetadata &aMetadata)
+{
+    Error                error   = kErrorNone;
+    PendingVerification *pending = PendingVerification::Allocate(aHost, aMetadata);
+
+    VerifyOrExit(pending != nullptr, error = kErrorNoBufs);
+
+    mPendingVerifications.PushAfterTail(*pending);
+    mVerifyTask.Post();
+
+exit:
+    return error;
+}
+
+void Server::ProcessPendingVerifications(void)
+{
+    // Verify at most `kVerifyBatchSize` signatures per run so that
+    // other tasks can run in between when a burst of SRP updates is
+    // received.
+
+    for (uint16_t count = 0; count < kVerifyBatchSize; count++)
+    {
+        PendingVerification *pending = mPendingVerifications.Pop();
+        Error                error;
+
+        VerifyOrExit(pending != nullptr);
+
+        error = VerifySignature(pending->GetHost().mKey, pending->GetMessageMetadata());
+
+        if (error == kErrorNone)
+        {
+            HandleUpdate(pending->GetHost(), pending->GetMessageMetadata());
+        }
+        else
+        {
+            const MessageMetadata &metadata = pending->GetMessageMetadata();
+
+            pending->GetHost().Free();
+
+            if (metadata.IsDirectRxFromClient())
+            {
+                SendResponse(metadata.mDnsHeader, ErrorToDnsResponseCode(error), *metadata.mMessageInfo);
+            }
+        }
+
+        pending->Free();
+    }
+
+    if (!mPendingVerifications.IsEmpty())
+    {
+        mVerifyTask.Post();
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+
 void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
 {
     Error error = kErrorNone;
     Host *existingHost;
 
+#if OPENTHREAD_FTD
+    if (aMetadata.IsDirectRxFromClient())
+    {
+        UpdateAddrResolverCacheTable(*aMetadata.mMessageInfo, aHost);
+    }
+#endif
+
     // Check whether the SRP update wants to remove `aHost`.
 
     VerifyOrExit(aHost.GetLease() == 0);
 
     aHost.ClearResources();
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     // The client may not include all services it has registered before
@@ -1751,102 +1926,96 @@ exit:
 
 void Server::HandleLeaseTimer(void)
 {
-    NextFireTime nextExpireTime;
-    Host        *nextHost;
+    TimeMilli now = TimerMilli::GetNow();
+    Host     *host;
 
-    for (Host *host = mHosts.GetHead(); host != nullptr; host = nextHost)
-    {
-        nextHost = host->GetNext();
+    // Process hosts in `mLeaseQueue` in order of their earliest
+    // lease or key lease expiration time. `HandleLeaseExpiration()`
+    // either fully removes the host or updates its position in the
+    // queue based on its next expiration time.
 
-        if (host->GetKeyExpireTime() <= nextExpireTime.GetNow())
-        {
-            LogInfo("KEY LEASE of host %s expired", host->GetFullName());
+    while (((host = mLeaseQueue.GetTop()) != nullptr) && (host->mLeaseEventTime <= now))
+    {
+        HandleLeaseExpiration(*host, now);
+    }
 
-            // Removes the whole host and all services if the KEY RR expired.
-            RemoveHost(host, kDeleteName);
-        }
-        else if (host->IsDeleted())
-        {
-            // The host has been deleted, but the hostname & service instance names retain.
+    if (host != nullptr)
+    {
+        mLeaseTimer.FireAt(host->mLeaseEventTime);
+    }
+}
 
-            Service *next;
+void Server::HandleLeaseExpiration(Host &aHost, TimeMilli aNow)
+{
+    Service *next;
 
-            nextExpireTime.UpdateIfEarlier(host->GetKeyExpireTime());
+    if (aHost.GetKeyExpireTime() <= aNow)
+    {
+        LogInfo("KEY LEASE of host %s expired", aHost.GetFullName());
 
-            // Check if any service instance name expired.
-            for (Service *service = host->mServices.GetHead(); service != nullptr; service = next)
-            {
-                next = service->GetNext();
+        // Removes the whole host and all services if the KEY RR expired.
+        RemoveHost(&aHost, kDeleteName);
+        ExitNow();
+    }
 
-                OT_ASSERT(service->mIsDeleted);
+    if (aHost.IsDeleted())
+    {
+        // The host has been deleted, but the hostname & service instance names retain.
 
-                if (service->GetKeyExpireTime() <= nextExpireTime.GetNow())
-                {
-                    service->Log(Service::kKeyLeaseExpired);
-                    host->RemoveService(service, kDeleteName, kNotifyServiceHandler);
-                }
-                else
-                {
-                    nextExpireTime.UpdateIfEarlier(service->GetKeyExpireTime());
-                }
-            }
-        }
-        else if (host->GetExpireTime() <= nextExpireTime.GetNow())
+        // Check if any service instance name expired.
+        for (Service *service = aHost.mServices.GetHead(); service != nullptr; service = next)
         {
-            LogInfo("LEASE of host %s expired", host->GetFullName());
+            next = service->GetNext();
 
-            // If the host expired, delete all resources of this host and its services.
-            for (Service &service : host->mServices)
+            OT_ASSERT(service->mIsDeleted);
+
+            if (service->GetKeyExpireTime() <= aNow)
             {
-                // Don't need to notify the service handler as `RemoveHost` at below will do.
-                host->RemoveService(&service, kRetainName, kDoNotNotifyServiceHandler);
+                service->Log(Service::kKeyLeaseExpired);
+                aHost.RemoveService(service, kDeleteName, kNotifyServiceHandler);
             }
-
-            RemoveHost(host, kRetainName);
-
-            nextExpireTime.UpdateIfEarlier(host->GetKeyExpireTime());
         }
-        else
-        {
-            // The host doesn't expire, check if any service expired or is explicitly removed.
+    }
+    else if (aHost.GetExpireTime() <= aNow)
+    {
+        LogInfo("LEASE of host %s expired", aHost.GetFullName());
 
-            Service *next;
+        // If the host expired, delete all resources of this host and its services.
+        for (Service &service : aHost.mServices)
+        {
+            // Don't need to notify the service handler as `RemoveHost` at below will do.
+            aHost.RemoveService(&service, kRetainName, kDoNotNotifyServiceHandler);
+        }
 
-            OT_ASSERT(!host->IsDeleted());
+        RemoveHost(&aHost, kRetainName);
+    }
+    else
+    {
+        // The host doesn't expire, check if any service expired or is explicitly removed.
 
-            nextExpireTime.UpdateIfEarlier(host->GetExpireTime());
+        for (Service *service = aHost.mServices.GetHead(); service != nullptr; service = next)
+        {
+            next = service->GetNext();
 
-            for (Service *service = host->mServices.GetHead(); service != nullptr; service = next)
+            if (service->GetKeyExpireTime() <= aNow)
             {
-                next = service->GetNext();
-
-                if (service->GetKeyExpireTime() <= nextExpireTime.GetNow())
-                {
-                    service->Log(Service::kKeyLeaseExpired);
-                    host->RemoveService(service, kDeleteName, kNotifyServiceHandler);
-                }
-                else if (service->mIsDeleted)
-                {
-                    // The service has been deleted but the name retains.
-                    nextExpireTime.UpdateIfEarlier(service->GetKeyExpireTime());
-                }
-                else if (service->GetExpireTime() <= nextExpireTime.GetNow())
-                {
-                    service->Log(Service::kLeaseExpired);
+                service->Log(Service::kKeyLeaseExpired);
+                aHost.RemoveService(service, kDeleteName, kNotifyServiceHandler);
+            }
+            else if (!service->mIsDeleted && (service->GetExpireTime() <= aNow))
+            {
+                service->Log(Service::kLeaseExpired);
 
-                    // The service is expired, delete it.
-                    host->RemoveService(service, kRetainName, kNotifyServiceHandler);
-                    nextExpireTime.UpdateIfEarlier(service->GetKeyExpireTime());
-                }
-                else
-                {
-                    nextExpireTime.UpdateIfEarlier(service->GetExpireTime());
-                }
+                // The service is expired, delete it.
+                aHost.RemoveService(service, kRetainName, kNotifyServiceHandler);
             }
         }
     }
 
-    mLeaseTimer.FireAtIfEarlier(nextExpireTime);
+    mLeaseQueue.Update(aHost);
+
+exit:
+    return;
 }
 
 void Server::HandleOutstandingUpdatesTimer(void)
@@ -2003,6 +2172,7 @@ Error Server::Service::Init(const char *aInstanceName, const char *aInstanceLabe
     mPort        = 0;
     mIsDeleted   = false;
     mIsCommitted = false;
+    mNameLink.Init();
 #if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
     mIsRegistered      = false;
     mIsKeyRegistered   = false;
@@ -2146,6 +2316,8 @@ exit:
 Server::Host::Host(Instance &aInstance, TimeMilli aUpdateTime)
     : InstanceLocator(aInstance)
     , mNext(nullptr)
+    , mLeaseEventTime(aUpdateTime)
+    , mLeaseQueueIndex(kNotInLeaseQueue)
     , mParsedKey(false)
     , mUseShortLeaseOption(false)
 #if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
@@ -2159,6 +2331,7 @@ Server::Host::Host(Instance &aInstance, TimeMilli aUpdateTime)
 #endif
 {
     LeaseTracker::Init(aUpdateTime);
+    mNameLink.Init();
 }
 
 Server::Host::~Host(void) { FreeAllServices(); }
@@ -2250,6 +2423,7 @@ void Server::Host::RemoveService(Service *aService, RetainName aRetainName, Noti
     if (!aRetainName)
     {
         IgnoreError(mServices.Remove(*aService));
+        server.mServiceIndex.Remove(*aService);
         aService->Free();
     }
 
@@ -2267,6 +2441,32 @@ void Server::Host::FreeAllServices(void)
 
 void Server::Host::ClearResources(void) { mAddresses.Free(); }
 
+TimeMilli Server::Host::DetermineLeaseEventTime(void) const
+{
+    // Determines the earliest time at which the lease (if not
+    // deleted) or the key lease of the host or of any of its
+    // services expires.
+
+    TimeMilli eventTime = GetKeyExpireTime();
+
+    if (!IsDeleted())
+    {
+        eventTime = Min(eventTime, GetExpireTime());
+    }
+
+    for (const Service &service : mServices)
+    {
+        eventTime = Min(eventTime, service.GetKeyExpireTime());
+
+        if (!service.mIsDeleted)
+        {
+            eventTime = Min(eventTime, service.GetExpireTime());
+        }
+    }
+
+    return eventTime;
+}
+
 Server::Service *Server::Host::FindService(const char *aInstanceName) { return mServices.FindMatching(aInstanceName); }
 
 const Server::Service *Server::Host::FindService(const char *aInstanceName) const
@@ -2301,6 +2501,200 @@ exit:
     return error;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// Server::LeaseQueue
+
+Error Server::LeaseQueue::Reserve(void)
+{
+    // Ensures there is room to add one more host, so that a
+    // following `Add()` does not need to allocate.
+
+    Error error = kErrorNone;
+
+    if (mHosts.GetLength() == mHosts.GetCapacity())
+    {
+        error = mHosts.ReserveCapacity(mHosts.GetCapacity() + kCapacityIncrements);
+    }
+
+    return error;
+}
+
+void Server::LeaseQueue::Add(Host &aHost)
+{
+    uint16_t index = mHosts.GetLength();
+
+    aHost.mLeaseEventTime = aHost.DetermineLeaseEventTime();
+
+    SuccessOrAssert(mHosts.PushBack(&aHost));
+    aHost.mLeaseQueueIndex = index;
+
+    MoveUp(index);
+}
+
+void Server::LeaseQueue::Remove(Host &aHost)
+{
+    uint16_t index = aHost.mLeaseQueueIndex;
+    Host    *lastHost;
+
+    VerifyOrExit(index != kNotInLeaseQueue);
+
+    aHost.mLeaseQueueIndex = kNotInLeaseQueue;
+
+    lastHost = *mHosts.Back();
+    mHosts.PopBack();
+
+    VerifyOrExit(lastHost != &aHost);
+
+    // Move the last host into the vacated position and restore
+    // the heap order.
+
+    Place(*lastHost, index);
+    MoveUp(index);
+    MoveDown(lastHost->mLeaseQueueIndex);
+
+exit:
+    return;
+}
+
+void Server::LeaseQueue::Update(Host &aHost)
+{
+    VerifyOrExit(aHost.mLeaseQueueIndex != kNotInLeaseQueue);
+
+    aHost.mLeaseEventTime = aHost.DetermineLeaseEventTime();
+
+    MoveUp(aHost.mLeaseQueueIndex);
+    MoveDown(aHost.mLeaseQueueIndex);
+
+exit:
+    return;
+}
+
+void Server::LeaseQueue::MoveUp(uint16_t aIndex)
+{
+    while (aIndex > 0)
+    {
+        uint16_t parentIndex = (aIndex - 1) / 2;
+        Host    *host        = *mHosts.At(aIndex);
+
+        if (!IsEarlier(aIndex, parentIndex))
+        {
+            break;
+        }
+
+        Place(**mHosts.At(parentIndex), aIndex);
+        Place(*host, parentIndex);
+        aIndex = parentIndex;
+    }
+}
+
+void Server::LeaseQueue::MoveDown(uint16_t aIndex)
+{
+    while (true)
+    {
+        uint16_t childIndex = 2 * aIndex + 1;
+        Host    *host;
+
+        if (childIndex >= mHosts.GetLength())
+        {
+            break;
+        }
+
+        if ((childIndex + 1 < mHosts.GetLength()) && IsEarlier(childIndex + 1, childIndex))
+        {
+            childIndex++;
+        }
+
+        if (!IsEarlier(childIndex, aIndex))
+        {
+            break;
+        }
+
+        host = *mHosts.At(aIndex);
+        Place(**mHosts.At(childIndex), aIndex);
+        Place(*host, childIndex);
+        aIndex = childIndex;
+    }
+}
+
+void Server::LeaseQueue::Place(Host &aHost, uint16_t aIndex)
+{
+    *mHosts.At(aIndex)     = &aHost;
+    aHost.mLeaseQueueIndex = aIndex;
+}
+
+bool Server::LeaseQueue::IsEarlier(uint16_t aIndex, uint16_t aOtherIndex) const
+{
+    return (*mHosts.At(aIndex))->mLeaseEventTime < (*mHosts.At(aOtherIndex))->mLeaseEventTime;
+}
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// Server::PendingVerification
+
+Server::PendingVerification::PendingVerification(Host &aHost, const MessageMetadata &aMessageMetadata)
+    : mNext(nullptr)
+    , mHost(aHost)
+    , mMessageMetadata(aMessageMetadata)
+{
+    if (aMessageMetadata.mMessageInfo != nullptr)
+    {
+        // If `mMessageInfo` is not null in the given `aMessageMetadata`,
+        // keep a copy of it since the original `MessageInfo` is only
+        // valid while the received message is being processed.
+
+        mMessageInfo                  = *aMessageMetadata.mMessageInfo;
+        mMessageMetadata.mMessageInfo = &mMessageInfo;
+    }
+}
+
+bool Server::PendingVerification::Matches(const MessageMetadata &aMessageMetadata) const
+{
+    return mMessageMetadata.IsDirectRxFromClient() && aMessageMetadata.IsDirectRxFromClient() &&
+           (mMessageMetadata.mDnsHeader.GetMessageId() == aMessageMetadata.mDnsHeader.GetMessageId()) &&
+           mMessageInfo.HasSamePeerAddrAndPort(*aMessageMetadata.mMessageInfo);
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+
+//---------------------------------------------------------------------------------------------------------------------
+// Server::VerifiedSignatureCache
+
+void Server::VerifiedSignatureCache::Clear(void)
+{
+    mNumEntries = 0;
+    mNextIndex  = 0;
+}
+
+bool Server::VerifiedSignatureCache::Contains(const Crypto::Sha256::Hash &aFingerprint) const
+{
+    bool contains = false;
+
+    for (uint16_t index = 0; index < mNumEntries; index++)
+    {
+        if (mFingerprints[index] == aFingerprint)
+        {
+            contains = true;
+            break;
+        }
+    }
+
+    return contains;
+}
+
+void Server::VerifiedSignatureCache::Add(const Crypto::Sha256::Hash &aFingerprint)
+{
+    // Overwrite the oldest entry once the cache is full.
+
+    mFingerprints[mNextIndex] = aFingerprint;
+    mNextIndex                = (mNextIndex + 1) % kSize;
+    mNumEntries               = Min<uint16_t>(mNumEntries + 1, kSize);
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+
 //---------------------------------------------------------------------------------------------------------------------
 // Server::UpdateMetadata
 
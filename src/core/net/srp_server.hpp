@@ -64,6 +64,7 @@
 #include "common/heap_string.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
+#include "common/name_index.hpp"
 #include "common/non_copyable.hpp"
 #include "common/notifier.hpp"
 #include "common/num_utils.hpp"
@@ -71,6 +72,7 @@
 #include "common/retain_ptr.hpp"
 #include "common/timer.hpp"
 #include "crypto/ecdsa.hpp"
+#include "crypto/sha256.hpp"
 #include "net/dns_types.hpp"
 #include "net/dnssd.hpp"
 #include "net/ip6.hpp"
@@ -255,6 +257,8 @@ public:
         friend class LinkedListEntry<Service>;
         friend class Heap::Allocatable<Service>;
         friend class AdvertisingProxy;
+        template <typename EntryType, NameIndexLink<EntryType> EntryType::*kLink, uint16_t kNumBuckets>
+        friend class ot::NameIndex;
 
     public:
         /**
@@ -419,6 +423,7 @@ public:
         }
 
         Service                  *mNext;
+        NameIndexLink<Service>    mNameLink;
         Heap::String              mInstanceName;
         Heap::String              mInstanceLabel;
         Heap::String              mServiceName;
@@ -458,6 +463,8 @@ public:
         friend class LinkedListEntry<Host>;
         friend class Heap::Allocatable<Host>;
         friend class AdvertisingProxy;
+        template <typename EntryType, NameIndexLink<EntryType> EntryType::*kLink, uint16_t kNumBuckets>
+        friend class ot::NameIndex;
 
     public:
         typedef Crypto::Ecdsa::P256::PublicKey Key; ///< Host key (public ECDSA P256 key).
@@ -542,8 +549,12 @@ public:
         void           FreeAllServices(void);
         void           ClearResources(void);
         Error          AddIp6Address(const Ip6::Address &aIp6Address);
+        TimeMilli      DetermineLeaseEventTime(void) const;
 
         Host                     *mNext;
+        NameIndexLink<Host>       mNameLink;
+        TimeMilli                 mLeaseEventTime;  // Earliest lease or key-lease expiration of host and its services.
+        uint16_t                  mLeaseQueueIndex; // Index in `LeaseQueue` (`kNotInLeaseQueue` if not queued).
         Heap::String              mFullName;
         Heap::Array<Ip6::Address> mAddresses;
         Key                       mKey;
@@ -820,6 +831,20 @@ public:
      */
     const otSrpServerResponseCounters *GetResponseCounters(void) const { return &mResponseCounters; }
 
+    /**
+     * Represents the SRP update signature verification counters.
+     */
+    class SignatureVerifyCounters : public otSrpServerSignatureVerifyCounters, public Clearable<SignatureVerifyCounters>
+    {
+    };
+
+    /**
+     * Returns the signature verification counters of the SRP server.
+     *
+     * @returns  The signature verification counters of the SRP server.
+     */
+    const SignatureVerifyCounters &GetSignatureVerifyCounters(void) const { return mSignatureVerifyCounters; }
+
     /**
      * Receives the service update result from service handler set by
      * SetServiceHandler.
@@ -848,6 +873,15 @@ private:
     static constexpr uint16_t kUninitializedPort      = 0;
     static constexpr uint16_t kAnycastAddressModePort = 53;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+    static constexpr uint16_t kVerifyBatchSize = OPENTHREAD_CONFIG_SRP_SERVER_VERIFY_BATCH_SIZE;
+
+    static_assert(kVerifyBatchSize > 0, "OPENTHREAD_CONFIG_SRP_SERVER_VERIFY_BATCH_SIZE must be non-zero");
+#endif
+
+    static constexpr uint16_t kNotInLeaseQueue = NumericLimits<uint16_t>::kMax;
+    static constexpr uint16_t kNameIndexSize   = OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE;
+
     // Metadata for a received SRP Update message.
     struct MessageMetadata
     {
@@ -862,6 +896,11 @@ private:
         TtlConfig               mTtlConfig;
         LeaseConfig             mLeaseConfig;
         const Ip6::MessageInfo *mMessageInfo; // Set to `nullptr` when from SRPL.
+
+        // SIG(0) info set by `ReadSignature()` and used by `VerifySignature()`.
+        TimeMilli                      mVerifyStartTime;
+        Crypto::Sha256::Hash           mSignedHash;
+        Crypto::Ecdsa::P256::Signature mSignature;
     };
 
     // This class includes metadata for processing a SRP update (register, deregister)
@@ -901,6 +940,76 @@ private:
         bool              mIsDirectRxFromClient;
     };
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+    // A received SRP update waiting for its signature to be verified.
+    class PendingVerification : public LinkedListEntry<PendingVerification>,
+                                public Heap::Allocatable<PendingVerification>
+    {
+        friend class LinkedListEntry<PendingVerification>;
+        friend class Heap::Allocatable<PendingVerification>;
+
+    public:
+        Host                  &GetHost(void) { return mHost; }
+        const MessageMetadata &GetMessageMetadata(void) const { return mMessageMetadata; }
+        bool                   Matches(const MessageMetadata &aMessageMetadata) const;
+
+    private:
+        PendingVerification(Host &aHost, const MessageMetadata &aMessageMetadata);
+
+        PendingVerification *mNext;
+        Host                &mHost; // Owned, freed when the signature is invalid.
+        MessageMetadata      mMessageMetadata;
+        Ip6::MessageInfo     mMessageInfo; // Copy of `MessageInfo` which `mMessageMetadata` points to.
+    };
+#endif
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+    // Ring of fingerprints of recently verified signatures. A
+    // fingerprint is the SHA-256 of the signed message hash, the
+    // signature and the host key, so it only matches an exact
+    // retransmission of an already verified SRP update.
+    class VerifiedSignatureCache
+    {
+    public:
+        VerifiedSignatureCache(void) { Clear(); }
+
+        void Clear(void);
+        bool Contains(const Crypto::Sha256::Hash &aFingerprint) const;
+        void Add(const Crypto::Sha256::Hash &aFingerprint);
+
+    private:
+        static constexpr uint16_t kSize = OPENTHREAD_CONFIG_SRP_SERVER_VERIFIED_SIGNATURE_CACHE_SIZE;
+
+        Crypto::Sha256::Hash mFingerprints[kSize];
+        uint16_t             mNumEntries;
+        uint16_t             mNextIndex;
+    };
+#endif
+
+    // Binary min-heap of committed `Host` entries ordered by their
+    // `mLeaseEventTime`, i.e., the earliest time at which the lease
+    // or key lease of the host or of any of its services expires.
+    class LeaseQueue
+    {
+    public:
+        Error Reserve(void);
+        void  Add(Host &aHost);
+        void  Remove(Host &aHost);
+        void  Update(Host &aHost);
+        Host *GetTop(void) const { return (mHosts.GetLength() == 0) ? nullptr : *mHosts.Front(); }
+        void  Free(void) { mHosts.Free(); }
+
+    private:
+        static constexpr uint16_t kCapacityIncrements = 8;
+
+        void MoveUp(uint16_t aIndex);
+        void MoveDown(uint16_t aIndex);
+        void Place(Host &aHost, uint16_t aIndex);
+        bool IsEarlier(uint16_t aIndex, uint16_t aOtherIndex) const;
+
+        Heap::Array<Host *, kCapacityIncrements> mHosts;
+    };
+
     void              Enable(void);
     void              Disable(void);
     void              Start(void);
@@ -944,13 +1053,18 @@ private:
     void  ProcessDnsUpdate(Message &aMessage, MessageMetadata &aMetadata);
     Error ProcessUpdateSection(Host &aHost, const Message &aMessage, MessageMetadata &aMetadata) const;
     Error ProcessAdditionalSection(Host *aHost, const Message &aMessage, MessageMetadata &aMetadata) const;
-    Error VerifySignature(const Host::Key  &aKey,
-                          const Message    &aMessage,
-                          Dns::UpdateHeader aDnsHeader,
-                          uint16_t          aSigOffset,
-                          uint16_t          aSigRdataOffset,
-                          uint16_t          aSigRdataLength,
-                          const char       *aSignerName) const;
+    Error ReadSignature(const Message    &aMessage,
+                        Dns::UpdateHeader aDnsHeader,
+                        uint16_t          aSigOffset,
+                        uint16_t          aSigRdataOffset,
+                        uint16_t          aSigRdataLength,
+                        const char       *aSignerName,
+                        MessageMetadata  &aMetadata) const;
+    Error VerifySignature(const Host::Key &aKey, const MessageMetadata &aMetadata);
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+    Error QueueVerification(Host &aHost, const MessageMetadata &aMetadata);
+    void  ProcessPendingVerifications(void);
+#endif
     Error ProcessZoneSection(const Message &aMessage, MessageMetadata &aMetadata) const;
     Error ProcessHostDescriptionInstruction(Host                  &aHost,
                                             const Message         &aMessage,
@@ -963,6 +1077,9 @@ private:
     static bool IsValidDeleteAllRecord(const Dns::ResourceRecord &aRecord);
 
     void        HandleUpdate(Host &aHost, const MessageMetadata &aMetadata);
+    Host       *FindHost(const char *aFullName);
+    void        AddHost(Host &aHost);
+    void        UnlinkHost(Host &aHost);
     void        RemoveHost(Host *aHost, RetainName aRetainName);
     bool        HasNameConflictsWith(Host &aHost) const;
     void        SendResponse(const Dns::UpdateHeader    &aHeader,
@@ -975,12 +1092,13 @@ private:
                              const Ip6::MessageInfo  &aMessageInfo);
     void        HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void        HandleLeaseTimer(void);
+    void        HandleLeaseExpiration(Host &aHost, TimeMilli aNow);
     static void HandleOutstandingUpdatesTimer(Timer &aTimer);
     void        HandleOutstandingUpdatesTimer(void);
     void        ProcessCompletedUpdates(void);
 
-    const UpdateMetadata *FindOutstandingUpdate(const MessageMetadata &aMessageMetadata) const;
-    static const char    *AddressModeToString(AddressMode aMode);
+    bool               HasOutstandingUpdate(const MessageMetadata &aMessageMetadata) const;
+    static const char *AddressModeToString(AddressMode aMode);
 
     void UpdateResponseCounters(Dns::Header::Response aResponseCode);
     void UpdateAddrResolverCacheTable(const Ip6::MessageInfo &aMessageInfo, const Host &aHost);
@@ -989,6 +1107,11 @@ private:
     using UpdateTimer          = TimerMilliIn<Server, &Server::HandleOutstandingUpdatesTimer>;
     using CompletedUpdatesTask = TaskletIn<Server, &Server::ProcessCompletedUpdates>;
     using ServerSocket         = Ip6::Udp::SocketIn<Server, &Server::HandleUdpReceive>;
+    using HostNameIndex        = NameIndex<Host, &Host::mNameLink, kNameIndexSize>;
+    using ServiceNameIndex     = NameIndex<Service, &Service::mNameLink, kNameIndexSize>;
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+    using VerifyTask = TaskletIn<Server, &Server::ProcessPendingVerifications>;
+#endif
 
     ServerSocket mSocket;
 
@@ -1000,6 +1123,9 @@ private:
     LeaseConfig mLeaseConfig;
 
     LinkedList<Host> mHosts;
+    HostNameIndex    mHostIndex;
+    ServiceNameIndex mServiceIndex;
+    LeaseQueue       mLeaseQueue;
     LeaseTimer       mLeaseTimer;
 
     UpdateTimer                mOutstandingUpdatesTimer;
@@ -1007,6 +1133,14 @@ private:
     LinkedList<UpdateMetadata> mCompletedUpdates;
     CompletedUpdatesTask       mCompletedUpdateTask;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+    LinkedList<PendingVerification> mPendingVerifications;
+    VerifyTask                      mVerifyTask;
+#endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_VERIFIED_SIGNATURE_CACHE_SIZE > 0
+    VerifiedSignatureCache mVerifiedSignatures;
+#endif
+
     ServiceUpdateId mServiceUpdateId;
     uint16_t        mPort;
     State           mState;
@@ -1023,6 +1157,7 @@ private:
 #endif
 
     otSrpServerResponseCounters mResponseCounters;
+    SignatureVerifyCounters     mSignatureVerifyCounters;
 };
 
 } // namespace Srp
@@ -744,6 +744,18 @@ public:
      */
     void ClearSrcMatchExtEntries(void);
 
+    /**
+     * Applies a list of changes to the source address match table.
+     *
+     * @param[in]  aEntries     A pointer to the array of changes (extended addresses in little-endian byte order).
+     * @param[in]  aNumEntries  The number of entries in @p aEntries.
+     *
+     * @retval kErrorNone            Successfully applied all the changes.
+     * @retval kErrorNoBufs          No available entry in the source match table (some changes may be applied).
+     * @retval kErrorNotImplemented  The radio does not support applying a list of changes.
+     */
+    Error UpdateSrcMatchEntries(const otRadioSrcMatchEntry *aEntries, uint16_t aNumEntries);
+
     /**
      * Gets the radio supported channel mask that the device is allowed to be on.
      *
@@ -1027,6 +1039,11 @@ inline void Radio::ClearSrcMatchShortEntries(void) { otPlatRadioClearSrcMatchSho
 
 inline void Radio::ClearSrcMatchExtEntries(void) { otPlatRadioClearSrcMatchExtEntries(GetInstancePtr()); }
 
+inline Error Radio::UpdateSrcMatchEntries(const otRadioSrcMatchEntry *aEntries, uint16_t aNumEntries)
+{
+    return otPlatRadioUpdateSrcMatchEntries(GetInstancePtr(), aEntries, aNumEntries);
+}
+
 inline uint32_t Radio::GetBusSpeed(void) { return otPlatRadioGetBusSpeed(GetInstancePtr()); }
 
 inline uint32_t Radio::GetBusLatency(void) { return otPlatRadioGetBusLatency(GetInstancePtr()); }
@@ -1131,6 +1148,8 @@ inline void Radio::ClearSrcMatchShortEntries(void) {}
 
 inline void Radio::ClearSrcMatchExtEntries(void) {}
 
+inline Error Radio::UpdateSrcMatchEntries(const otRadioSrcMatchEntry *, uint16_t) { return kErrorNotImplemented; }
+
 inline uint32_t Radio::GetBusSpeed(void) { return 0; }
 
 inline uint32_t Radio::GetBusLatency(void) { return 0; }
@@ -350,6 +350,17 @@ extern "C" OT_TOOL_WEAK otError otPlatRadioSetChannelMaxTransmitPower(otInstance
     return kErrorNotImplemented;
 }
 
+extern "C" OT_TOOL_WEAK otError otPlatRadioUpdateSrcMatchEntries(otInstance                 *aInstance,
+                                                                 const otRadioSrcMatchEntry *aEntries,
+                                                                 uint16_t                    aNumEntries)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aEntries);
+    OT_UNUSED_VARIABLE(aNumEntries);
+
+    return kErrorNotImplemented;
+}
+
 extern "C" OT_TOOL_WEAK otError otPlatRadioSetRegion(otInstance *aInstance, uint16_t aRegionCode)
 {
     OT_UNUSED_VARIABLE(aInstance);
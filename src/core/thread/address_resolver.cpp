@@ -43,10 +43,20 @@ AddressResolver::AddressResolver(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if OPENTHREAD_FTD
     , mCacheEntryPool(aInstance)
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    , mCachedList(kCachedListId)
+    , mSnoopedList(kSnoopedListId)
+    , mQueryList(kQueryListId)
+    , mQueryRetryList(kQueryRetryListId)
+#endif
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 #endif
 {
 #if OPENTHREAD_FTD
+    mCounters.Clear();
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    ClearIndex();
+#endif
     IgnoreError(Get<Ip6::Icmp>().RegisterHandler(mIcmpHandler));
 #endif
 }
@@ -71,6 +81,10 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    ClearIndex();
+#endif
 }
 
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -177,7 +191,7 @@ void AddressResolver::Remove(uint16_t aRloc16, bool aMatchRouterId)
                 (!aMatchRouterId && (entry->GetRloc16() == aRloc16)))
             {
                 RemoveCacheEntry(*entry, *list, prev, aMatchRouterId ? kReasonRemovingRouterId : kReasonRemovingRloc16);
-                mCacheEntryPool.Free(*entry);
+                FreeCacheEntry(*entry);
 
                 // If the entry is removed from list, we keep the same
                 // `prev` pointer.
@@ -197,12 +211,26 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
     CacheEntry     *entry   = nullptr;
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    // The index determines whether there is an entry for `aEid`. The
+    // entry tracks its list and its previous entry in the list, so no
+    // list is walked.
+
+    entry = FindInIndex(aEid);
+    VerifyOrExit(entry != nullptr);
+
+    aList      = lists[entry->GetListId()];
+    aPrevEntry = (aList->GetHead() == entry) ? nullptr : entry->GetPrev();
+
+    OT_ASSERT((aPrevEntry == nullptr) || (aPrevEntry->GetNext() == entry));
+#else
     for (CacheEntryList *list : lists)
     {
         aList = list;
         entry = aList->FindMatchingWithPrev(aPrevEntry, aEid);
         VerifyOrExit(entry == nullptr);
     }
+#endif
 
 exit:
     return entry;
@@ -220,7 +248,7 @@ void AddressResolver::Remove(const Ip6::Address &aEid, Reason aReason)
     VerifyOrExit(entry != nullptr);
 
     RemoveCacheEntry(*entry, *list, prev, aReason);
-    mCacheEntryPool.Free(*entry);
+    FreeCacheEntry(*entry);
 
 exit:
     return;
@@ -283,6 +311,10 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
         if (newEntry != nullptr)
         {
             RemoveCacheEntry(*newEntry, *list, prevEntry, kReasonEvictingForNewEntry);
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+            RemoveFromIndex(*newEntry);
+#endif
+            mCounters.mEvictions++;
             ExitNow();
         }
 
@@ -308,6 +340,137 @@ exit:
     return newEntry;
 }
 
+void AddressResolver::FreeCacheEntry(CacheEntry &aEntry)
+{
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    RemoveFromIndex(aEntry);
+#endif
+    mCacheEntryPool.Free(aEntry);
+}
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
+// The hash index is an open addressing table (with linear probing)
+// of `mCacheEntryPool` indexes. All entries in the lists are added
+// to the index, and an entry is removed from the index when it is
+// freed or evicted. The index does not affect the list ordering,
+// which determines the eviction order.
+
+void AddressResolver::ClearIndex(void)
+{
+    for (uint16_t &slot : mIndex)
+    {
+        slot = kIndexEmptySlot;
+    }
+}
+
+uint16_t AddressResolver::GetIndexSlot(const Ip6::Address &aEid)
+{
+    // The IID is used as the key since the prefix is commonly the
+    // same for many entries. The bits are mixed so that sequential
+    // IIDs are spread over the table.
+
+    const Ip6::InterfaceIdentifier &iid  = aEid.GetIid();
+    uint32_t                        hash = iid.mFields.m32[0] ^ iid.mFields.m32[1];
+
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+
+    return static_cast<uint16_t>(hash % kIndexSize);
+}
+
+void AddressResolver::AddToIndex(const CacheEntry &aEntry)
+{
+    uint16_t slot = GetIndexSlot(aEntry.GetTarget());
+
+    // The index has more slots than the number of entries, so there
+    // is always an empty slot.
+
+    while (mIndex[slot] != kIndexEmptySlot)
+    {
+        slot = (slot + 1) % kIndexSize;
+    }
+
+    mIndex[slot] = mCacheEntryPool.GetIndexOf(aEntry);
+}
+
+void AddressResolver::RemoveFromIndex(const CacheEntry &aEntry)
+{
+    uint16_t entryIndex = mCacheEntryPool.GetIndexOf(aEntry);
+    uint16_t slot       = GetIndexSlot(aEntry.GetTarget());
+    uint16_t next;
+
+    while (mIndex[slot] != entryIndex)
+    {
+        // Exit if the entry is not in the index.
+        VerifyOrExit(mIndex[slot] != kIndexEmptySlot);
+        slot = (slot + 1) % kIndexSize;
+    }
+
+    // Move back any following entry in the same probe run which
+    // would otherwise become unreachable once `slot` is emptied,
+    // i.e., an entry whose initial slot is not cyclically within
+    // `(slot, next]`.
+
+    next = slot;
+
+    while (true)
+    {
+        uint16_t initial;
+        bool     canMove;
+
+        next = (next + 1) % kIndexSize;
+
+        if (mIndex[next] == kIndexEmptySlot)
+        {
+            break;
+        }
+
+        initial = GetIndexSlot(mCacheEntryPool.GetEntryAt(mIndex[next]).GetTarget());
+
+        if (slot < next)
+        {
+            canMove = (initial <= slot) || (initial > next);
+        }
+        else
+        {
+            canMove = (initial <= slot) && (initial > next);
+        }
+
+        if (canMove)
+        {
+            mIndex[slot] = mIndex[next];
+            slot         = next;
+        }
+    }
+
+    mIndex[slot] = kIndexEmptySlot;
+
+exit:
+    return;
+}
+
+AddressResolver::CacheEntry *AddressResolver::FindInIndex(const Ip6::Address &aEid)
+{
+    CacheEntry *entry = nullptr;
+
+    for (uint16_t slot = GetIndexSlot(aEid); mIndex[slot] != kIndexEmptySlot; slot = (slot + 1) % kIndexSize)
+    {
+        CacheEntry &candidate = mCacheEntryPool.GetEntryAt(mIndex[slot]);
+
+        if (candidate.Matches(aEid))
+        {
+            entry = &candidate;
+            break;
+        }
+    }
+
+    return entry;
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
 void AddressResolver::RemoveCacheEntry(CacheEntry     &aEntry,
                                        CacheEntryList &aList,
                                        CacheEntry     *aPrevEntry,
@@ -418,6 +581,9 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid, uint16_t
     }
 
     mSnoopedList.Push(*entry);
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    AddToIndex(*entry);
+#endif
 
     LogCacheEntryChange(kEntryAdded, kReasonSnoop, *entry);
 
@@ -448,6 +614,9 @@ void AddressResolver::RestartAddressQueries(void)
 
     for (CacheEntry &entry : mQueryList)
     {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        entry.SetListId(kQueryListId);
+#endif
         IgnoreError(SendAddressQuery(entry.GetTarget()));
 
         entry.SetTimeout(kAddressQueryTimeout);
@@ -499,7 +668,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
 
         if (!isFresh && (Get<RouterTable>().GetNextHop(entry->GetRloc16()) == Mle::kInvalidRloc16))
         {
-            mCacheEntryPool.Free(*entry);
+            FreeCacheEntry(*entry);
             entry = nullptr;
         }
 
@@ -514,10 +683,13 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
 
             mCachedList.Push(*entry);
             aRloc16 = entry->GetRloc16();
+            mCounters.mLookupHits++;
             ExitNow();
         }
     }
 
+    mCounters.mLookupMisses++;
+
     if (entry == nullptr)
     {
         // If the entry is not present in any of the lists, try to
@@ -563,11 +735,14 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+    VerifyOrExit(error == kErrorNone, FreeCacheEntry(*entry));
 
     if (list == nullptr)
     {
         LogCacheEntryChange(kEntryAdded, kReasonQueryRequest, *entry);
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        AddToIndex(*entry);
+#endif
     }
 
     mQueryList.Push(*entry);
@@ -1074,6 +1249,10 @@ void AddressResolver::CacheEntry::Init(Instance &aInstance)
     InstanceLocatorInit::Init(aInstance);
     mNextIndex        = kNoNextIndex;
     mFreshnessTimeout = 0;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    mPrevIndex = 0;
+    mListId    = kCachedListId;
+#endif
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
@@ -1091,10 +1270,21 @@ void AddressResolver::CacheEntry::SetNext(CacheEntry *aEntry)
     VerifyOrExit(aEntry != nullptr, mNextIndex = kNoNextIndex);
     mNextIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    aEntry->mPrevIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*this);
+#endif
+
 exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(void)
+{
+    return &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+}
+#endif
+
 #endif // OPENTHREAD_FTD
 
 } // namespace ot
@@ -105,6 +105,13 @@ public:
         };
     };
 
+    /**
+     * Represents the EID cache counters.
+     */
+    class Counters : public otCacheCounters, public Clearable<Counters>
+    {
+    };
+
     /**
      * Initializes the object.
      */
@@ -129,6 +136,18 @@ public:
      */
     Error GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const;
 
+    /**
+     * Gets the EID cache counters.
+     *
+     * @returns A reference to the EID cache counters.
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the EID cache counters.
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
     /**
      * Removes the EID-to-RLOC cache entries corresponding to an RLOC16.
      *
@@ -235,6 +254,20 @@ private:
     static constexpr uint16_t kMaxNonEvictableSnoopedEntries =
         OT_MAX(1, OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    // Number of slots in the hash index. It is kept odd and at least
+    // twice the number of entries to keep the probe sequences short.
+    static constexpr uint16_t kIndexSize      = 2 * kCacheEntries + 1;
+    static constexpr uint16_t kIndexEmptySlot = 0xffff;
+
+    // Identifies the list containing a cache entry. The values follow
+    // the order of the lists in `FindCacheEntry()`.
+    static constexpr uint8_t kCachedListId     = 0;
+    static constexpr uint8_t kSnoopedListId    = 1;
+    static constexpr uint8_t kQueryListId      = 2;
+    static constexpr uint8_t kQueryRetryListId = 3;
+#endif
+
     // All time/delay values are in seconds
     static constexpr uint16_t kAddressQueryTimeout           = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_TIMEOUT;
     static constexpr uint16_t kAddressQueryInitialRetryDelay = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_INITIAL_RETRY_DELAY;
@@ -284,6 +317,16 @@ private:
 
         bool Matches(const Ip6::Address &aEid) const { return GetTarget() == aEid; }
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        // The previous entry is only valid when the entry is in a list
+        // and is not the head of the list. It is updated from
+        // `SetNext()` on the previous entry.
+        CacheEntry *GetPrev(void);
+
+        uint8_t GetListId(void) const { return mListId; }
+        void    SetListId(uint8_t aListId) { mListId = aListId; }
+#endif
+
     private:
         static constexpr uint16_t kNoNextIndex          = 0x3fff;     // `mNextIndex` value when at end of list.
         static constexpr uint32_t kInvalidLastTransTime = 0xffffffff; // Value when `mLastTransactionTime` is invalid.
@@ -295,6 +338,10 @@ private:
         uint16_t     mRloc16;
         uint16_t     mNextIndex : 14;
         uint8_t      mFreshnessTimeout : 2;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        uint16_t mPrevIndex : 14;
+        uint8_t  mListId : 2;
+#endif
 
         union
         {
@@ -319,6 +366,22 @@ private:
 
     class CacheEntryList : public LinkedList<CacheEntry>
     {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    public:
+        explicit CacheEntryList(uint8_t aListId)
+            : mListId(aListId)
+        {
+        }
+
+        void Push(CacheEntry &aEntry)
+        {
+            aEntry.SetListId(mListId);
+            LinkedList<CacheEntry>::Push(aEntry);
+        }
+
+    private:
+        uint8_t mListId;
+#endif
     };
 
     enum EntryChange : uint8_t
@@ -347,6 +410,7 @@ private:
     void        Remove(const Ip6::Address &aEid, Reason aReason);
     CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList, CacheEntry *&aPrevEntry);
     CacheEntry *NewCacheEntry(bool aSnoopedEntry);
+    void        FreeCacheEntry(CacheEntry &aEntry);
     void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
     Error       UpdateCacheEntry(const Ip6::Address &aEid, uint16_t aRloc16);
     Error       SendAddressQuery(const Ip6::Address &aEid);
@@ -379,6 +443,15 @@ private:
 
     static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    void        ClearIndex(void);
+    void        AddToIndex(const CacheEntry &aEntry);
+    void        RemoveFromIndex(const CacheEntry &aEntry);
+    CacheEntry *FindInIndex(const Ip6::Address &aEid);
+
+    static uint16_t GetIndexSlot(const Ip6::Address &aEid);
+#endif
+
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_INFO)
     static const char *EntryChangeToString(EntryChange aChange);
     static const char *ReasonToString(Reason aReason);
@@ -390,6 +463,10 @@ private:
     CacheEntryList     mQueryList;
     CacheEntryList     mQueryRetryList;
     Ip6::Icmp::Handler mIcmpHandler;
+    Counters           mCounters;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    uint16_t mIndex[kIndexSize];
+#endif
 
 #endif // OPENTHREAD_FTD
 };
@@ -406,6 +483,7 @@ DeclareTmfHandler(AddressResolver, kUriAddressNotify);
 
 DefineCoreType(otCacheEntryIterator, AddressResolver::Iterator);
 DefineCoreType(otCacheEntryInfo, AddressResolver::EntryInfo);
+DefineCoreType(otCacheCounters, AddressResolver::Counters);
 DefineMapEnum(otCacheEntryState, AddressResolver::EntryInfo::State);
 
 } // namespace ot
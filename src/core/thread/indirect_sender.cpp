@@ -74,6 +74,7 @@ void IndirectSender::Stop(void)
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
     {
         child.SetIndirectMessage(nullptr);
+        child.SetIndirectQueueHead(nullptr);
         mSourceMatchController.ResetMessageCount(child);
     }
 
@@ -99,8 +100,7 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
     childIndex = Get<ChildTable>().GetChildIndex(aChild);
     VerifyOrExit(!aMessage.GetIndirectTxChildMask().Has(childIndex));
 
-    aMessage.GetIndirectTxChildMask().Add(childIndex);
-    mSourceMatchController.IncrementMessageCount(aChild);
+    AddToChildQueue(aMessage, aChild, childIndex);
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
     {
@@ -126,8 +126,7 @@ Error IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &aCh
 
     VerifyOrExit(aMessage.GetIndirectTxChildMask().Has(childIndex), error = kErrorNotFound);
 
-    aMessage.GetIndirectTxChildMask().Remove(childIndex);
-    mSourceMatchController.DecrementMessageCount(aChild);
+    RemoveFromChildQueue(aMessage, aChild, childIndex);
 
     RequestMessageUpdate(aChild);
 
@@ -137,16 +136,36 @@ exit:
 
 void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 {
+    uint16_t childIndex;
+    uint16_t remaining;
+    Message *nextMessage;
+
     VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (Message &message : Get<MeshForwarder>().mSendQueue)
+    childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    remaining  = aChild.GetIndirectMessageCount();
+
+    // No message before the child's queue head is destined to the
+    // child, and we can stop as soon as all its messages are seen.
+
+    for (Message *message = aChild.GetIndirectQueueHead(); (message != nullptr) && (remaining > 0);
+         message          = nextMessage)
     {
-        message.GetIndirectTxChildMask().Remove(Get<ChildTable>().GetChildIndex(aChild));
+        nextMessage = message->GetNext();
 
-        Get<MeshForwarder>().RemoveMessageIfNoPendingTx(message);
+        if (!message->GetIndirectTxChildMask().Has(childIndex))
+        {
+            continue;
+        }
+
+        message->GetIndirectTxChildMask().Remove(childIndex);
+        remaining--;
+
+        Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
     }
 
     aChild.SetIndirectMessage(nullptr);
+    aChild.SetIndirectQueueHead(nullptr);
     mSourceMatchController.ResetMessageCount(aChild);
 
     mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
@@ -160,21 +179,93 @@ exit:
 
 const Message *IndirectSender::FindQueuedMessageForSleepyChild(const Child &aChild, MessageChecker aChecker) const
 {
-    const Message *match      = nullptr;
-    uint16_t       childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    const Message *match = nullptr;
+    uint16_t       childIndex;
+
+    VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (const Message &message : Get<MeshForwarder>().mSendQueue)
+    childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+    for (const Message *message = aChild.GetIndirectQueueHead(); message != nullptr; message = message->GetNext())
     {
-        if (message.GetIndirectTxChildMask().Has(childIndex) && aChecker(message))
+        if (message->GetIndirectTxChildMask().Has(childIndex) && aChecker(*message))
         {
-            match = &message;
+            match = message;
             break;
         }
     }
 
+exit:
     return match;
 }
 
+void IndirectSender::AddToChildQueue(Message &aMessage, Child &aChild, uint16_t aChildIndex)
+{
+    // Updates the child's queue head, which tracks the first message
+    // in the send queue destined to the child. This allows a lookup
+    // to start from the head instead of scanning the entire queue.
+
+    Message *head = aChild.GetIndirectQueueHead();
+
+    aMessage.GetIndirectTxChildMask().Add(aChildIndex);
+
+    if ((head == nullptr) || IsQueuedBefore(aMessage, *head))
+    {
+        aChild.SetIndirectQueueHead(&aMessage);
+    }
+
+    mSourceMatchController.IncrementMessageCount(aChild);
+}
+
+void IndirectSender::RemoveFromChildQueue(Message &aMessage, Child &aChild, uint16_t aChildIndex)
+{
+    aMessage.GetIndirectTxChildMask().Remove(aChildIndex);
+
+    if (aChild.GetIndirectQueueHead() == &aMessage)
+    {
+        Message *next = aMessage.GetNext();
+
+        while ((next != nullptr) && !next->GetIndirectTxChildMask().Has(aChildIndex))
+        {
+            next = next->GetNext();
+        }
+
+        aChild.SetIndirectQueueHead(next);
+    }
+
+    mSourceMatchController.DecrementMessageCount(aChild);
+}
+
+bool IndirectSender::IsQueuedBefore(const Message &aMessage, const Message &aOther)
+{
+    // Determines whether `aMessage` comes before `aOther` in the send
+    // queue. The queue is ordered by priority and messages of the same
+    // priority are in FIFO order. A newly queued message is the tail
+    // of its priority, so the search below ends quickly in the common
+    // case.
+
+    bool isBefore = false;
+
+    if (aMessage.GetPriority() != aOther.GetPriority())
+    {
+        ExitNow(isBefore = (aMessage.GetPriority() > aOther.GetPriority()));
+    }
+
+    for (const Message *message = aMessage.GetNext(); message != nullptr; message = message->GetNext())
+    {
+        VerifyOrExit(message->GetPriority() == aMessage.GetPriority());
+
+        if (message == &aOther)
+        {
+            isBefore = true;
+            break;
+        }
+    }
+
+exit:
+    return isBefore;
+}
+
 void IndirectSender::SetChildUseShortAddress(Child &aChild, bool aUseShortAddress)
 {
     VerifyOrExit(aChild.IsIndirectSourceMatchShort() != aUseShortAddress);
@@ -198,18 +289,22 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
     if (!aOldMode.IsRxOnWhenIdle() && aChild.IsRxOnWhenIdle() && (aChild.GetIndirectMessageCount() > 0))
     {
         uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+        uint16_t remaining  = aChild.GetIndirectMessageCount();
 
-        for (Message &message : Get<MeshForwarder>().mSendQueue)
+        for (Message *message = aChild.GetIndirectQueueHead(); (message != nullptr) && (remaining > 0);
+             message          = message->GetNext())
         {
-            if (message.GetIndirectTxChildMask().Has(childIndex))
+            if (message->GetIndirectTxChildMask().Has(childIndex))
             {
-                message.GetIndirectTxChildMask().Remove(childIndex);
-                message.SetDirectTransmission();
-                message.SetTimestampToNow();
+                message->GetIndirectTxChildMask().Remove(childIndex);
+                message->SetDirectTransmission();
+                message->SetTimestampToNow();
+                remaining--;
             }
         }
 
         aChild.SetIndirectMessage(nullptr);
+        aChild.SetIndirectQueueHead(nullptr);
         mSourceMatchController.ResetMessageCount(aChild);
 
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
@@ -494,8 +589,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
 
         if (message->GetIndirectTxChildMask().Has(childIndex))
         {
-            message->GetIndirectTxChildMask().Remove(childIndex);
-            mSourceMatchController.DecrementMessageCount(aChild);
+            RemoveFromChildQueue(*message, aChild, childIndex);
         }
 
         message->InvokeTxCallback(txError);
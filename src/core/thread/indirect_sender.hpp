@@ -60,6 +60,7 @@ namespace ot {
 #if OPENTHREAD_FTD || OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
 
 class CslNeighbor;
+class UnitTester;
 #if OPENTHREAD_FTD
 class Child;
 #endif
@@ -70,6 +71,7 @@ class Child;
 class IndirectSender : public InstanceLocator, public IndirectSenderBase, private NonCopyable
 {
     friend class Instance;
+    friend class ot::UnitTester;
 #if OPENTHREAD_FTD
     friend class DataPollHandler;
 #endif
@@ -86,6 +88,7 @@ public:
     class NeighborInfo
     {
         friend class IndirectSender;
+        friend class ot::UnitTester;
 #if OPENTHREAD_FTD
         friend class DataPollHandler;
         friend class SourceMatchController;
@@ -120,11 +123,20 @@ public:
         void DecrementIndirectMessageCount(void) { mQueuedMessageCount--; }
         void ResetIndirectMessageCount(void) { mQueuedMessageCount = 0; }
 
+#if OPENTHREAD_FTD
+        Message       *GetIndirectQueueHead(void) { return mQueueHead; }
+        const Message *GetIndirectQueueHead(void) const { return mQueueHead; }
+        void           SetIndirectQueueHead(Message *aMessage) { mQueueHead = aMessage; }
+#endif
+
         bool IsWaitingForMessageUpdate(void) const { return mWaitingForMessageUpdate; }
         void SetWaitingForMessageUpdate(bool aNeedsUpdate) { mWaitingForMessageUpdate = aNeedsUpdate; }
 
         const Mac::Address &GetMacAddress(Mac::Address &aMacAddress) const;
 
+#if OPENTHREAD_FTD
+        Message *mQueueHead; // First queued message for the child (in send queue order).
+#endif
         Message *mIndirectMessage;             // Current indirect message.
         uint16_t mIndirectFragmentOffset : 14; // 6LoWPAN fragment offset for the indirect message.
         bool     mIndirectTxSuccess : 1;       // Indicates tx success/failure of current indirect message.
@@ -276,6 +288,10 @@ private:
     void UpdateIndirectMessage(Child &aChild);
     void RequestMessageUpdate(Child &aChild);
     void ClearMessagesForRemovedChildren(void);
+    void AddToChildQueue(Message &aMessage, Child &aChild, uint16_t aChildIndex);
+    void RemoveFromChildQueue(Message &aMessage, Child &aChild, uint16_t aChildIndex);
+
+    static bool IsQueuedBefore(const Message &aMessage, const Message &aOther);
 
     static bool AcceptAnyMessage(const Message &aMessage);
     static bool AcceptSupervisionMessage(const Message &aMessage);
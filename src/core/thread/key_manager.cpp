@@ -188,6 +188,8 @@ KeyManager::KeyManager(Instance &aInstance)
 #endif
 
     mMacFrameCounters.Reset();
+    InvalidateAdjacentKeys();
+    mKeyCacheCounters.Clear();
 }
 
 void KeyManager::Init(void)
@@ -334,6 +336,8 @@ void KeyManager::UpdateKeyMaterial(void)
 {
     HashKeys hashKeys;
 
+    InvalidateAdjacentKeys();
+
     ComputeKeys(mKeySequence, hashKeys);
 
     mMleKey.SetFrom(hashKeys.GetMleKey());
@@ -346,11 +350,16 @@ void KeyManager::UpdateKeyMaterial(void)
 
         curKey.SetFrom(hashKeys.GetMacKey(), Mac::kDefaultMacKeysExportable);
 
+        // The adjacent key sequences are computed here anyway, so
+        // they are also kept for `GetTemporaryMleKey()`.
+
         ComputeKeys(mKeySequence - 1, hashKeys);
         prevKey.SetFrom(hashKeys.GetMacKey(), Mac::kDefaultMacKeysExportable);
+        mPrevKeys.SetFrom(hashKeys);
 
         ComputeKeys(mKeySequence + 1, hashKeys);
         nextKey.SetFrom(hashKeys.GetMacKey(), Mac::kDefaultMacKeysExportable);
+        mNextKeys.SetFrom(hashKeys);
 
         Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1, prevKey, curKey, nextKey);
     }
@@ -419,39 +428,148 @@ exit:
     return;
 }
 
+KeyManager::AdjacentKeys *KeyManager::FindAdjacentKeys(uint32_t aKeySequence)
+{
+    AdjacentKeys *adjacentKeys = nullptr;
+
+    if (aKeySequence == mKeySequence - 1)
+    {
+        adjacentKeys = &mPrevKeys;
+    }
+    else if (aKeySequence == mKeySequence + 1)
+    {
+        adjacentKeys = &mNextKeys;
+    }
+
+    return adjacentKeys;
+}
+
+const KeyManager::AdjacentKeys *KeyManager::GetAdjacentHashKeys(uint32_t aKeySequence)
+{
+    // Returns the cached keys derived from HMAC for `aKeySequence`,
+    // computing them if needed, or `nullptr` if `aKeySequence` is
+    // not adjacent to the current key sequence.
+
+    AdjacentKeys *adjacentKeys = FindAdjacentKeys(aKeySequence);
+
+    VerifyOrExit(adjacentKeys != nullptr);
+
+    if (adjacentKeys->mHasHashKeys)
+    {
+        mKeyCacheCounters.mHits++;
+    }
+    else
+    {
+        HashKeys hashKeys;
+
+        mKeyCacheCounters.mMisses++;
+        ComputeKeys(aKeySequence, hashKeys);
+        adjacentKeys->SetFrom(hashKeys);
+    }
+
+exit:
+    return adjacentKeys;
+}
+
+void KeyManager::InvalidateAdjacentKeys(void)
+{
+    mPrevKeys.Invalidate();
+    mNextKeys.Invalidate();
+}
+
 const Mle::KeyMaterial &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    HashKeys hashKeys;
+    const AdjacentKeys     *adjacentKeys = GetAdjacentHashKeys(aKeySequence);
+    const Mle::KeyMaterial *key;
 
-    ComputeKeys(aKeySequence, hashKeys);
-    mTemporaryMleKey.SetFrom(hashKeys.GetMleKey());
+    if (adjacentKeys != nullptr)
+    {
+        key = &adjacentKeys->mMleKey;
+    }
+    else
+    {
+        HashKeys hashKeys;
 
-    return mTemporaryMleKey;
+        ComputeKeys(aKeySequence, hashKeys);
+        mTemporaryMleKey.SetFrom(hashKeys.GetMleKey());
+        key = &mTemporaryMleKey;
+    }
+
+    return *key;
 }
 
 #if OPENTHREAD_CONFIG_WAKEUP_END_DEVICE_ENABLE
 const Mle::KeyMaterial &KeyManager::GetTemporaryMacKey(uint32_t aKeySequence)
 {
-    HashKeys hashKeys;
+    const AdjacentKeys     *adjacentKeys = GetAdjacentHashKeys(aKeySequence);
+    const Mle::KeyMaterial *key;
+
+    if (adjacentKeys != nullptr)
+    {
+        key = &adjacentKeys->mMacKey;
+    }
+    else
+    {
+        HashKeys hashKeys;
 
-    ComputeKeys(aKeySequence, hashKeys);
-    mTemporaryMacKey.SetFrom(hashKeys.GetMacKey());
+        ComputeKeys(aKeySequence, hashKeys);
+        mTemporaryMacKey.SetFrom(hashKeys.GetMacKey());
+        key = &mTemporaryMacKey;
+    }
 
-    return mTemporaryMacKey;
+    return *key;
 }
 #endif
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 const Mac::KeyMaterial &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence)
 {
-    Mac::Key key;
+    AdjacentKeys     *adjacentKeys = FindAdjacentKeys(aKeySequence);
+    Mac::KeyMaterial *keyMaterial  = (adjacentKeys != nullptr) ? &adjacentKeys->mTrelKey : &mTemporaryTrelKey;
+
+    if ((adjacentKeys != nullptr) && adjacentKeys->mHasTrelKey)
+    {
+        mKeyCacheCounters.mHits++;
+    }
+    else
+    {
+        Mac::Key key;
+
+        ComputeTrelKey(aKeySequence, key);
+        keyMaterial->SetFrom(key);
 
-    ComputeTrelKey(aKeySequence, key);
-    mTemporaryTrelKey.SetFrom(key);
+        if (adjacentKeys != nullptr)
+        {
+            adjacentKeys->mHasTrelKey = true;
+            mKeyCacheCounters.mMisses++;
+        }
+    }
+
+    return *keyMaterial;
+}
+#endif
 
-    return mTemporaryTrelKey;
+void KeyManager::AdjacentKeys::Invalidate(void)
+{
+    mMleKey.Clear();
+#if OPENTHREAD_CONFIG_WAKEUP_END_DEVICE_ENABLE
+    mMacKey.Clear();
+#endif
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    mTrelKey.Clear();
+    mHasTrelKey = false;
+#endif
+    mHasHashKeys = false;
 }
+
+void KeyManager::AdjacentKeys::SetFrom(const HashKeys &aHashKeys)
+{
+    mMleKey.SetFrom(aHashKeys.GetMleKey());
+#if OPENTHREAD_CONFIG_WAKEUP_END_DEVICE_ENABLE
+    mMacKey.SetFrom(aHashKeys.GetMacKey());
 #endif
+    mHasHashKeys = true;
+}
 
 void KeyManager::SetAllMacFrameCounters(uint32_t aFrameCounter, bool aSetIfLarger)
 {
@@ -702,6 +820,7 @@ exit:
 void KeyManager::DestroyTemporaryKeys(void)
 {
     mMleKey.Clear();
+    InvalidateAdjacentKeys();
     mKek.Clear();
     mIsKekSet = false;
     Get<Mac::SubMac>().ClearMacKeys();
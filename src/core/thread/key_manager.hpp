@@ -221,6 +221,18 @@ public:
      */
     typedef uint8_t KeySeqUpdateFlags;
 
+    /**
+     * Represents the counters of the cache of key material for the key sequences adjacent to the current one.
+     *
+     * `GetTemporaryMleKey()`, `GetTemporaryMacKey()` and `GetTemporaryTrelMacKey()` cache the keys for the key
+     * sequences just before and after the current one until the key sequence or the network key changes.
+     */
+    struct KeyCacheCounters : public Clearable<KeyCacheCounters>
+    {
+        uint32_t mHits;   ///< Number of temporary key requests for an adjacent key sequence served from the cache.
+        uint32_t mMisses; ///< Number of temporary key requests for an adjacent key sequence which computed the key.
+    };
+
     /**
      * Initializes the object.
      *
@@ -376,6 +388,18 @@ public:
      */
     const Mle::KeyMaterial &GetTemporaryMacKey(uint32_t aKeySequence);
 
+    /**
+     * Returns the counters of the cache of key material for the key sequences adjacent to the current one.
+     *
+     * @returns The key cache counters.
+     */
+    const KeyCacheCounters &GetKeyCacheCounters(void) const { return mKeyCacheCounters; }
+
+    /**
+     * Resets the counters of the cache of key material for the key sequences adjacent to the current one.
+     */
+    void ResetKeyCacheCounters(void) { mKeyCacheCounters.Clear(); }
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
     /**
      * Returns the current MAC Frame Counter value for 15.4 radio link.
@@ -592,8 +616,28 @@ private:
         const Mac::Key &GetMacKey(void) const { return mKeys.mMacKey; }
     };
 
+    struct AdjacentKeys // Cached key material of the key sequence just before or after the current one.
+    {
+        void Invalidate(void);
+        void SetFrom(const HashKeys &aHashKeys);
+
+        Mle::KeyMaterial mMleKey;
+#if OPENTHREAD_CONFIG_WAKEUP_END_DEVICE_ENABLE
+        Mle::KeyMaterial mMacKey;
+#endif
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+        Mac::KeyMaterial mTrelKey;
+        bool             mHasTrelKey;
+#endif
+        bool mHasHashKeys;
+    };
+
     void ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys) const;
 
+    AdjacentKeys       *FindAdjacentKeys(uint32_t aKeySequence);
+    const AdjacentKeys *GetAdjacentHashKeys(uint32_t aKeySequence);
+    void                InvalidateAdjacentKeys(void);
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     void ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aKey) const;
 #endif
@@ -637,6 +681,10 @@ private:
     Mac::KeyMaterial mTemporaryTrelKey;
 #endif
 
+    AdjacentKeys     mPrevKeys;
+    AdjacentKeys     mNextKeys;
+    KeyCacheCounters mKeyCacheCounters;
+
     Mac::LinkFrameCounters mMacFrameCounters;
     uint32_t               mMleFrameCounter;
     uint32_t               mStoredMacFrameCounter;
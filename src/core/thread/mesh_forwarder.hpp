@@ -85,6 +85,7 @@ class MeshForwarder : public InstanceLocator, private NonCopyable
     friend class Mle::DiscoverScanner;
     friend class TimeTicker;
     friend class ot::MessagePool;
+    friend class ot::UnitTester;
 
 public:
     /**
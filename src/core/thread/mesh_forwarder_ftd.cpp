@@ -79,6 +79,10 @@ void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
                 bool destinedForAll = ((destination == Get<Mle::Mle>().GetLinkLocalAllThreadNodesAddress()) ||
                                        (destination == Get<Mle::Mle>().GetRealmLocalAllThreadNodesAddress()));
 
+                // The source match entries of all the sleepy children
+                // are added to the radio together after the loop.
+                Get<SourceMatchController>().DeferAdditions();
+
                 for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
                 {
                     if (!child.IsRxOnWhenIdle() && (destinedForAll || child.HasIp6Address(destination)) &&
@@ -87,6 +91,8 @@ void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
                         mIndirectSender.AddMessageForSleepyChild(message, child);
                     }
                 }
+
+                Get<SourceMatchController>().ApplyDeferredAdditions();
             }
         }
         else // Destination is unicast
@@ -170,6 +170,14 @@ void Leader::FindContextForAddress(const Ip6::Address &aAddress, Lowpan::Context
         aContext.InitForMeshLocalPrefix(GetInstance());
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+    if (mContextTable.IsValid())
+    {
+        mContextTable.FindContextForAddress(aAddress, aContext);
+        ExitNow();
+    }
+#endif
+
     while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
     {
         contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
@@ -184,6 +192,11 @@ void Leader::FindContextForAddress(const Ip6::Address &aAddress, Lowpan::Context
             aContext.InitFrom(*prefixTlv, *contextTlv);
         }
     }
+
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+exit:
+#endif
+    return;
 }
 
 const PrefixTlv *Leader::FindPrefixTlvForContextId(uint8_t aContextId, const ContextTlv *&aContextTlv) const
@@ -218,6 +231,14 @@ void Leader::FindContextForId(uint8_t aContextId, Lowpan::Context &aContext) con
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+    if (mContextTable.IsValid())
+    {
+        mContextTable.FindContextForId(aContextId, aContext);
+        ExitNow();
+    }
+#endif
+
     prefixTlv = FindPrefixTlvForContextId(aContextId, contextTlv);
     VerifyOrExit(prefixTlv != nullptr);
 
@@ -261,21 +282,30 @@ Error Leader::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDest
     Error            error     = kErrorNoRoute;
     const PrefixTlv *prefixTlv = nullptr;
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aSource, prefixTlv)) != nullptr)
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+    if (mRouteTable.IsValid())
     {
-        if (prefixTlv->FindSubTlv<BorderRouterTlv>() == nullptr)
+        VerifyOrExit(mRouteTable.Lookup(*this, aSource, aDestination, aRloc16) != kErrorNone, error = kErrorNone);
+    }
+    else
+#endif
+    {
+        while ((prefixTlv = FindNextMatchingPrefixTlv(aSource, prefixTlv)) != nullptr)
         {
-            continue;
-        }
+            if (prefixTlv->FindSubTlv<BorderRouterTlv>() == nullptr)
+            {
+                continue;
+            }
 
-        if (ExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
-        {
-            ExitNow(error = kErrorNone);
-        }
+            if (ExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
+            {
+                ExitNow(error = kErrorNone);
+            }
 
-        if (DefaultRouteLookup(*prefixTlv, aRloc16) == kErrorNone)
-        {
-            ExitNow(error = kErrorNone);
+            if (DefaultRouteLookup(*prefixTlv, aRloc16) == kErrorNone)
+            {
+                ExitNow(error = kErrorNone);
+            }
         }
     }
 
@@ -362,6 +392,13 @@ Error Leader::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestin
     const HasRouteEntry *bestRouteEntry  = nullptr;
     uint8_t              bestMatchLength = 0;
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+    if (mRouteTable.IsValid())
+    {
+        ExitNow(error = mRouteTable.LookupExternalRoute(*this, aDomainId, aDestination, aRloc16));
+    }
+#endif
+
     while ((prefixTlv = FindNextMatchingPrefixTlv(aDestination, prefixTlv)) != nullptr)
     {
         const HasRouteTlv *hasRoute;
@@ -399,6 +436,9 @@ Error Leader::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestin
         error   = kErrorNone;
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+exit:
+#endif
     return error;
 }
 
@@ -447,6 +487,312 @@ Error Leader::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t &aRloc16) co
     return LookupRouteIn(aPrefix, IsEntryDefaultRoute, aRloc16);
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+
+void Leader::RouteTable::Clear(void)
+{
+    mIsValid     = false;
+    mNumPrefixes = 0;
+    mNumEntries  = 0;
+}
+
+void Leader::RouteTable::Build(const Leader &aLeader)
+{
+    // Compiles every Prefix TLV which has a Border Router sub-TLV
+    // or external route entries, keeping the Network Data TLV order
+    // in `mPrefixes` (which `Lookup()` follows when matching the
+    // source address) and the order of the entries within each
+    // prefix. If the table runs out of space, it is left invalid and
+    // lookups fall back to parsing the Network Data TLVs.
+
+    TlvIterator      tlvIterator(aLeader.GetTlvsStart(), aLeader.GetTlvsEnd());
+    const PrefixTlv *prefixTlv;
+
+    Clear();
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        TlvIterator            hasRouteIterator(*prefixTlv);
+        TlvIterator            brIterator(*prefixTlv);
+        const HasRouteTlv     *hasRoute;
+        const BorderRouterTlv *brTlv;
+        Prefix                *prefix;
+        uint8_t                index;
+
+        VerifyOrExit(mNumPrefixes < kMaxPrefixes);
+
+        prefix = &mPrefixes[mNumPrefixes];
+
+        prefixTlv->CopyPrefixTo(prefix->mPrefix);
+        prefix->mDomainId          = prefixTlv->GetDomainId();
+        prefix->mHasBorderRouter   = false;
+        prefix->mRouteEntriesStart = mNumEntries;
+
+        while ((hasRoute = hasRouteIterator.Iterate<HasRouteTlv>()) != nullptr)
+        {
+            for (const HasRouteEntry *entry = hasRoute->GetFirstEntry(); entry <= hasRoute->GetLastEntry();
+                 entry                      = entry->GetNext())
+            {
+                SuccessOrExit(AddEntry(entry->GetRloc(), entry->GetPreference()));
+            }
+        }
+
+        prefix->mNumRouteEntries     = static_cast<uint8_t>(mNumEntries - prefix->mRouteEntriesStart);
+        prefix->mDefaultEntriesStart = mNumEntries;
+
+        while ((brTlv = brIterator.Iterate<BorderRouterTlv>()) != nullptr)
+        {
+            prefix->mHasBorderRouter = true;
+
+            for (const BorderRouterEntry *entry = brTlv->GetFirstEntry(); entry <= brTlv->GetLastEntry();
+                 entry                          = entry->GetNext())
+            {
+                if (IsEntryDefaultRoute(*entry))
+                {
+                    SuccessOrExit(AddEntry(entry->GetRloc(), entry->GetPreference()));
+                }
+            }
+        }
+
+        prefix->mNumDefaultEntries = static_cast<uint8_t>(mNumEntries - prefix->mDefaultEntriesStart);
+
+        if (!prefix->mHasBorderRouter && (prefix->mNumRouteEntries == 0))
+        {
+            continue;
+        }
+
+        // Insert into `mLengthOrder` after all prefixes with the same
+        // or longer length, so prefixes of equal length stay in the
+        // Network Data TLV order.
+
+        for (index = mNumPrefixes; index > 0; index--)
+        {
+            if (mPrefixes[mLengthOrder[index - 1]].mPrefix.GetLength() >= prefix->mPrefix.GetLength())
+            {
+                break;
+            }
+
+            mLengthOrder[index] = mLengthOrder[index - 1];
+        }
+
+        mLengthOrder[index] = mNumPrefixes;
+        mNumPrefixes++;
+    }
+
+    mIsValid = true;
+
+exit:
+    return;
+}
+
+Error Leader::RouteTable::AddEntry(uint16_t aRloc16, int8_t aPreference)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mNumEntries < kMaxEntries, error = kErrorNoBufs);
+
+    mEntries[mNumEntries].mRloc16     = aRloc16;
+    mEntries[mNumEntries].mPreference = aPreference;
+    mNumEntries++;
+
+exit:
+    return error;
+}
+
+Error Leader::RouteTable::SelectBest(const Leader &aLeader,
+                                     uint8_t       aStart,
+                                     uint8_t       aNumEntries,
+                                     uint16_t     &aRloc16) const
+{
+    Error        error     = kErrorNoRoute;
+    const Entry *bestEntry = nullptr;
+
+    for (const Entry *entry = &mEntries[aStart]; entry < &mEntries[aStart + aNumEntries]; entry++)
+    {
+        if ((bestEntry == nullptr) || aLeader.CompareRouteEntries(entry->mPreference, entry->mRloc16,
+                                                                  bestEntry->mPreference, bestEntry->mRloc16) > 0)
+        {
+            bestEntry = entry;
+        }
+    }
+
+    if (bestEntry != nullptr)
+    {
+        aRloc16 = bestEntry->mRloc16;
+        error   = kErrorNone;
+    }
+
+    return error;
+}
+
+Error Leader::RouteTable::Lookup(const Leader       &aLeader,
+                                 const Ip6::Address &aSource,
+                                 const Ip6::Address &aDestination,
+                                 uint16_t           &aRloc16) const
+{
+    Error error = kErrorNoRoute;
+
+    for (const Prefix *prefix = &mPrefixes[0]; prefix < &mPrefixes[mNumPrefixes]; prefix++)
+    {
+        if (!prefix->mHasBorderRouter || !aSource.MatchesPrefix(prefix->mPrefix))
+        {
+            continue;
+        }
+
+        if (LookupExternalRoute(aLeader, prefix->mDomainId, aDestination, aRloc16) == kErrorNone)
+        {
+            ExitNow(error = kErrorNone);
+        }
+
+        if (SelectBest(aLeader, prefix->mDefaultEntriesStart, prefix->mNumDefaultEntries, aRloc16) == kErrorNone)
+        {
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error Leader::RouteTable::LookupExternalRoute(const Leader       &aLeader,
+                                              uint8_t             aDomainId,
+                                              const Ip6::Address &aDestination,
+                                              uint16_t           &aRloc16) const
+{
+    // Prefixes are visited longest first, so the first matching
+    // prefix with external route entries is the longest match. Among
+    // prefixes of the same length, the first one in the Network Data
+    // is used (same as `ExternalRouteLookup()`).
+
+    Error error = kErrorNoRoute;
+
+    for (uint8_t i = 0; i < mNumPrefixes; i++)
+    {
+        const Prefix &prefix = mPrefixes[mLengthOrder[i]];
+
+        if ((prefix.mNumRouteEntries == 0) || (prefix.mDomainId != aDomainId) ||
+            !aDestination.MatchesPrefix(prefix.mPrefix))
+        {
+            continue;
+        }
+
+        error = SelectBest(aLeader, prefix.mRouteEntriesStart, prefix.mNumRouteEntries, aRloc16);
+        break;
+    }
+
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+
+void Leader::ContextTable::Clear(void)
+{
+    mIsValid     = false;
+    mNumContexts = 0;
+
+    for (uint8_t &index : mIdIndexes)
+    {
+        index = kInvalidIndex;
+    }
+}
+
+void Leader::ContextTable::Build(const Leader &aLeader)
+{
+    // Compiles every Prefix TLV with a Context sub-TLV. For a
+    // Context ID, the first Prefix TLV in the Network Data with that
+    // ID is used (same as `FindPrefixTlvForContextId()`). If the
+    // table runs out of space, it is left invalid and lookups fall
+    // back to parsing the Network Data TLVs.
+
+    TlvIterator      tlvIterator(aLeader.GetTlvsStart(), aLeader.GetTlvsEnd());
+    const PrefixTlv *prefixTlv;
+
+    Clear();
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        const ContextTlv *contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+        Lowpan::Context  *context;
+        uint8_t           index;
+
+        if (contextTlv == nullptr)
+        {
+            continue;
+        }
+
+        VerifyOrExit(mNumContexts < kMaxContexts);
+
+        context = &mContexts[mNumContexts];
+        context->InitFrom(*prefixTlv, *contextTlv);
+
+        if (mIdIndexes[context->GetContextId()] == kInvalidIndex)
+        {
+            mIdIndexes[context->GetContextId()] = mNumContexts;
+        }
+
+        // Insert into `mLengthOrder` after all contexts with the same
+        // or longer prefix length, so contexts of equal length stay in
+        // the Network Data TLV order.
+
+        for (index = mNumContexts; index > 0; index--)
+        {
+            if (mContexts[mLengthOrder[index - 1]].GetPrefix().GetLength() >= context->GetPrefix().GetLength())
+            {
+                break;
+            }
+
+            mLengthOrder[index] = mLengthOrder[index - 1];
+        }
+
+        mLengthOrder[index] = mNumContexts;
+        mNumContexts++;
+    }
+
+    mIsValid = true;
+
+exit:
+    return;
+}
+
+void Leader::ContextTable::FindContextForAddress(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
+{
+    // Contexts are visited longest prefix first, so the first match
+    // is the longest one. It is used only if it is longer than the
+    // prefix of `aContext` (which may be already set to the
+    // mesh-local prefix context).
+
+    for (uint8_t i = 0; i < mNumContexts; i++)
+    {
+        const Lowpan::Context &context = mContexts[mLengthOrder[i]];
+
+        if (context.GetPrefix().GetLength() <= aContext.GetPrefix().GetLength())
+        {
+            break;
+        }
+
+        if (aAddress.MatchesPrefix(context.GetPrefix()))
+        {
+            aContext = context;
+            break;
+        }
+    }
+}
+
+void Leader::ContextTable::FindContextForId(uint8_t aContextId, Lowpan::Context &aContext) const
+{
+    VerifyOrExit(aContextId < kMaxContexts);
+    VerifyOrExit(mIdIndexes[aContextId] != kInvalidIndex);
+
+    aContext = mContexts[mIdIndexes[aContextId]];
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+
 Error Leader::SetNetworkData(uint8_t            aVersion,
                              uint8_t            aStableVersion,
                              Type               aType,
@@ -687,6 +1033,12 @@ Error Leader::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDiscerner
 void Leader::SignalNetDataChanged(void)
 {
     mMaxLength = Max(mMaxLength, GetLength());
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+    mRouteTable.Build(*this);
+#endif
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+    mContextTable.Build(*this);
+#endif
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
@@ -448,6 +448,87 @@ private:
     Error ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
     Error DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t &aRloc16) const;
     Error LookupRouteIn(const PrefixTlv &aPrefixTlv, EntryChecker aEntryChecker, uint16_t &aRloc16) const;
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+    class RouteTable
+    {
+        // Compiled form of the route entries in the Network Data
+        // used by `RouteLookup()`. It is rebuilt whenever the Network
+        // Data changes. The best entry is still selected at lookup
+        // time since `CompareRouteEntries()` depends on the current
+        // mesh path cost to each BR.
+
+    public:
+        void  Clear(void);
+        bool  IsValid(void) const { return mIsValid; }
+        void  Build(const Leader &aLeader);
+        Error Lookup(const Leader       &aLeader,
+                     const Ip6::Address &aSource,
+                     const Ip6::Address &aDestination,
+                     uint16_t           &aRloc16) const;
+        Error LookupExternalRoute(const Leader       &aLeader,
+                                  uint8_t             aDomainId,
+                                  const Ip6::Address &aDestination,
+                                  uint16_t           &aRloc16) const;
+
+    private:
+        static constexpr uint8_t kMaxPrefixes = OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_PREFIXES;
+        static constexpr uint8_t kMaxEntries  = OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_ENTRIES;
+
+        struct Entry
+        {
+            uint16_t mRloc16;
+            int8_t   mPreference;
+        };
+
+        struct Prefix
+        {
+            Ip6::Prefix mPrefix;
+            uint8_t     mDomainId;
+            bool        mHasBorderRouter;     // Prefix TLV contains a Border Router sub-TLV.
+            uint8_t     mRouteEntriesStart;   // Index of the first external route entry in `mEntries`.
+            uint8_t     mNumRouteEntries;     // Number of external route (Has Route) entries.
+            uint8_t     mDefaultEntriesStart; // Index of the first default route BR entry in `mEntries`.
+            uint8_t     mNumDefaultEntries;   // Number of default route BR entries.
+        };
+
+        Error AddEntry(uint16_t aRloc16, int8_t aPreference);
+        Error SelectBest(const Leader &aLeader, uint8_t aStart, uint8_t aNumEntries, uint16_t &aRloc16) const;
+
+        bool    mIsValid;
+        uint8_t mNumPrefixes;
+        uint8_t mNumEntries;
+        uint8_t mLengthOrder[kMaxPrefixes]; // Indexes into `mPrefixes` sorted by prefix length (longest first).
+        Prefix  mPrefixes[kMaxPrefixes];
+        Entry   mEntries[kMaxEntries];
+    };
+#endif
+
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+    class ContextTable
+    {
+        // Compiled 6LoWPAN contexts (Prefix TLVs with a Context
+        // sub-TLV) in the Network Data. It is rebuilt whenever the
+        // Network Data changes.
+
+    public:
+        void Clear(void);
+        bool IsValid(void) const { return mIsValid; }
+        void Build(const Leader &aLeader);
+        void FindContextForAddress(const Ip6::Address &aAddress, Lowpan::Context &aContext) const;
+        void FindContextForId(uint8_t aContextId, Lowpan::Context &aContext) const;
+
+    private:
+        static constexpr uint8_t kMaxContexts  = 16; // Context ID is 4 bits.
+        static constexpr uint8_t kInvalidIndex = NumericLimits<uint8_t>::kMax;
+
+        bool            mIsValid;
+        uint8_t         mNumContexts;
+        uint8_t         mIdIndexes[kMaxContexts];   // Index into `mContexts` for each Context ID.
+        uint8_t         mLengthOrder[kMaxContexts]; // Indexes into `mContexts` sorted by prefix length (longest first).
+        Lowpan::Context mContexts[kMaxContexts];
+    };
+#endif
+
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
     Error ReadCommissioningDataUint16SubTlv(MeshCoP::Tlv::Type aType, uint16_t &aValue) const;
     void  SignalNetDataChanged(void);
@@ -634,6 +715,13 @@ private:
     uint8_t mTlvBuffer[kMaxSize];
     uint8_t mMaxLength;
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+    RouteTable mRouteTable;
+#endif
+#if OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE
+    ContextTable mContextTable;
+#endif
+
 #if OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
     bool mIsClone;
@@ -44,8 +44,16 @@ RegisterLogModule("SrcMatchCtrl");
 SourceMatchController::SourceMatchController(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEnabled(false)
+    , mBatchUpdates(false)
+    , mNumDeferrals(0)
+    , mNumQueuedClears(0)
+    , mUpdateTask(aInstance)
 {
     ClearTable();
+
+    // Giving no entries checks whether the radio supports applying
+    // a list of changes.
+    mBatchUpdates = (Get<Radio::Radio>().UpdateSrcMatchEntries(nullptr, 0) == kErrorNone);
 }
 
 void SourceMatchController::IncrementMessageCount(Child &aChild)
@@ -102,6 +110,19 @@ exit:
     return;
 }
 
+void SourceMatchController::ApplyDeferredAdditions(void)
+{
+    OT_ASSERT(mNumDeferrals > 0);
+
+    mNumDeferrals--;
+
+    VerifyOrExit(mNumDeferrals == 0);
+    UpdateTable();
+
+exit:
+    return;
+}
+
 void SourceMatchController::ClearTable(void)
 {
     Get<Radio::Radio>().ClearSrcMatchShortEntries();
@@ -118,6 +139,29 @@ void SourceMatchController::Enable(bool aEnable)
 
 void SourceMatchController::AddEntry(Child &aChild)
 {
+    if (ShouldBatchUpdates())
+    {
+        // If the removal of the child's address is still queued, the
+        // address is still in the table and nothing needs to change.
+        // Otherwise the address is added right away (or when the
+        // deferred additions are applied) so that the next data
+        // request from the child is acked with frame pending. Any
+        // queued removals are applied first in the same update,
+        // freeing up space in the table.
+
+        if (!CancelQueuedClear(aChild))
+        {
+            aChild.SetIndirectSourceMatchPending(true);
+
+            if (mNumDeferrals == 0)
+            {
+                UpdateTable();
+            }
+        }
+
+        ExitNow();
+    }
+
     aChild.SetIndirectSourceMatchPending(true);
 
     if (!IsEnabled())
@@ -167,6 +211,17 @@ void SourceMatchController::ClearEntry(Child &aChild)
         ExitNow();
     }
 
+    if (ShouldBatchUpdates() && (mNumQueuedClears == kMaxQueuedClears))
+    {
+        UpdateTable();
+    }
+
+    if (ShouldBatchUpdates())
+    {
+        QueueClear(aChild);
+        ExitNow();
+    }
+
     if (aChild.IsIndirectSourceMatchShort())
     {
         error = Get<Radio::Radio>().ClearSrcMatchShortEntry(aChild.GetRloc16());
@@ -197,6 +252,21 @@ Error SourceMatchController::AddPendingEntries(void)
 {
     Error error = kErrorNone;
 
+    if (mBatchUpdates)
+    {
+        error = SendUpdates();
+        VerifyOrExit(error != kErrorNone);
+
+        if (error == kErrorNotImplemented)
+        {
+            mBatchUpdates = false;
+        }
+
+        // The children which did not fit are added one at a time
+        // below, until the table is full.
+        error = kErrorNone;
+    }
+
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
     {
         if (child.IsIndirectSourceMatchPending())
@@ -210,6 +280,174 @@ exit:
     return error;
 }
 
+void SourceMatchController::QueueClear(const Child &aChild)
+{
+    OT_ASSERT(mNumQueuedClears < kMaxQueuedClears);
+
+    InitEntry(mQueuedClears[mNumQueuedClears++], aChild, /* aAdd */ false);
+    mUpdateTask.Post();
+
+    LogDebg("Queued clearing of 0x%04x", aChild.GetRloc16());
+}
+
+bool SourceMatchController::CancelQueuedClear(const Child &aChild)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < mNumQueuedClears; i++)
+    {
+        if (DoesEntryMatch(mQueuedClears[i], aChild))
+        {
+            mQueuedClears[i] = mQueuedClears[--mNumQueuedClears];
+            found            = true;
+            LogDebg("Canceled queued clearing of 0x%04x", aChild.GetRloc16());
+            break;
+        }
+    }
+
+    return found;
+}
+
+void SourceMatchController::UpdateTable(void)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(ShouldBatchUpdates());
+
+    error = SendUpdates();
+
+    if (error == kErrorNotImplemented)
+    {
+        mBatchUpdates = false;
+    }
+
+    if (error != kErrorNone)
+    {
+        // Some of the queued removals may have been applied by the
+        // radio, so the whole table is rebuilt.
+        RebuildTable();
+    }
+
+exit:
+    return;
+}
+
+Error SourceMatchController::SendUpdates(void)
+{
+    Error error = kErrorNone;
+
+    while (true)
+    {
+        otRadioSrcMatchEntry entries[kMaxUpdateEntries];
+        Child               *children[kMaxUpdateEntries];
+        uint8_t              numEntries  = 0;
+        uint8_t              numChildren = 0;
+
+        // The removals go first so that they free up space in the
+        // table for the additions.
+
+        for (; numEntries < mNumQueuedClears; numEntries++)
+        {
+            entries[numEntries] = mQueuedClears[numEntries];
+        }
+
+        for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
+        {
+            if (numEntries == kMaxUpdateEntries)
+            {
+                break;
+            }
+
+            if (child.IsIndirectSourceMatchPending())
+            {
+                InitEntry(entries[numEntries++], child, /* aAdd */ true);
+                children[numChildren++] = &child;
+            }
+        }
+
+        VerifyOrExit(numEntries > 0);
+
+        error = Get<Radio::Radio>().UpdateSrcMatchEntries(entries, numEntries);
+
+        LogDebg("Updating %u entries (%u additions) -- %s (%d)", numEntries, numChildren, ErrorToString(error), error);
+
+        if ((error != kErrorNone) && (error != kErrorNotImplemented) && (numChildren > 0))
+        {
+            // The additions before the failed one may have been
+            // applied. They are removed again, so that the children
+            // still marked as pending are known not to be in the
+            // table. Removing an address which is not in the table is
+            // not an error.
+
+            for (uint8_t i = 0; i < numChildren; i++)
+            {
+                InitEntry(entries[i], *children[i], /* aAdd */ false);
+            }
+
+            IgnoreError(Get<Radio::Radio>().UpdateSrcMatchEntries(entries, numChildren));
+        }
+
+        SuccessOrExit(error);
+
+        mNumQueuedClears = 0;
+
+        for (uint8_t i = 0; i < numChildren; i++)
+        {
+            children[i]->SetIndirectSourceMatchPending(false);
+        }
+    }
+
+exit:
+    return error;
+}
+
+void SourceMatchController::RebuildTable(void)
+{
+    LogInfo("Rebuilding the table");
+
+    ClearTable();
+    mNumQueuedClears = 0;
+
+    // A child whose entry is being added is already marked as
+    // pending, its message count is only incremented afterwards.
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+    {
+        child.SetIndirectSourceMatchPending(child.IsIndirectSourceMatchPending() ||
+                                            (child.GetIndirectMessageCount() > 0));
+    }
+
+    Enable(AddPendingEntries() == kErrorNone);
+}
+
+void SourceMatchController::InitEntry(otRadioSrcMatchEntry &aEntry, const Child &aChild, bool aAdd)
+{
+    ClearAllBytes(aEntry);
+
+    aEntry.mIsShort = aChild.IsIndirectSourceMatchShort();
+    aEntry.mIsAdd   = aAdd;
+
+    if (aEntry.mIsShort)
+    {
+        aEntry.mShortAddress = aChild.GetRloc16();
+    }
+    else
+    {
+        AsCoreType(&aEntry.mExtAddress).Set(aChild.GetExtAddress().m8, Mac::ExtAddress::kReverseByteOrder);
+    }
+}
+
+bool SourceMatchController::DoesEntryMatch(const otRadioSrcMatchEntry &aEntry, const Child &aChild)
+{
+    otRadioSrcMatchEntry entry;
+
+    InitEntry(entry, aChild, aEntry.mIsAdd);
+
+    return (entry.mIsShort == aEntry.mIsShort) &&
+           (entry.mIsShort ? (entry.mShortAddress == aEntry.mShortAddress)
+                           : (AsCoreType(&entry.mExtAddress) == AsCoreType(&aEntry.mExtAddress)));
+}
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
@@ -38,13 +38,17 @@
 
 #if OPENTHREAD_FTD
 
+#include <openthread/platform/radio.h>
+
 #include "common/error.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/tasklet.hpp"
 
 namespace ot {
 
 class Child;
+class UnitTester;
 
 /**
  * @addtogroup core-source-match-controller
@@ -66,9 +70,18 @@ class Child;
  *
  * The source address match table provides the list of children for which there is a pending frame. Either a short
  * address or an extended/long address can be added to the source address match table.
+ *
+ * If the radio supports `otPlatRadioUpdateSrcMatchEntries()`, the removals made while source matching is enabled are
+ * collected and applied from a tasklet with as few calls as possible. Additions are applied immediately, together with
+ * any collected removals, so that a child with a pending frame is never acked without the frame pending bit. A removal
+ * which is canceled by an addition for the same child is never sent to the radio. Additions made between
+ * `DeferAdditions()` and `ApplyDeferredAdditions()` (e.g., a multicast frame queued for many sleepy children) are sent
+ * together, and all the pending entries are added together when source matching is enabled again.
  */
 class SourceMatchController : public InstanceLocator, private NonCopyable
 {
+    friend class ot::UnitTester;
+
 public:
     /**
      * Initializes the object.
@@ -114,7 +127,27 @@ public:
      */
     void SetSrcMatchAsShort(Child &aChild, bool aUseShortAddress);
 
+    /**
+     * Defers giving the additions to the radio until `ApplyDeferredAdditions()` is called.
+     *
+     * Allows the additions for several children made in the same call context to be applied with a single radio call.
+     * The calls can be nested, the additions are applied by the outermost `ApplyDeferredAdditions()`.
+     */
+    void DeferAdditions(void) { mNumDeferrals++; }
+
+    /**
+     * Applies the additions deferred since the matching `DeferAdditions()` call.
+     *
+     * MUST be called before returning from the call context which called `DeferAdditions()`.
+     */
+    void ApplyDeferredAdditions(void);
+
 private:
+    static constexpr uint8_t kMaxQueuedClears  = 8;  // Max number of queued removals.
+    static constexpr uint8_t kMaxUpdateEntries = 16; // Max number of changes given to the radio in one call.
+
+    static_assert(kMaxQueuedClears < kMaxUpdateEntries, "kMaxUpdateEntries MUST be larger than kMaxQueuedClears");
+
     /**
      * Clears the source match table.
      */
@@ -168,12 +201,74 @@ private:
     /**
      * Adds all pending entries to the source match table.
      *
+     * If the radio supports it, the entries are added with as few radio calls as possible. Otherwise, or if the table
+     * cannot fit all of them, they are added one entry at a time until the table is full.
+     *
      * @retval kErrorNone     All pending entries were successfully added.
      * @retval kErrorNoBufs   No available space in the source match table.
      */
     Error AddPendingEntries(void);
 
-    bool mEnabled;
+    /**
+     * Indicates whether removals from the source match table are collected and applied from the update tasklet.
+     *
+     * @retval TRUE   The removals are collected and the changes are applied using `UpdateTable()`.
+     * @retval FALSE  The changes are applied to the radio immediately, one entry at a time.
+     */
+    bool ShouldBatchUpdates(void) const { return mBatchUpdates && mEnabled; }
+
+    /**
+     * Queues the removal of a given child's address from the source match table.
+     *
+     * @param[in] aChild    A reference to the child.
+     */
+    void QueueClear(const Child &aChild);
+
+    /**
+     * Removes a queued removal of a given child's address, if any.
+     *
+     * @param[in] aChild    A reference to the child.
+     *
+     * @retval TRUE   A queued removal was found and removed (the child's address is still in the table).
+     * @retval FALSE  No queued removal was found.
+     */
+    bool CancelQueuedClear(const Child &aChild);
+
+    /**
+     * Applies the queued removals and the pending additions to the source match table.
+     *
+     * If the radio fails to apply the changes, the source match table is rebuilt one entry at a time.
+     */
+    void UpdateTable(void);
+
+    /**
+     * Gives the queued removals and the pending additions to the radio using `otPlatRadioUpdateSrcMatchEntries()`.
+     *
+     * If a call fails, the additions given in that call are removed again, so the children which are still marked as
+     * pending are not in the table.
+     *
+     * @retval kErrorNone            All the changes were applied.
+     * @retval kErrorNoBufs          No available space in the source match table.
+     * @retval kErrorNotImplemented  The radio does not support the update API.
+     */
+    Error SendUpdates(void);
+
+    /**
+     * Rebuilds the source match table one entry at a time.
+     */
+    void RebuildTable(void);
+
+    static void InitEntry(otRadioSrcMatchEntry &aEntry, const Child &aChild, bool aAdd);
+    static bool DoesEntryMatch(const otRadioSrcMatchEntry &aEntry, const Child &aChild);
+
+    using UpdateTask = TaskletIn<SourceMatchController, &SourceMatchController::UpdateTable>;
+
+    bool                 mEnabled;
+    bool                 mBatchUpdates;
+    uint8_t              mNumDeferrals;
+    uint8_t              mNumQueuedClears;
+    otRadioSrcMatchEntry mQueuedClears[kMaxQueuedClears];
+    UpdateTask           mUpdateTask;
 };
 
 /**
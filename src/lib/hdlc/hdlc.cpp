@@ -33,8 +33,10 @@
 #include "hdlc.hpp"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
+#include "lib/spinel/openthread-spinel-config.h"
 
 namespace ot {
 namespace Hdlc {
@@ -49,6 +51,17 @@ namespace Hdlc {
  */
 static uint16_t UpdateFcs(uint16_t aFcs, uint8_t aByte);
 
+/**
+ * Updates an FCS with a sequence of bytes.
+ *
+ * @param[in]  aFcs     The FCS to update.
+ * @param[in]  aData    A pointer to the input bytes.
+ * @param[in]  aLength  The number of bytes in @p aData.
+ *
+ * @returns The updated FCS.
+ */
+static uint16_t UpdateFcs(uint16_t aFcs, const uint8_t *aData, uint16_t aLength);
+
 enum
 {
     kFlagXOn        = 0x11,
@@ -93,6 +106,150 @@ uint16_t UpdateFcs(uint16_t aFcs, uint8_t aByte)
     return (aFcs >> 8) ^ sFcsTable[(aFcs ^ aByte) & 0xff];
 }
 
+#if OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICES > 1
+
+static constexpr uint8_t kFcsSlices = OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICES;
+
+static_assert(kFcsSlices == 4 || kFcsSlices == 8, "HDLC_FCS_SLICES MUST be 1, 4, or 8");
+
+static constexpr uint16_t kFcsPolynomial = 0x8408; ///< Bit-reflected CRC16-CCITT polynomial.
+
+// `MakeValueList<N>::Type` is `ValueList<0, 1, ..., N - 1>`, used to
+// expand the table entries as a parameter pack.
+
+template <uint16_t... kValues> struct ValueList
+{
+};
+
+template <uint16_t kCount, uint16_t... kValues> struct MakeValueList : MakeValueList<kCount - 1, kCount - 1, kValues...>
+{
+};
+
+template <uint16_t... kValues> struct MakeValueList<0, kValues...>
+{
+    typedef ValueList<kValues...> Type;
+};
+
+struct FcsTable
+{
+    uint16_t mEntries[256];
+};
+
+struct FcsTables
+{
+    // `mTables[k].mEntries[b]` is the FCS of byte `b` followed by `k`
+    // zero bytes (starting from a zero FCS).
+
+    FcsTable mTables[kFcsSlices];
+};
+
+static constexpr uint16_t ShiftFcsBits(uint16_t aFcs, uint8_t aNumBits)
+{
+    return (aNumBits == 0) ? aFcs
+                           : ShiftFcsBits(static_cast<uint16_t>((aFcs >> 1) ^ ((aFcs & 1) ? kFcsPolynomial : 0)),
+                                          static_cast<uint8_t>(aNumBits - 1));
+}
+
+template <uint16_t... kValues> static constexpr FcsTable GenerateFcsTable(uint8_t aSlice, ValueList<kValues...>)
+{
+    return FcsTable{{ShiftFcsBits(kValues, static_cast<uint8_t>(8 * (aSlice + 1)))...}};
+}
+
+template <uint16_t... kSlices> static constexpr FcsTables GenerateFcsTables(ValueList<kSlices...>)
+{
+    return FcsTables{{GenerateFcsTable(static_cast<uint8_t>(kSlices), MakeValueList<256>::Type())...}};
+}
+
+/**
+ * The slice-by-N FCS tables, generated at compile time so they are placed in read-only memory.
+ */
+static constexpr FcsTables kFcsTables = GenerateFcsTables(MakeValueList<kFcsSlices>::Type());
+
+#endif // OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICES > 1
+
+uint16_t UpdateFcs(uint16_t aFcs, const uint8_t *aData, uint16_t aLength)
+{
+#if OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICES > 1
+    // The FCS is linear, so feeding `kFcsSlices` bytes is the same as
+    // XORing the FCS of each byte followed by the remaining number of
+    // zero bytes, after the current FCS is XORed into the first two
+    // bytes (the FCS is bit-reflected, so its low byte goes first).
+
+    for (; aLength >= kFcsSlices; aLength -= kFcsSlices, aData += kFcsSlices)
+    {
+        uint16_t fcs = 0;
+
+        for (uint8_t i = 0; i < kFcsSlices; i++)
+        {
+            uint8_t byte = aData[i];
+
+            if (i < sizeof(uint16_t))
+            {
+                byte ^= static_cast<uint8_t>(aFcs >> (8 * i));
+            }
+
+            fcs ^= kFcsTables.mTables[kFcsSlices - 1 - i].mEntries[byte];
+        }
+
+        aFcs = fcs;
+    }
+#endif
+
+    while (aLength-- > 0)
+    {
+        aFcs = UpdateFcs(aFcs, *aData++);
+    }
+
+    return aFcs;
+}
+
+/**
+ * Returns the number of leading bytes in a buffer which are neither an HDLC flag nor an escape byte.
+ *
+ * The buffer is scanned one 32-bit word at a time, using the "has zero byte" bit trick on the word XORed with each of
+ * the two special byte values, before locating the exact byte.
+ *
+ * @param[in]  aData    A pointer to the buffer.
+ * @param[in]  aLength  The number of bytes in @p aData.
+ *
+ * @returns The number of leading bytes in @p aData that can be copied to the frame as is.
+ */
+static uint16_t GetUnescapedSpanLength(const uint8_t *aData, uint16_t aLength)
+{
+    static constexpr uint32_t kLowBits  = 0x01010101;
+    static constexpr uint32_t kHighBits = 0x80808080;
+    static constexpr uint32_t kFlags    = kLowBits * kFlagSequence;
+    static constexpr uint32_t kEscapes  = kLowBits * kEscapeSequence;
+
+    uint16_t length = 0;
+
+    while (aLength - length >= static_cast<uint16_t>(sizeof(uint32_t)))
+    {
+        uint32_t word;
+        uint32_t flags;
+        uint32_t escapes;
+
+        memcpy(&word, &aData[length], sizeof(word));
+
+        flags   = word ^ kFlags;
+        escapes = word ^ kEscapes;
+
+        if ((((flags - kLowBits) & ~flags) | ((escapes - kLowBits) & ~escapes)) & kHighBits)
+        {
+            break;
+        }
+
+        length += sizeof(uint32_t);
+    }
+
+    while ((length < aLength) && (aData[length] != kFlagSequence) && (aData[length] != kEscapeSequence))
+    {
+        length++;
+    }
+
+    return length;
+}
+
 static bool HdlcByteNeedsEscape(uint8_t aByte)
 {
     bool rval;
@@ -132,18 +289,7 @@ otError Encoder::Encode(uint8_t aByte)
 {
     otError error = OT_ERROR_NONE;
 
-    if (HdlcByteNeedsEscape(aByte))
-    {
-        VerifyOrExit(mWritePointer.CanWrite(2), error = OT_ERROR_NO_BUFS);
-
-        IgnoreReturnValue(mWritePointer.WriteByte(kEscapeSequence));
-        IgnoreReturnValue(mWritePointer.WriteByte(aByte ^ 0x20));
-    }
-    else
-    {
-        SuccessOrExit(error = mWritePointer.WriteByte(aByte));
-    }
-
+    SuccessOrExit(error = WriteByte(aByte));
     mFcs = UpdateFcs(mFcs, aByte);
 
 exit:
@@ -153,25 +299,45 @@ exit:
 otError Encoder::Encode(const uint8_t *aData, uint16_t aLength)
 {
     otError                   error      = OT_ERROR_NONE;
-    uint16_t                  oldFcs     = mFcs;
     Spinel::FrameWritePointer oldPointer = mWritePointer;
 
-    while (aLength--)
+    for (uint16_t i = 0; i < aLength; i++)
     {
-        SuccessOrExit(error = Encode(*aData++));
+        SuccessOrExit(error = WriteByte(aData[i]));
     }
 
+    mFcs = UpdateFcs(mFcs, aData, aLength);
+
 exit:
 
     if (error != OT_ERROR_NONE)
     {
         mWritePointer = oldPointer;
-        mFcs          = oldFcs;
     }
 
     return error;
 }
 
+otError Encoder::WriteByte(uint8_t aByte)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (HdlcByteNeedsEscape(aByte))
+    {
+        VerifyOrExit(mWritePointer.CanWrite(2), error = OT_ERROR_NO_BUFS);
+
+        IgnoreReturnValue(mWritePointer.WriteByte(kEscapeSequence));
+        IgnoreReturnValue(mWritePointer.WriteByte(aByte ^ 0x20));
+    }
+    else
+    {
+        SuccessOrExit(error = mWritePointer.WriteByte(aByte));
+    }
+
+exit:
+    return error;
+}
+
 otError Encoder::EndFrame(void)
 {
     otError                   error      = OT_ERROR_NONE;
@@ -223,79 +389,95 @@ void Decoder::Reset(void)
 
 void Decoder::Decode(const uint8_t *aData, uint16_t aLength)
 {
-    while (aLength--)
+    while (aLength > 0)
     {
-        uint8_t byte = *aData++;
+        uint16_t spanLength = 0;
+
+        // While in sync, the bytes up to the next flag or escape byte
+        // are copied into the frame buffer as one block. Flag and
+        // escape bytes, and spans that do not fit in the remaining
+        // buffer space, go through the byte-wise state machine.
 
-        switch (mState)
+        if (mState == kStateSync)
         {
-        case kStateNoSync:
-            if (byte == kFlagSequence)
+            spanLength = GetUnescapedSpanLength(aData, aLength);
+        }
+
+        if ((spanLength > 0) && mWritePointer->CanWrite(spanLength))
+        {
+            mFcs = UpdateFcs(mFcs, aData, spanLength);
+            IgnoreReturnValue(mWritePointer->WriteData(aData, spanLength));
+            mDecodedLength += spanLength;
+        }
+        else
+        {
+            if (spanLength == 0)
             {
-                mState         = kStateSync;
-                mDecodedLength = 0;
-                mFcs           = kInitFcs;
+                spanLength = 1;
             }
 
-            break;
-
-        case kStateSync:
-            switch (byte)
+            for (uint16_t i = 0; i < spanLength; i++)
             {
-            case kEscapeSequence:
-                mState = kStateEscaped;
-                break;
+                DecodeByte(aData[i]);
+            }
+        }
 
-            case kFlagSequence:
+        aData += spanLength;
+        aLength -= spanLength;
+    }
+}
 
-                if (mDecodedLength > 0)
-                {
-                    otError error = OT_ERROR_PARSE;
+void Decoder::DecodeByte(uint8_t aByte)
+{
+    switch (mState)
+    {
+    case kStateNoSync:
+        if (aByte == kFlagSequence)
+        {
+            mState         = kStateSync;
+            mDecodedLength = 0;
+            mFcs           = kInitFcs;
+        }
 
-                    if ((mDecodedLength >= kFcsSize)
-#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-                        && (mFcs == kGoodFcs)
-#endif
-                    )
-                    {
-                        // Remove the FCS from the frame.
-                        mWritePointer->UndoLastWrites(kFcsSize);
-                        error = OT_ERROR_NONE;
-                    }
-
-                    mFrameHandler(mContext, error);
-                }
+        break;
 
-                mDecodedLength = 0;
-                mFcs           = kInitFcs;
-                break;
+    case kStateSync:
+        switch (aByte)
+        {
+        case kEscapeSequence:
+            mState = kStateEscaped;
+            break;
 
-            default:
-                if (mWritePointer->CanWrite(sizeof(uint8_t)))
-                {
-                    mFcs = UpdateFcs(mFcs, byte);
-                    IgnoreReturnValue(mWritePointer->WriteByte(byte));
-                    mDecodedLength++;
-                }
-                else
+        case kFlagSequence:
+
+            if (mDecodedLength > 0)
+            {
+                otError error = OT_ERROR_PARSE;
+
+                if ((mDecodedLength >= kFcsSize)
+#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+                    && (mFcs == kGoodFcs)
+#endif
+                )
                 {
-                    mFrameHandler(mContext, OT_ERROR_NO_BUFS);
-                    mState = kStateNoSync;
+                    // Remove the FCS from the frame.
+                    mWritePointer->UndoLastWrites(kFcsSize);
+                    error = OT_ERROR_NONE;
                 }
 
-                break;
+                mFrameHandler(mContext, error);
             }
 
+            mDecodedLength = 0;
+            mFcs           = kInitFcs;
             break;
 
-        case kStateEscaped:
+        default:
             if (mWritePointer->CanWrite(sizeof(uint8_t)))
             {
-                byte ^= 0x20;
-                mFcs = UpdateFcs(mFcs, byte);
-                IgnoreReturnValue(mWritePointer->WriteByte(byte));
+                mFcs = UpdateFcs(mFcs, aByte);
+                IgnoreReturnValue(mWritePointer->WriteByte(aByte));
                 mDecodedLength++;
-                mState = kStateSync;
             }
             else
             {
@@ -305,6 +487,25 @@ void Decoder::Decode(const uint8_t *aData, uint16_t aLength)
 
             break;
         }
+
+        break;
+
+    case kStateEscaped:
+        if (mWritePointer->CanWrite(sizeof(uint8_t)))
+        {
+            aByte ^= 0x20;
+            mFcs = UpdateFcs(mFcs, aByte);
+            IgnoreReturnValue(mWritePointer->WriteByte(aByte));
+            mDecodedLength++;
+            mState = kStateSync;
+        }
+        else
+        {
+            mFrameHandler(mContext, OT_ERROR_NO_BUFS);
+            mState = kStateNoSync;
+        }
+
+        break;
     }
 }
 
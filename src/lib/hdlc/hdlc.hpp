@@ -107,6 +107,8 @@ public:
     otError EndFrame(void);
 
 private:
+    otError WriteByte(uint8_t aByte);
+
     Spinel::FrameWritePointer &mWritePointer;
     uint16_t                   mFcs;
 };
@@ -171,6 +173,8 @@ private:
         kStateEscaped,
     };
 
+    void DecodeByte(uint8_t aByte);
+
     State                      mState;
     Spinel::FrameWritePointer *mWritePointer;
     FrameHandler               mFrameHandler;
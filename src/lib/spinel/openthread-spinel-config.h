@@ -98,6 +98,27 @@
 #define OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
 #endif
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_MAX_ASYNC_REQUESTS
+ *
+ * The maximum number of asynchronous property requests which `RadioSpinel` can have in flight at the same time.
+ *
+ * The spinel transaction ids (1-15) are shared by the asynchronous requests, the synchronous request and the radio
+ * frame transmission, so this value MUST not be larger than 13.
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_MAX_ASYNC_REQUESTS
+#define OPENTHREAD_SPINEL_CONFIG_MAX_ASYNC_REQUESTS 8
+#endif
+
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_MAX_PROPERTY_RTT_ENTRIES
+ *
+ * The maximum number of spinel properties for which `RadioSpinel` tracks the request round-trip time statistics.
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_MAX_PROPERTY_RTT_ENTRIES
+#define OPENTHREAD_SPINEL_CONFIG_MAX_PROPERTY_RTT_ENTRIES 16
+#endif
+
 /**
  * @def OPENTHREAD_SPINEL_CONFIG_ABORT_ON_UNEXPECTED_RCP_RESET_ENABLE
  *
@@ -107,6 +128,18 @@
 #define OPENTHREAD_SPINEL_CONFIG_ABORT_ON_UNEXPECTED_RCP_RESET_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICES
+ *
+ * Selects the number of bytes processed per iteration when computing the HDLC FCS over a block of bytes.
+ *
+ * - 1: One byte per table lookup (uses only the constant 512-byte table).
+ * - 4 or 8: Slice-by-4 or slice-by-8, which adds `4` or `8` constant tables of 512 bytes (generated at compile time).
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICES
+#define OPENTHREAD_SPINEL_CONFIG_HDLC_FCS_SLICES 1
+#endif
+
 /**
  * @def OPENTHREAD_SPINEL_CONFIG_RCP_TIME_SYNC_INTERVAL
  *
@@ -61,6 +61,8 @@ bool RadioSpinel::sSupportsResetToBootloader = false; ///< RCP supports resettin
 
 bool RadioSpinel::sSupportsLogCrashDump = false; ///< RCP supports logging a crash dump.
 
+bool RadioSpinel::sSupportsSrcMatchUpdate = false; ///< RCP supports `MAC_SRC_MATCH_UPDATE` property.
+
 otRadioCaps RadioSpinel::sRadioCaps = OT_RADIO_CAPS_NONE;
 
 RadioSpinel::RadioSpinel(void)
@@ -72,6 +74,7 @@ RadioSpinel::RadioSpinel(void)
     , mTxRadioTid(0)
     , mWaitingTid(0)
     , mWaitingKey(SPINEL_PROP_LAST_STATUS)
+    , mWaitingSentUs(0)
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
@@ -110,6 +113,7 @@ RadioSpinel::RadioSpinel(void)
     , mRadioTimeRecalcStart(UINT64_MAX)
     , mRadioTimeOffset(UINT64_MAX)
     , mMetrics(mCallbacks)
+    , mNumPropertyRtts(0)
 #if OPENTHREAD_SPINEL_CONFIG_VENDOR_HOOK_ENABLE
     , mVendorRestorePropertiesCallback(nullptr)
     , mVendorRestorePropertiesContext(nullptr)
@@ -123,6 +127,7 @@ RadioSpinel::RadioSpinel(void)
     , mSpinelDriver(nullptr)
 {
     memset(&mCallbacks, 0, sizeof(mCallbacks));
+    memset(mAsyncRequests, 0, sizeof(mAsyncRequests));
 }
 
 void RadioSpinel::Init(bool          aSkipRcpVersionCheck,
@@ -228,6 +233,7 @@ void RadioSpinel::InitializeCaps(bool &aSupportsRcpApiVersion, bool &aSupportsRc
     sSupportsResetToBootloader    = GetSpinelDriver().CoprocessorHasCap(SPINEL_CAP_RCP_RESET_TO_BOOTLOADER);
     aSupportsRcpMinHostApiVersion = GetSpinelDriver().CoprocessorHasCap(SPINEL_CAP_RCP_MIN_HOST_API_VERSION);
     sSupportsLogCrashDump         = GetSpinelDriver().CoprocessorHasCap(SPINEL_CAP_RCP_LOG_CRASH_DUMP);
+    sSupportsSrcMatchUpdate       = GetSpinelDriver().CoprocessorHasCap(SPINEL_CAP_RCP_SRC_MATCH_UPDATE);
 }
 
 otError RadioSpinel::CheckRadioCapabilities(otRadioCaps aRequiredRadioCaps)
@@ -394,6 +400,7 @@ void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
     uint32_t          cmd    = 0;
     spinel_ssize_t    rval   = 0;
     otError           error  = OT_ERROR_NONE;
+    AsyncRequest     *request;
 
     rval = spinel_datatype_unpack(aBuffer, aLength, "CiiD", &header, &cmd, &key, &data, &len);
     VerifyOrExit(rval > 0 && cmd >= SPINEL_CMD_PROP_VALUE_IS && cmd <= SPINEL_CMD_PROP_VALUE_REMOVED,
@@ -401,6 +408,7 @@ void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
 
     if (mWaitingTid == SPINEL_HEADER_GET_TID(header))
     {
+        RecordPropertyRtt(mWaitingKey, mWaitingSentUs);
         HandleWaitingResponse(cmd, key, data, static_cast<uint16_t>(len));
         FreeTid(mWaitingTid);
         mWaitingTid = 0;
@@ -415,6 +423,10 @@ void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
         FreeTid(mTxRadioTid);
         mTxRadioTid = 0;
     }
+    else if ((request = FindAsyncRequest(SPINEL_HEADER_GET_TID(header))) != nullptr)
+    {
+        HandleAsyncResponse(*request, cmd, key, data, static_cast<uint16_t>(len));
+    }
     else
     {
         LogWarn("Unexpected Spinel transaction message: %u", SPINEL_HEADER_GET_TID(header));
@@ -784,6 +796,7 @@ void RadioSpinel::Process(const void *aContext)
     OT_UNUSED_VARIABLE(aContext);
 
     ProcessRadioStateMachine();
+    ProcessAsyncRequests();
     RecoverFromRcpFailure();
 
     if (mTimeSyncEnabled)
@@ -986,16 +999,7 @@ otError RadioSpinel::AddSrcMatchShortEntry(uint16_t aShortAddress)
     SuccessOrExit(error = Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-
-    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
-    {
-        if (mSrcMatchShortEntries[i] == aShortAddress)
-        {
-            ExitNow();
-        }
-    }
-    mSrcMatchShortEntries[mSrcMatchShortEntryCount] = aShortAddress;
-    ++mSrcMatchShortEntryCount;
+    IgnoreReturnValue(SaveSrcMatchShortEntry(aShortAddress));
 #endif
 
 exit:
@@ -1014,16 +1018,7 @@ otError RadioSpinel::AddSrcMatchExtEntry(const otExtAddress &aExtAddress)
                       Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-
-    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
-    {
-        if (memcmp(aExtAddress.m8, mSrcMatchExtEntries[i].m8, OT_EXT_ADDRESS_SIZE) == 0)
-        {
-            ExitNow();
-        }
-    }
-    mSrcMatchExtEntries[mSrcMatchExtEntryCount] = aExtAddress;
-    ++mSrcMatchExtEntryCount;
+    IgnoreReturnValue(SaveSrcMatchExtEntry(aExtAddress));
 #endif
 
 exit:
@@ -1037,15 +1032,7 @@ otError RadioSpinel::ClearSrcMatchShortEntry(uint16_t aShortAddress)
     SuccessOrExit(error = Remove(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
-    {
-        if (mSrcMatchShortEntries[i] == aShortAddress)
-        {
-            mSrcMatchShortEntries[i] = mSrcMatchShortEntries[mSrcMatchShortEntryCount - 1];
-            --mSrcMatchShortEntryCount;
-            break;
-        }
-    }
+    ForgetSrcMatchShortEntry(aShortAddress);
 #endif
 
 exit:
@@ -1060,15 +1047,7 @@ otError RadioSpinel::ClearSrcMatchExtEntry(const otExtAddress &aExtAddress)
                       Remove(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
-    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
-    {
-        if (memcmp(mSrcMatchExtEntries[i].m8, aExtAddress.m8, OT_EXT_ADDRESS_SIZE) == 0)
-        {
-            mSrcMatchExtEntries[i] = mSrcMatchExtEntries[mSrcMatchExtEntryCount - 1];
-            --mSrcMatchExtEntryCount;
-            break;
-        }
-    }
+    ForgetSrcMatchExtEntry(aExtAddress);
 #endif
 
 exit:
@@ -1103,6 +1082,145 @@ exit:
     return error;
 }
 
+otError RadioSpinel::UpdateSrcMatchEntries(const otRadioSrcMatchEntry *aEntries, uint16_t aNumEntries)
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t index = 0;
+
+    VerifyOrExit(sSupportsSrcMatchUpdate, error = OT_ERROR_NOT_IMPLEMENTED);
+
+    while ((index < aNumEntries) && (error == OT_ERROR_NONE))
+    {
+        uint8_t  buffer[kMaxSrcMatchUpdateEntries * kMaxSrcMatchUpdateEntrySize];
+        uint16_t length = 0;
+
+        for (uint8_t count = 0; (count < kMaxSrcMatchUpdateEntries) && (index < aNumEntries); count++, index++)
+        {
+            const otRadioSrcMatchEntry &entry = aEntries[index];
+            uint8_t                     flags = entry.mIsAdd ? SPINEL_SRC_MATCH_ENTRY_FLAG_ADD : 0;
+            spinel_ssize_t              packed;
+
+            if (entry.mIsShort)
+            {
+                flags |= SPINEL_SRC_MATCH_ENTRY_FLAG_SHORT;
+                packed = spinel_datatype_pack(&buffer[length], sizeof(buffer) - length,
+                                              SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT16_S, flags,
+                                              entry.mShortAddress);
+            }
+            else
+            {
+                packed = spinel_datatype_pack(&buffer[length], sizeof(buffer) - length,
+                                              SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_EUI64_S, flags,
+                                              entry.mExtAddress.m8);
+            }
+
+            assert(packed > 0 && static_cast<size_t>(packed) <= sizeof(buffer) - length);
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+            if (!entry.mIsAdd)
+            {
+                if (entry.mIsShort)
+                {
+                    ForgetSrcMatchShortEntry(entry.mShortAddress);
+                }
+                else
+                {
+                    ForgetSrcMatchExtEntry(entry.mExtAddress);
+                }
+            }
+            else if ((error = entry.mIsShort ? SaveSrcMatchShortEntry(entry.mShortAddress)
+                                             : SaveSrcMatchExtEntry(entry.mExtAddress)) != OT_ERROR_NONE)
+            {
+                // The entries which are already packed are still sent
+                // so that the RCP and the saved table stay in sync.
+                break;
+            }
+#endif
+
+            length += static_cast<uint16_t>(packed);
+        }
+
+        if (length > 0)
+        {
+            otError setError = Set(SPINEL_PROP_MAC_SRC_MATCH_UPDATE, SPINEL_DATATYPE_DATA_S, buffer, length);
+
+            error = (error == OT_ERROR_NONE) ? setError : error;
+        }
+    }
+
+exit:
+    LogIfFail("Update source match entries failed", error);
+    return error;
+}
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+otError RadioSpinel::SaveSrcMatchShortEntry(uint16_t aShortAddress)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
+    {
+        if (mSrcMatchShortEntries[i] == aShortAddress)
+        {
+            ExitNow();
+        }
+    }
+
+    VerifyOrExit(mSrcMatchShortEntryCount < OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES, error = OT_ERROR_NO_BUFS);
+    mSrcMatchShortEntries[mSrcMatchShortEntryCount] = aShortAddress;
+    ++mSrcMatchShortEntryCount;
+
+exit:
+    return error;
+}
+
+otError RadioSpinel::SaveSrcMatchExtEntry(const otExtAddress &aExtAddress)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
+    {
+        if (memcmp(aExtAddress.m8, mSrcMatchExtEntries[i].m8, OT_EXT_ADDRESS_SIZE) == 0)
+        {
+            ExitNow();
+        }
+    }
+
+    VerifyOrExit(mSrcMatchExtEntryCount < OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES, error = OT_ERROR_NO_BUFS);
+    mSrcMatchExtEntries[mSrcMatchExtEntryCount] = aExtAddress;
+    ++mSrcMatchExtEntryCount;
+
+exit:
+    return error;
+}
+
+void RadioSpinel::ForgetSrcMatchShortEntry(uint16_t aShortAddress)
+{
+    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
+    {
+        if (mSrcMatchShortEntries[i] == aShortAddress)
+        {
+            mSrcMatchShortEntries[i] = mSrcMatchShortEntries[mSrcMatchShortEntryCount - 1];
+            --mSrcMatchShortEntryCount;
+            break;
+        }
+    }
+}
+
+void RadioSpinel::ForgetSrcMatchExtEntry(const otExtAddress &aExtAddress)
+{
+    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
+    {
+        if (memcmp(mSrcMatchExtEntries[i].m8, aExtAddress.m8, OT_EXT_ADDRESS_SIZE) == 0)
+        {
+            mSrcMatchExtEntries[i] = mSrcMatchExtEntries[mSrcMatchExtEntryCount - 1];
+            --mSrcMatchExtEntryCount;
+            break;
+        }
+    }
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+
 otError RadioSpinel::GetTransmitPower(int8_t &aPower)
 {
     otError error = Get(SPINEL_PROP_PHY_TX_POWER, SPINEL_DATATYPE_INT8_S, &aPower);
@@ -1473,9 +1591,10 @@ otError RadioSpinel::RequestV(uint32_t command, spinel_prop_key_t aKey, const ch
     }
     else
     {
-        mWaitingKey = aKey;
-        mWaitingTid = tid;
-        error       = WaitResponse();
+        mWaitingKey    = aKey;
+        mWaitingTid    = tid;
+        mWaitingSentUs = otPlatTimeGet();
+        error          = WaitResponse();
     }
 
 exit:
@@ -1537,6 +1656,295 @@ otError RadioSpinel::RequestWithExpectedCommandV(uint32_t          aExpectedComm
     return error;
 }
 
+otError RadioSpinel::SetAsync(spinel_prop_key_t    aKey,
+                              AsyncRequestCallback aCallback,
+                              void                *aContext,
+                              const char          *aFormat,
+                              ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error =
+        AsyncRequestV(SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET, aKey, aCallback, aContext, aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+otError RadioSpinel::InsertAsync(spinel_prop_key_t    aKey,
+                                 AsyncRequestCallback aCallback,
+                                 void                *aContext,
+                                 const char          *aFormat,
+                                 ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = AsyncRequestV(SPINEL_CMD_PROP_VALUE_INSERTED, SPINEL_CMD_PROP_VALUE_INSERT, aKey, aCallback, aContext,
+                          aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+otError RadioSpinel::RemoveAsync(spinel_prop_key_t    aKey,
+                                 AsyncRequestCallback aCallback,
+                                 void                *aContext,
+                                 const char          *aFormat,
+                                 ...)
+{
+    otError error;
+    va_list args;
+
+    va_start(args, aFormat);
+    error = AsyncRequestV(SPINEL_CMD_PROP_VALUE_REMOVED, SPINEL_CMD_PROP_VALUE_REMOVE, aKey, aCallback, aContext,
+                          aFormat, args);
+    va_end(args);
+
+    return error;
+}
+
+otError RadioSpinel::AsyncRequestV(uint32_t             aExpectedCommand,
+                                   uint32_t             aCommand,
+                                   spinel_prop_key_t    aKey,
+                                   AsyncRequestCallback aCallback,
+                                   void                *aContext,
+                                   const char          *aFormat,
+                                   va_list              aArgs)
+{
+    otError       error   = OT_ERROR_NONE;
+    AsyncRequest *request = FindAsyncRequest(0);
+    spinel_tid_t  tid;
+
+    VerifyOrExit(request != nullptr, error = OT_ERROR_BUSY);
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    RecoverFromRcpFailure();
+#endif
+
+    tid = GetNextTid();
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    error = GetSpinelDriver().SendCommand(aCommand, aKey, tid, aFormat, aArgs);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    request->mTid             = tid;
+    request->mKey             = aKey;
+    request->mExpectedCommand = aExpectedCommand;
+    request->mSentTimeUs      = otPlatTimeGet();
+    request->mCallback        = aCallback;
+    request->mContext         = aContext;
+
+exit:
+    LogIfFail("Failed to send async request", error);
+    return error;
+}
+
+RadioSpinel::AsyncRequest *RadioSpinel::FindAsyncRequest(spinel_tid_t aTid)
+{
+    AsyncRequest *rval = nullptr;
+
+    for (AsyncRequest &request : mAsyncRequests)
+    {
+        if (request.mTid == aTid)
+        {
+            rval = &request;
+            break;
+        }
+    }
+
+    return rval;
+}
+
+bool RadioSpinel::HasPendingAsyncRequests(void) const
+{
+    bool hasPending = false;
+
+    for (const AsyncRequest &request : mAsyncRequests)
+    {
+        if (request.mTid != 0)
+        {
+            hasPending = true;
+            break;
+        }
+    }
+
+    return hasPending;
+}
+
+void RadioSpinel::HandleAsyncResponse(AsyncRequest     &aRequest,
+                                      uint32_t          aCommand,
+                                      spinel_prop_key_t aKey,
+                                      const uint8_t    *aBuffer,
+                                      uint16_t          aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    RecordPropertyRtt(aRequest.mKey, aRequest.mSentTimeUs);
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(status);
+    }
+    else if ((aKey != aRequest.mKey) || (aCommand != aRequest.mExpectedCommand))
+    {
+        error = OT_ERROR_DROP;
+    }
+
+exit:
+    UpdateParseErrorCount(error);
+    FinishAsyncRequest(aRequest, error);
+}
+
+void RadioSpinel::FinishAsyncRequest(AsyncRequest &aRequest, otError aError)
+{
+    AsyncRequestCallback callback = aRequest.mCallback;
+    void                *context  = aRequest.mContext;
+    spinel_prop_key_t    key      = aRequest.mKey;
+
+    if (aError != OT_ERROR_NONE)
+    {
+        LogWarn("Async request for key %lu failed: %s", ToUlong(key), otThreadErrorToString(aError));
+    }
+
+    FreeTid(aRequest.mTid);
+    aRequest.mTid = 0;
+
+    if (callback != nullptr)
+    {
+        callback(aError, key, context);
+    }
+}
+
+void RadioSpinel::FinishAllAsyncRequests(otError aError)
+{
+    for (AsyncRequest &request : mAsyncRequests)
+    {
+        if (request.mTid != 0)
+        {
+            FinishAsyncRequest(request, aError);
+        }
+    }
+}
+
+void RadioSpinel::ProcessAsyncRequests(void)
+{
+    uint64_t now = otPlatTimeGet();
+
+    for (const AsyncRequest &request : mAsyncRequests)
+    {
+        if ((request.mTid != 0) && (now - request.mSentTimeUs >= kMaxWaitTime * kUsPerMs))
+        {
+            LogWarn("Wait for async response timeout");
+            HandleRcpTimeout();
+            FinishAllAsyncRequests(OT_ERROR_RESPONSE_TIMEOUT);
+            break;
+        }
+    }
+}
+
+otError RadioSpinel::WaitAsyncRequests(void)
+{
+    otError  error = OT_ERROR_NONE;
+    uint64_t end   = otPlatTimeGet() + kMaxWaitTime * kUsPerMs;
+
+    assert(mWaitingTid == 0);
+
+    while (HasPendingAsyncRequests())
+    {
+        uint64_t now = otPlatTimeGet();
+
+        if ((end <= now) || (GetSpinelDriver().GetSpinelInterface()->WaitForFrame(end - now) != OT_ERROR_NONE))
+        {
+            LogWarn("Wait for async responses timeout");
+            HandleRcpTimeout();
+            FinishAllAsyncRequests(OT_ERROR_RESPONSE_TIMEOUT);
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+        if (mRcpFailure != kRcpFailureNone)
+        {
+            FinishAllAsyncRequests(OT_ERROR_ABORT);
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+#endif
+    }
+
+exit:
+    return error;
+}
+
+void RadioSpinel::HandleAsyncRequestDone(otError aError, spinel_prop_key_t aKey, void *aContext)
+{
+    // `aContext` points to an `otError` which keeps the first error
+    // of a group of asynchronous requests.
+
+    otError &error = *static_cast<otError *>(aContext);
+
+    OT_UNUSED_VARIABLE(aKey);
+
+    if (error == OT_ERROR_NONE)
+    {
+        error = aError;
+    }
+}
+
+void RadioSpinel::RecordPropertyRtt(spinel_prop_key_t aKey, uint64_t aSentTimeUs)
+{
+    uint32_t                  rtt   = static_cast<uint32_t>(otPlatTimeGet() - aSentTimeUs);
+    otRadioSpinelPropertyRtt *entry = nullptr;
+
+    for (uint8_t i = 0; i < mNumPropertyRtts; i++)
+    {
+        if (mPropertyRtts[i].mPropertyKey == aKey)
+        {
+            entry = &mPropertyRtts[i];
+            break;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        VerifyOrExit(mNumPropertyRtts < kMaxPropertyRtts);
+
+        entry = &mPropertyRtts[mNumPropertyRtts++];
+        memset(entry, 0, sizeof(*entry));
+        entry->mPropertyKey = aKey;
+        entry->mMinRttUs    = UINT32_MAX;
+    }
+
+    entry->mNumRequests++;
+    entry->mTotalRttUs += rtt;
+    entry->mMinRttUs = (rtt < entry->mMinRttUs) ? rtt : entry->mMinRttUs;
+    entry->mMaxRttUs = (rtt > entry->mMaxRttUs) ? rtt : entry->mMaxRttUs;
+
+exit:
+    return;
+}
+
+otError RadioSpinel::GetNextPropertyRtt(uint8_t &aIterator, otRadioSpinelPropertyRtt &aRtt) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aIterator < mNumPropertyRtts, error = OT_ERROR_NOT_FOUND);
+    aRtt = mPropertyRtts[aIterator++];
+
+exit:
+    return error;
+}
+
 void RadioSpinel::HandleTransmitDone(uint32_t          aCommand,
                                      spinel_prop_key_t aKey,
                                      const uint8_t    *aBuffer,
@@ -1701,23 +2109,54 @@ exit:
 
 otError RadioSpinel::Receive(uint8_t aChannel)
 {
-    otError error = OT_ERROR_NONE;
+    otError error          = OT_ERROR_NONE;
+    otError channelError   = OT_ERROR_NONE;
+    bool    channelPending = false;
 
     VerifyOrExit(mState != kStateDisabled, error = OT_ERROR_INVALID_STATE);
 
     if (mChannel != aChannel)
     {
-        error = Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
-        SuccessOrExit(error);
-        mChannel = aChannel;
+        if (mState == kStateSleep)
+        {
+            // Do not wait for the response of the channel change, so
+            // that it shares the round trip with enabling the receiver.
+            SuccessOrExit(error = SetAsync(SPINEL_PROP_PHY_CHAN, HandleAsyncRequestDone, &channelError,
+                                           SPINEL_DATATYPE_UINT8_S, aChannel));
+            channelPending = true;
+        }
+        else
+        {
+            error = Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
+            SuccessOrExit(error);
+            mChannel = aChannel;
+        }
     }
 
     if (mState == kStateSleep)
     {
         error = Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
-        SuccessOrExit(error);
     }
 
+    if (channelPending)
+    {
+        // The RCP handles the requests in order, so the channel change
+        // has normally completed already. `channelError` is updated by
+        // `HandleAsyncRequestDone()` before `WaitAsyncRequests()` returns.
+        IgnoreReturnValue(WaitAsyncRequests());
+
+        if (channelError == OT_ERROR_NONE)
+        {
+            mChannel = aChannel;
+        }
+        else if (error == OT_ERROR_NONE)
+        {
+            error = channelError;
+        }
+    }
+
+    SuccessOrExit(error);
+
     if (mTxRadioTid != 0)
     {
         FreeTid(mTxRadioTid);
@@ -2044,6 +2483,8 @@ void RadioSpinel::RecoverFromRcpFailure(void)
     constexpr int16_t kMaxFailureCount = OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT;
     State             recoveringState  = mState;
     bool              skipReset        = false;
+    uint64_t          startTime;
+    uint32_t          duration;
 
     VerifyOrExit(mRcpRestorationEnabled);
 
@@ -2060,6 +2501,8 @@ void RadioSpinel::RecoverFromRcpFailure(void)
 
     LogWarn("RCP failure detected");
 
+    startTime = otPlatTimeGet();
+
     mMetrics.IncrementRcpRestorationCount();
     ++mRcpFailureCount;
     if (mRcpFailureCount > kMaxFailureCount)
@@ -2090,6 +2533,8 @@ void RadioSpinel::RecoverFromRcpFailure(void)
         GetSpinelDriver().ResetCoprocessor(mResetRadioOnStartup);
     }
 
+    FinishAllAsyncRequests(OT_ERROR_ABORT);
+
     mCmdTidsInUse = 0;
     mCmdNextTid   = 1;
     mTxRadioTid   = 0;
@@ -2138,7 +2583,10 @@ void RadioSpinel::RecoverFromRcpFailure(void)
 
     --mRcpFailureCount;
 
-    LogNote("RCP recovery is done");
+    duration = static_cast<uint32_t>(otPlatTimeGet() - startTime);
+    mMetrics.RecordRcpRestorationTime(duration);
+
+    LogNote("RCP recovery is done in %lu us", ToUlong(duration));
 
 exit:
     return;
@@ -2177,23 +2625,34 @@ void RadioSpinel::HandleSavedFrame(const uint8_t *aFrame, uint16_t aLength) { Ha
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 void RadioSpinel::RestoreProperties(void)
 {
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId));
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress));
-    SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8));
+    // The properties are restored with pipelined requests, so that the
+    // RCP recovery does not wait for a round trip per property. `error`
+    // keeps the first error reported by the RCP.
+
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrDie(SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_MAC_15_4_PANID,
+                                    SPINEL_DATATYPE_UINT16_S, mPanId));
+    SuccessOrDie(SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_MAC_15_4_SADDR,
+                                    SPINEL_DATATYPE_UINT16_S, mShortAddress));
+    SuccessOrDie(SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_MAC_15_4_LADDR,
+                                    SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8));
 #if OPENTHREAD_CONFIG_MULTIPAN_RCP_ENABLE
     // In case multiple PANs are running, don't force RCP to change channel.
-    IgnoreReturnValue(Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel));
+    IgnoreReturnValue(SendRestoreRequest(nullptr, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_PHY_CHAN,
+                                         SPINEL_DATATYPE_UINT8_S, mChannel));
 #else
-    SuccessOrDie(Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel));
+    SuccessOrDie(
+        SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel));
 #endif
 
     if (mMacKeySet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_RCP_MAC_KEY,
-                         SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
-                             SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
-                         mKeyIdMode, mKeyId, mPrevKey.m8, sizeof(otMacKey), mCurrKey.m8, sizeof(otMacKey), mNextKey.m8,
-                         sizeof(otMacKey)));
+        SuccessOrDie(SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_RCP_MAC_KEY,
+                                        SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
+                                            SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                        mKeyIdMode, mKeyId, mPrevKey.m8, sizeof(otMacKey), mCurrKey.m8,
+                                        sizeof(otMacKey), mNextKey.m8, sizeof(otMacKey)));
     }
 
     if (mMacFrameCounterSet)
@@ -2210,74 +2669,78 @@ void RadioSpinel::RestoreProperties(void)
         // CounterGuard: 2000ms(Timeout) / [(28bytes(Data) + 29bytes(Ack)) * 32us/byte + 192us(Ifs)] = 992
         static constexpr uint16_t kFrameCounterGuard = 1000;
 
-        SuccessOrDie(Set(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S,
-                         otLinkGetFrameCounter(mInstance) + kFrameCounterGuard));
+        SuccessOrDie(SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_RCP_MAC_FRAME_COUNTER,
+                                        SPINEL_DATATYPE_UINT32_S,
+                                        otLinkGetFrameCounter(mInstance) + kFrameCounterGuard));
     }
 
-    SuccessOrDie(Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, nullptr));
-
-    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
-    {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, mSrcMatchShortEntries[i]));
-    }
-
-    SuccessOrDie(Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, nullptr));
-
-    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
-    {
-        SuccessOrDie(
-            Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, mSrcMatchExtEntries[i].m8));
-    }
+    SuccessOrDie(RestoreSrcMatchTable(/* aIsShort */ true, &error));
+    SuccessOrDie(RestoreSrcMatchTable(/* aIsShort */ false, &error));
 
     if (mSrcMatchSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, mSrcMatchEnabled));
+        SuccessOrDie(SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_MAC_SRC_MATCH_ENABLED,
+                                        SPINEL_DATATYPE_BOOL_S, mSrcMatchEnabled));
     }
 
     if (mCcaEnergyDetectThresholdSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold));
+        SuccessOrDie(SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_PHY_CCA_THRESHOLD,
+                                        SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold));
     }
 
     if (mTransmitPowerSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_TX_POWER, SPINEL_DATATYPE_INT8_S, mTransmitPower));
+        SuccessOrDie(SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_PHY_TX_POWER,
+                                        SPINEL_DATATYPE_INT8_S, mTransmitPower));
     }
 
     if (mCoexEnabledSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_RADIO_COEX_ENABLE, SPINEL_DATATYPE_BOOL_S, mCoexEnabled));
+        SuccessOrDie(SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_RADIO_COEX_ENABLE,
+                                        SPINEL_DATATYPE_BOOL_S, mCoexEnabled));
     }
 
     if (mFemLnaGainSet)
     {
-        SuccessOrDie(Set(SPINEL_PROP_PHY_FEM_LNA_GAIN, SPINEL_DATATYPE_INT8_S, mFemLnaGain));
+        SuccessOrDie(SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_PHY_FEM_LNA_GAIN,
+                                        SPINEL_DATATYPE_INT8_S, mFemLnaGain));
     }
 
 #if OPENTHREAD_POSIX_CONFIG_MAX_POWER_TABLE_ENABLE
-    for (uint8_t channel = Radio::kChannelMin; channel <= Radio::kChannelMax; channel++)
     {
-        int8_t power = mMaxPowerTable.GetTransmitPower(channel);
+        otError powerError = OT_ERROR_NONE;
 
-        if (power != OT_RADIO_POWER_INVALID)
+        for (uint8_t channel = Radio::kChannelMin; channel <= Radio::kChannelMax; channel++)
         {
-            // Some old RCPs doesn't support max transmit power
-            otError error = SetChannelMaxTransmitPower(channel, power);
+            int8_t power = mMaxPowerTable.GetTransmitPower(channel);
 
-            if (error != OT_ERROR_NONE && error != OT_ERROR_NOT_FOUND)
+            if (power != OT_RADIO_POWER_INVALID)
             {
-                DieNow(OT_EXIT_FAILURE);
+                SuccessOrDie(SendRestoreRequest(&powerError, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_PHY_CHAN_MAX_POWER,
+                                                SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_INT8_S, channel, power));
             }
         }
+
+        SuccessOrDie(WaitAsyncRequests());
+
+        // Some old RCPs doesn't support max transmit power
+        if (powerError != OT_ERROR_NONE && powerError != OT_ERROR_NOT_FOUND)
+        {
+            DieNow(OT_EXIT_FAILURE);
+        }
     }
 #endif // OPENTHREAD_POSIX_CONFIG_MAX_POWER_TABLE_ENABLE
 
     if ((sRadioCaps & OT_RADIO_CAPS_RX_ON_WHEN_IDLE) != 0)
     {
-        SuccessOrDie(Set(SPINEL_PROP_MAC_RX_ON_WHEN_IDLE_MODE, SPINEL_DATATYPE_BOOL_S, mRxOnWhenIdle));
+        SuccessOrDie(SendRestoreRequest(&error, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_MAC_RX_ON_WHEN_IDLE_MODE,
+                                        SPINEL_DATATYPE_BOOL_S, mRxOnWhenIdle));
     }
 
+    SuccessOrDie(WaitAsyncRequests());
+    SuccessOrDie(error);
+
 #if OPENTHREAD_SPINEL_CONFIG_VENDOR_HOOK_ENABLE
     if (mVendorRestorePropertiesCallback)
     {
@@ -2290,6 +2753,92 @@ void RadioSpinel::RestoreProperties(void)
         CalcRcpTimeOffset();
     }
 }
+
+otError RadioSpinel::SendRestoreRequest(otError          *aResult,
+                                        uint32_t          aCommand,
+                                        spinel_prop_key_t aKey,
+                                        const char       *aFormat,
+                                        ...)
+{
+    // Sends a request without waiting for its response. The first
+    // error reported by the RCP is kept in `aResult` (errors are
+    // ignored when it is `nullptr`).
+
+    otError  error           = OT_ERROR_NONE;
+    uint32_t expectedCommand = (aCommand == SPINEL_CMD_PROP_VALUE_INSERT) ? SPINEL_CMD_PROP_VALUE_INSERTED
+                                                                         : SPINEL_CMD_PROP_VALUE_IS;
+    va_list  args;
+
+    if (FindAsyncRequest(0) == nullptr)
+    {
+        SuccessOrExit(error = WaitAsyncRequests());
+    }
+
+    va_start(args, aFormat);
+    error = AsyncRequestV(expectedCommand, aCommand, aKey, (aResult != nullptr) ? HandleAsyncRequestDone : nullptr,
+                          aResult, aFormat, args);
+    va_end(args);
+
+exit:
+    return error;
+}
+
+otError RadioSpinel::RestoreSrcMatchTable(bool aIsShort, otError *aResult)
+{
+    // The first request replaces the whole list on the RCP with as
+    // many entries as fit in one frame. Any remaining entries are
+    // then inserted one at a time.
+
+    spinel_prop_key_t key       = aIsShort ? SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES
+                                           : SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES;
+    uint16_t          count     = aIsShort ? mSrcMatchShortEntryCount : mSrcMatchExtEntryCount;
+    uint16_t          entrySize = aIsShort ? sizeof(uint16_t) : sizeof(otExtAddress);
+    uint16_t          index     = 0;
+    uint16_t          length    = 0;
+    otError           error;
+    uint8_t           buffer[kMaxSrcMatchRestoreSize];
+
+    for (; (index < count) && (length + entrySize <= sizeof(buffer)); index++)
+    {
+        spinel_ssize_t packed;
+
+        if (aIsShort)
+        {
+            packed = spinel_datatype_pack(&buffer[length], sizeof(buffer) - length, SPINEL_DATATYPE_UINT16_S,
+                                          mSrcMatchShortEntries[index]);
+        }
+        else
+        {
+            packed = spinel_datatype_pack(&buffer[length], sizeof(buffer) - length, SPINEL_DATATYPE_EUI64_S,
+                                          mSrcMatchExtEntries[index].m8);
+        }
+
+        assert(packed == entrySize);
+        length += static_cast<uint16_t>(packed);
+    }
+
+    SuccessOrExit(error = SendRestoreRequest(aResult, SPINEL_CMD_PROP_VALUE_SET, key, SPINEL_DATATYPE_DATA_S, buffer,
+                                             length));
+
+    for (; index < count; index++)
+    {
+        if (aIsShort)
+        {
+            error = SendRestoreRequest(aResult, SPINEL_CMD_PROP_VALUE_INSERT, key, SPINEL_DATATYPE_UINT16_S,
+                                       mSrcMatchShortEntries[index]);
+        }
+        else
+        {
+            error = SendRestoreRequest(aResult, SPINEL_CMD_PROP_VALUE_INSERT, key, SPINEL_DATATYPE_EUI64_S,
+                                       mSrcMatchExtEntries[index].m8);
+        }
+
+        SuccessOrExit(error);
+    }
+
+exit:
+    return error;
+}
 #endif // OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 
 otError RadioSpinel::GetMultipanActiveInterface(spinel_iid_t *aIid)
@@ -2523,5 +3072,20 @@ void RadioSpinel::MetricsTracker::IncrementCount(MetricType aType)
     SaveMetrics();
 }
 
+void RadioSpinel::MetricsTracker::RecordRcpRestorationTime(uint32_t aTimeUs)
+{
+    RestoreMetrics();
+
+    mMetrics.mLastRcpRestorationTimeUs = aTimeUs;
+    mMetrics.mTotalRcpRestorationTimeUs += aTimeUs;
+
+    if (aTimeUs > mMetrics.mMaxRcpRestorationTimeUs)
+    {
+        mMetrics.mMaxRcpRestorationTimeUs = aTimeUs;
+    }
+
+    SaveMetrics();
+}
+
 } // namespace Spinel
 } // namespace ot
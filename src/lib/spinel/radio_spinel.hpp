@@ -529,6 +529,23 @@ public:
      */
     otError ClearSrcMatchExtEntries(void);
 
+    /**
+     * Applies a list of changes to the source address match table.
+     *
+     * The changes are sent to the RCP using as few `SPINEL_PROP_MAC_SRC_MATCH_UPDATE` requests as possible. The
+     * extended addresses in @p aEntries are in little-endian byte order, as in `otPlatRadioUpdateSrcMatchEntries()`.
+     *
+     * @param[in]  aEntries     A pointer to the array of changes.
+     * @param[in]  aNumEntries  The number of entries in @p aEntries.
+     *
+     * @retval  OT_ERROR_NONE               Successfully applied all the changes.
+     * @retval  OT_ERROR_NOT_IMPLEMENTED    The RCP does not support `SPINEL_PROP_MAC_SRC_MATCH_UPDATE`.
+     * @retval  OT_ERROR_NO_BUFS            No available entry in the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     */
+    otError UpdateSrcMatchEntries(const otRadioSrcMatchEntry *aEntries, uint16_t aNumEntries);
+
     /**
      * Begins the energy scan sequence on the radio.
      *
@@ -936,6 +953,114 @@ public:
      */
     otError Remove(spinel_prop_key_t aKey, const char *aFormat, ...);
 
+    /**
+     * Pointer to a function called when an asynchronous property request completes.
+     *
+     * The callback is invoked while the response frame is processed, which can happen while a synchronous request
+     * (e.g., `Set()`) waits for its own response. Therefore the callback MUST NOT issue any synchronous request.
+     *
+     * @param[in] aError    The result of the request:
+     *                      - OT_ERROR_NONE if the request succeeded.
+     *                      - OT_ERROR_RESPONSE_TIMEOUT if no response was received from the transceiver.
+     *                      - OT_ERROR_ABORT if the request was aborted by an RCP recovery.
+     *                      - Otherwise, the error reported by the transceiver.
+     * @param[in] aKey      The spinel property key of the request.
+     * @param[in] aContext  The arbitrary context provided when the request was sent.
+     */
+    typedef void (*AsyncRequestCallback)(otError aError, spinel_prop_key_t aKey, void *aContext);
+
+    /**
+     * Sends a request to update a spinel property of OpenThread transceiver without waiting for its response.
+     *
+     * Multiple asynchronous requests (up to `OPENTHREAD_SPINEL_CONFIG_MAX_ASYNC_REQUESTS`) can be in flight at the
+     * same time, each using its own spinel transaction id. The transceiver processes the requests in the order they
+     * are sent. The result is delivered through @p aCallback.
+     *
+     * @param[in]   aKey        Spinel property key.
+     * @param[in]   aCallback   The callback to invoke when the request completes (can be `nullptr`).
+     * @param[in]   aContext    An arbitrary context to use with @p aCallback.
+     * @param[in]   aFormat     Spinel formatter to pack property value.
+     * @param[in]   ...         Variable arguments list.
+     *
+     * @retval  OT_ERROR_NONE   Successfully sent the request.
+     * @retval  OT_ERROR_BUSY   Too many requests are in flight.
+     */
+    otError SetAsync(spinel_prop_key_t aKey, AsyncRequestCallback aCallback, void *aContext, const char *aFormat, ...);
+
+    /**
+     * Sends a request to insert an item into a spinel list property of OpenThread transceiver without waiting for its
+     * response.
+     *
+     * @param[in]   aKey        Spinel property key.
+     * @param[in]   aCallback   The callback to invoke when the request completes (can be `nullptr`).
+     * @param[in]   aContext    An arbitrary context to use with @p aCallback.
+     * @param[in]   aFormat     Spinel formatter to pack the item.
+     * @param[in]   ...         Variable arguments list.
+     *
+     * @retval  OT_ERROR_NONE   Successfully sent the request.
+     * @retval  OT_ERROR_BUSY   Too many requests are in flight.
+     */
+    otError InsertAsync(spinel_prop_key_t    aKey,
+                        AsyncRequestCallback aCallback,
+                        void                *aContext,
+                        const char          *aFormat,
+                        ...);
+
+    /**
+     * Sends a request to remove an item from a spinel list property of OpenThread transceiver without waiting for its
+     * response.
+     *
+     * @param[in]   aKey        Spinel property key.
+     * @param[in]   aCallback   The callback to invoke when the request completes (can be `nullptr`).
+     * @param[in]   aContext    An arbitrary context to use with @p aCallback.
+     * @param[in]   aFormat     Spinel formatter to pack the item.
+     * @param[in]   ...         Variable arguments list.
+     *
+     * @retval  OT_ERROR_NONE   Successfully sent the request.
+     * @retval  OT_ERROR_BUSY   Too many requests are in flight.
+     */
+    otError RemoveAsync(spinel_prop_key_t    aKey,
+                        AsyncRequestCallback aCallback,
+                        void                *aContext,
+                        const char          *aFormat,
+                        ...);
+
+    /**
+     * Indicates whether there is any asynchronous request in flight.
+     *
+     * @retval TRUE   At least one asynchronous request is waiting for its response.
+     * @retval FALSE  No asynchronous request is waiting for its response.
+     */
+    bool HasPendingAsyncRequests(void) const;
+
+    /**
+     * Waits until all asynchronous requests in flight complete.
+     *
+     * The callbacks of the completed requests are invoked before this method returns.
+     *
+     * @retval  OT_ERROR_NONE               All requests completed (the result of each one is given to its callback).
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     */
+    otError WaitAsyncRequests(void);
+
+    /**
+     * Gets the next round-trip time statistics entry of the spinel property requests.
+     *
+     * To get the first entry, @p aIterator should be set to zero.
+     *
+     * @param[in,out] aIterator  A reference to the iterator.
+     * @param[out]    aRtt       A reference to return the round-trip time statistics.
+     *
+     * @retval OT_ERROR_NONE       Successfully retrieved the next entry.
+     * @retval OT_ERROR_NOT_FOUND  No more entries.
+     */
+    otError GetNextPropertyRtt(uint8_t &aIterator, otRadioSpinelPropertyRtt &aRtt) const;
+
+    /**
+     * Clears the round-trip time statistics of the spinel property requests.
+     */
+    void ResetPropertyRtts(void) { mNumPropertyRtts = 0; }
+
     /**
      * Sends a reset command to the RCP.
      *
@@ -1099,6 +1224,17 @@ private:
         kStateTransmitDone, ///< Radio indicated frame transmission is done.
     };
 
+    static constexpr uint8_t kMaxAsyncRequests           = OPENTHREAD_SPINEL_CONFIG_MAX_ASYNC_REQUESTS;
+    static constexpr uint8_t kMaxPropertyRtts            = OPENTHREAD_SPINEL_CONFIG_MAX_PROPERTY_RTT_ENTRIES;
+    static constexpr uint8_t kMaxSrcMatchUpdateEntries   = 32; ///< Max entries in a `MAC_SRC_MATCH_UPDATE` request.
+    static constexpr uint8_t kMaxSrcMatchUpdateEntrySize = sizeof(uint8_t) + sizeof(otExtAddress);
+
+    // Max size of the address list in a restore request. An RCP has a
+    // 512-byte HDLC/SPI receive buffer by default and silently drops
+    // larger frames, so the list is kept to the same size as a full
+    // `MAC_SRC_MATCH_UPDATE` request.
+    static constexpr uint16_t kMaxSrcMatchRestoreSize = kMaxSrcMatchUpdateEntries * kMaxSrcMatchUpdateEntrySize;
+
     static constexpr uint32_t kUsPerMs  = 1000;                 ///< Microseconds per millisecond.
     static constexpr uint32_t kMsPerSec = 1000;                 ///< Milliseconds per second.
     static constexpr uint32_t kUsPerSec = kUsPerMs * kMsPerSec; ///< Microseconds per second.
@@ -1106,8 +1242,20 @@ private:
         OPENTHREAD_SPINEL_CONFIG_RCP_TX_WAIT_TIME_SECS *
         kUsPerSec; ///< Maximum time of waiting for `TransmitDone` event, in microseconds.
 
+    static_assert(kMaxAsyncRequests <= 13, "OPENTHREAD_SPINEL_CONFIG_MAX_ASYNC_REQUESTS is too large");
+
     typedef otError (RadioSpinel::*ResponseHandler)(const uint8_t *aBuffer, uint16_t aLength);
 
+    struct AsyncRequest
+    {
+        spinel_tid_t         mTid;             ///< The transaction id, or zero if the entry is unused.
+        spinel_prop_key_t    mKey;             ///< The property key.
+        uint32_t             mExpectedCommand; ///< The expected response command.
+        uint64_t             mSentTimeUs;      ///< The time when the request was sent.
+        AsyncRequestCallback mCallback;        ///< The callback to invoke when the request completes.
+        void                *mContext;         ///< The context for `mCallback`.
+    };
+
     SpinelDriver &GetSpinelDriver(void) const;
 
     otError CheckSpinelVersion(void);
@@ -1148,6 +1296,33 @@ private:
     otError WaitResponse(bool aHandleRcpTimeout = true);
     otError ParseRadioFrame(otRadioFrame &aFrame, const uint8_t *aBuffer, uint16_t aLength, spinel_ssize_t &aUnpacked);
 
+    otError       AsyncRequestV(uint32_t             aExpectedCommand,
+                                uint32_t             aCommand,
+                                spinel_prop_key_t    aKey,
+                                AsyncRequestCallback aCallback,
+                                void                *aContext,
+                                const char          *aFormat,
+                                va_list              aArgs);
+    AsyncRequest *FindAsyncRequest(spinel_tid_t aTid);
+    void          HandleAsyncResponse(AsyncRequest     &aRequest,
+                                      uint32_t          aCommand,
+                                      spinel_prop_key_t aKey,
+                                      const uint8_t    *aBuffer,
+                                      uint16_t          aLength);
+    void          FinishAsyncRequest(AsyncRequest &aRequest, otError aError);
+    void          FinishAllAsyncRequests(otError aError);
+    void          ProcessAsyncRequests(void);
+    void          RecordPropertyRtt(spinel_prop_key_t aKey, uint64_t aSentTimeUs);
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    otError SaveSrcMatchShortEntry(uint16_t aShortAddress);
+    otError SaveSrcMatchExtEntry(const otExtAddress &aExtAddress);
+    void    ForgetSrcMatchShortEntry(uint16_t aShortAddress);
+    void    ForgetSrcMatchExtEntry(const otExtAddress &aExtAddress);
+#endif
+
+    static void HandleAsyncRequestDone(otError aError, spinel_prop_key_t aKey, void *aContext);
+
     /**
      * Returns if the property changed event is safe to be handled now.
      *
@@ -1180,6 +1355,14 @@ private:
     void HandleRcpUnexpectedReset(spinel_status_t aStatus);
     void HandleRcpTimeout(void);
     void RecoverFromRcpFailure(void);
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    otError SendRestoreRequest(otError          *aResult,
+                               uint32_t          aCommand,
+                               spinel_prop_key_t aKey,
+                               const char       *aFormat,
+                               ...);
+    otError RestoreSrcMatchTable(bool aIsShort, otError *aResult);
+#endif
 
     static void HandleReceivedFrame(const uint8_t *aFrame,
                                     uint16_t       aLength,
@@ -1229,6 +1412,7 @@ private:
         void IncrementRcpUnexpectedResetCount(void) { IncrementCount(kTypeUnexpectResetCount); }
         void IncrementRcpRestorationCount(void) { IncrementCount(kTypeRestorationCount); }
         void IncrementSpinelParseErrorCount(void) { IncrementCount(kTypeSpinelParseErrorCount); }
+        void RecordRcpRestorationTime(uint32_t aTimeUs);
 
         const Metrics &GetMetrics(void) const { return mMetrics; }
 
@@ -1258,6 +1442,7 @@ private:
     spinel_tid_t      mTxRadioTid;      ///< The transaction id used to send a radio frame.
     spinel_tid_t      mWaitingTid;      ///< The transaction id of current transaction.
     spinel_prop_key_t mWaitingKey;      ///< The property key of current transaction.
+    uint64_t          mWaitingSentUs;   ///< The time when the request of current transaction was sent.
     const char       *mPropertyFormat;  ///< The spinel property format of current transaction.
     va_list           mPropertyArgs;    ///< The arguments pack or unpack spinel property of current transaction.
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
@@ -1292,6 +1477,7 @@ private:
     static bool sSupportsLogStream; ///< RCP supports `LOG_STREAM` property with OpenThread log meta-data format.
     static bool sSupportsResetToBootloader; ///< RCP supports resetting into bootloader mode.
     static bool sSupportsLogCrashDump;      ///< RCP supports logging a crash dump.
+    static bool sSupportsSrcMatchUpdate;    ///< RCP supports `MAC_SRC_MATCH_UPDATE` property.
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 
@@ -1351,6 +1537,10 @@ private:
     MaxPowerTable  mMaxPowerTable;
     MetricsTracker mMetrics;
 
+    AsyncRequest             mAsyncRequests[kMaxAsyncRequests]; ///< Asynchronous requests in flight.
+    otRadioSpinelPropertyRtt mPropertyRtts[kMaxPropertyRtts];   ///< Round-trip time statistics per property.
+    uint8_t                  mNumPropertyRtts;                  ///< Number of entries in `mPropertyRtts`.
+
 #if OPENTHREAD_SPINEL_CONFIG_VENDOR_HOOK_ENABLE
     otRadioSpinelVendorRestorePropertiesCallback mVendorRestorePropertiesCallback;
     void                                        *mVendorRestorePropertiesContext;
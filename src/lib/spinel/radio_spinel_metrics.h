@@ -46,12 +46,29 @@ extern "C" {
  */
 typedef struct otRadioSpinelMetrics
 {
-    uint32_t mRcpTimeoutCount;         ///< The number of RCP timeouts.
-    uint32_t mRcpUnexpectedResetCount; ///< The number of RCP unexpected resets.
-    uint32_t mRcpRestorationCount;     ///< The number of RCP restorations.
-    uint32_t mSpinelParseErrorCount;   ///< The number of spinel frame parse errors.
+    uint32_t mRcpTimeoutCount;           ///< The number of RCP timeouts.
+    uint32_t mRcpUnexpectedResetCount;   ///< The number of RCP unexpected resets.
+    uint32_t mRcpRestorationCount;       ///< The number of RCP restorations.
+    uint32_t mSpinelParseErrorCount;     ///< The number of spinel frame parse errors.
+    uint32_t mLastRcpRestorationTimeUs;  ///< The duration of the last completed RCP restoration in microseconds.
+    uint32_t mMaxRcpRestorationTimeUs;   ///< The longest duration of a completed RCP restoration in microseconds.
+    uint64_t mTotalRcpRestorationTimeUs; ///< The sum of the durations of completed RCP restorations in microseconds.
 } otRadioSpinelMetrics;
 
+/**
+ * Represents the round-trip time statistics of the requests for a spinel property.
+ *
+ * The round-trip time of a request is measured on the host from sending the request to receiving its response.
+ */
+typedef struct otRadioSpinelPropertyRtt
+{
+    uint32_t mPropertyKey; ///< The spinel property key.
+    uint32_t mNumRequests; ///< The number of requests which received a response.
+    uint32_t mMinRttUs;    ///< The minimum round-trip time in microseconds.
+    uint32_t mMaxRttUs;    ///< The maximum round-trip time in microseconds.
+    uint64_t mTotalRttUs;  ///< The sum of the round-trip times of all requests in microseconds.
+} otRadioSpinelPropertyRtt;
+
 /**
  * Represents RCP interface metrics.
  */
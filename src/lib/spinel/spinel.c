@@ -1276,6 +1276,7 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         {SPINEL_PROP_MAC_CCA_FAILURE_RATE, "MAC_CCA_FAILURE_RATE"},
         {SPINEL_PROP_MAC_MAX_RETRY_NUMBER_DIRECT, "MAC_MAX_RETRY_NUMBER_DIRECT"},
         {SPINEL_PROP_MAC_MAX_RETRY_NUMBER_INDIRECT, "MAC_MAX_RETRY_NUMBER_INDIRECT"},
+        {SPINEL_PROP_MAC_SRC_MATCH_UPDATE, "MAC_SRC_MATCH_UPDATE"},
         {SPINEL_PROP_NET_SAVED, "NET_SAVED"},
         {SPINEL_PROP_NET_IF_UP, "NET_IF_UP"},
         {SPINEL_PROP_NET_STACK_UP, "NET_STACK_UP"},
@@ -1636,6 +1637,7 @@ const char *spinel_capability_to_cstr(spinel_capability_t capability)
         {SPINEL_CAP_RCP_MIN_HOST_API_VERSION, "RCP_MIN_HOST_API_VERSION"},
         {SPINEL_CAP_RCP_RESET_TO_BOOTLOADER, "RCP_RESET_TO_BOOTLOADER"},
         {SPINEL_CAP_RCP_LOG_CRASH_DUMP, "RCP_LOG_CRASH_DUMP"},
+        {SPINEL_CAP_RCP_SRC_MATCH_UPDATE, "RCP_SRC_MATCH_UPDATE"},
         {SPINEL_CAP_MAC_ALLOWLIST, "MAC_ALLOWLIST"},
         {SPINEL_CAP_MAC_RAW, "MAC_RAW"},
         {SPINEL_CAP_OOB_STEERING_DATA, "OOB_STEERING_DATA"},
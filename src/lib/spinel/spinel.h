@@ -896,6 +896,12 @@ enum
     SPINEL_MD_FLAG_RESERVED  = 0xFFC2, //!< Flags reserved for future use.
 };
 
+enum
+{
+    SPINEL_SRC_MATCH_ENTRY_FLAG_ADD   = 1 << 0, //!< Add the entry (clear it otherwise).
+    SPINEL_SRC_MATCH_ENTRY_FLAG_SHORT = 1 << 1, //!< The entry is a short address (extended address otherwise).
+};
+
 enum
 {
     SPINEL_RESET_PLATFORM   = 1,
@@ -1276,6 +1282,7 @@ enum
     SPINEL_CAP_RCP_MIN_HOST_API_VERSION = (SPINEL_CAP_RCP__BEGIN + 1),
     SPINEL_CAP_RCP_RESET_TO_BOOTLOADER  = (SPINEL_CAP_RCP__BEGIN + 2),
     SPINEL_CAP_RCP_LOG_CRASH_DUMP       = (SPINEL_CAP_RCP__BEGIN + 3),
+    SPINEL_CAP_RCP_SRC_MATCH_UPDATE     = (SPINEL_CAP_RCP__BEGIN + 4),
     SPINEL_CAP_RCP__END                 = 80,
 
     SPINEL_CAP_OPENTHREAD__BEGIN       = 512,
@@ -2217,6 +2224,20 @@ enum
      */
     SPINEL_PROP_MAC_MAX_RETRY_NUMBER_INDIRECT = SPINEL_PROP_MAC_EXT__BEGIN + 11,
 
+    /// MAC Source Match Table Update
+    /** Format: `D` - Write only
+     * Required capability: `SPINEL_CAP_RCP_SRC_MATCH_UPDATE`
+     *
+     * Applies a list of changes to the source match short and extended address tables with a single request. The
+     * value is a sequence of entries without any length prefix. Each entry is encoded as a `C` flags byte
+     * (`SPINEL_SRC_MATCH_ENTRY_FLAG_*`) directly followed by the address, which is an `S` short address if
+     * `SPINEL_SRC_MATCH_ENTRY_FLAG_SHORT` is set or an `E` extended address otherwise.
+     *
+     * The entries are applied in order. Clearing an address which is not in the table is not an error. If an entry
+     * cannot be applied, the remaining entries are skipped and the corresponding error status is returned.
+     */
+    SPINEL_PROP_MAC_SRC_MATCH_UPDATE = SPINEL_PROP_MAC_EXT__BEGIN + 12,
+
     SPINEL_PROP_MAC_EXT__END = 0x1400,
 
     SPINEL_PROP_NET__BEGIN = 0x40,
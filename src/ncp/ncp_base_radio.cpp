@@ -374,6 +374,46 @@ exit:
     return error;
 }
 
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SRC_MATCH_UPDATE>(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    while (!mDecoder.IsAllReadInStruct())
+    {
+        uint8_t flags;
+        bool    add;
+
+        SuccessOrExit(error = mDecoder.ReadUint8(flags));
+        add = (flags & SPINEL_SRC_MATCH_ENTRY_FLAG_ADD);
+
+        if (flags & SPINEL_SRC_MATCH_ENTRY_FLAG_SHORT)
+        {
+            uint16_t shortAddress;
+
+            SuccessOrExit(error = mDecoder.ReadUint16(shortAddress));
+
+            error = add ? otLinkRawSrcMatchAddShortEntry(mInstance, shortAddress)
+                        : otLinkRawSrcMatchClearShortEntry(mInstance, shortAddress);
+        }
+        else
+        {
+            const otExtAddress *extAddress;
+
+            SuccessOrExit(error = mDecoder.ReadEui64(extAddress));
+
+            error = add ? otLinkRawSrcMatchAddExtEntry(mInstance, extAddress)
+                        : otLinkRawSrcMatchClearExtEntry(mInstance, extAddress);
+        }
+
+        // Clearing an entry which is not in the table is not an error.
+        VerifyOrExit(error == OT_ERROR_NONE || (!add && error == OT_ERROR_NO_ADDRESS));
+        error = OT_ERROR_NONE;
+    }
+
+exit:
+    return error;
+}
+
 template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_PHY_ENABLED>(void)
 {
     bool    value = false;
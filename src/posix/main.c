@@ -33,6 +33,7 @@
 #include <assert.h>
 #include <errno.h>
 #include <getopt.h>
+#include <inttypes.h>
 #include <libgen.h>
 #include <signal.h>
 #include <stdio.h>
@@ -66,6 +67,7 @@
 #include <lib/platform/exit_code.h>
 #include <lib/platform/reset_util.h>
 #include <lib/spinel/coprocessor_type.h>
+#include <lib/spinel/spinel.h>
 #include <openthread/openthread-system.h>
 #include <openthread/platform/misc.h>
 
@@ -370,6 +372,46 @@ static otError ProcessNetif(void *aContext, uint8_t aArgsLength, char *aArgs[])
     return OT_ERROR_NONE;
 }
 
+static otError ProcessRcpMetrics(void *aContext, uint8_t aArgsLength, char *aArgs[])
+{
+    otError                     error    = OT_ERROR_NONE;
+    const otRadioSpinelMetrics *metrics  = otSysGetRadioSpinelMetrics();
+    uint8_t                     iterator = 0;
+    otRadioSpinelPropertyRtt    rtt;
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    if (aArgsLength == 1 && !strcmp(aArgs[0], "reset"))
+    {
+        otSysResetRadioSpinelPropertyRtts();
+        ExitNow();
+    }
+
+    VerifyOrExit(aArgsLength == 0, error = OT_ERROR_INVALID_ARGS);
+
+    otCliOutputFormat("RCP timeouts: %lu\r\n", (unsigned long)metrics->mRcpTimeoutCount);
+    otCliOutputFormat("RCP unexpected resets: %lu\r\n", (unsigned long)metrics->mRcpUnexpectedResetCount);
+    otCliOutputFormat("RCP restorations: %lu\r\n", (unsigned long)metrics->mRcpRestorationCount);
+    otCliOutputFormat("Spinel parse errors: %lu\r\n", (unsigned long)metrics->mSpinelParseErrorCount);
+    otCliOutputFormat("Last RCP restoration time: %lu us\r\n", (unsigned long)metrics->mLastRcpRestorationTimeUs);
+    otCliOutputFormat("Max RCP restoration time: %lu us\r\n", (unsigned long)metrics->mMaxRcpRestorationTimeUs);
+    otCliOutputFormat("Total RCP restoration time: %" PRIu64 " us\r\n", metrics->mTotalRcpRestorationTimeUs);
+
+    otCliOutputFormat("| Property                       | Requests | Min RTT (us) | Avg RTT (us) | Max RTT (us) |\r\n");
+    otCliOutputFormat("+--------------------------------+----------+--------------+--------------+--------------+\r\n");
+
+    while (otSysGetNextRadioSpinelPropertyRtt(&iterator, &rtt) == OT_ERROR_NONE)
+    {
+        otCliOutputFormat("| %-30s | %8lu | %12lu | %12" PRIu64 " | %12lu |\r\n",
+                          spinel_prop_key_to_cstr((spinel_prop_key_t)rtt.mPropertyKey), (unsigned long)rtt.mNumRequests,
+                          (unsigned long)rtt.mMinRttUs, rtt.mTotalRttUs / (rtt.mNumRequests ? rtt.mNumRequests : 1),
+                          (unsigned long)rtt.mMaxRttUs);
+    }
+
+exit:
+    return error;
+}
+
 #if !OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
 static otError ProcessExit(void *aContext, uint8_t aArgsLength, char *aArgs[])
 {
@@ -386,6 +428,7 @@ static const otCliCommand kCommands[] = {
     {"exit", ProcessExit},
 #endif
     {"netif", ProcessNetif},
+    {"rcpmetrics", ProcessRcpMetrics},
 };
 
 int main(int argc, char *argv[])
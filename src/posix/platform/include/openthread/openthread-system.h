@@ -235,6 +235,24 @@ uint32_t otSysGetInfraNetifIndex(void);
  */
 const otRadioSpinelMetrics *otSysGetRadioSpinelMetrics(void);
 
+/**
+ * Gets the next round-trip time statistics entry of the spinel property requests sent to the RCP.
+ *
+ * To get the first entry, the iterator should be set to zero.
+ *
+ * @param[in,out] aIterator  A pointer to the iterator.
+ * @param[out]    aRtt       A pointer to return the round-trip time statistics.
+ *
+ * @retval OT_ERROR_NONE       Successfully retrieved the next entry.
+ * @retval OT_ERROR_NOT_FOUND  No more entries.
+ */
+otError otSysGetNextRadioSpinelPropertyRtt(uint8_t *aIterator, otRadioSpinelPropertyRtt *aRtt);
+
+/**
+ * Clears the round-trip time statistics of the spinel property requests sent to the RCP.
+ */
+void otSysResetRadioSpinelPropertyRtts(void);
+
 /**
  * Returns the RCP interface metrics.
  *
@@ -263,6 +281,35 @@ typedef struct otSysInfraNetIfAddressCounters
  */
 void otSysCountInfraNetifAddresses(otSysInfraNetIfAddressCounters *aAddressCounters);
 
+/**
+ * Represents the packet I/O counters of the Thread network interface (TUN device).
+ */
+typedef struct otSysNetifTunCounters
+{
+    uint32_t mReadWakeups;             ///< Number of mainloop wakeups that read packets from the interface.
+    uint32_t mReadPackets;             ///< Number of packets read from the interface (host to Thread).
+    uint32_t mReadMaxPacketsPerWakeup; ///< Maximum number of packets read in a single mainloop wakeup.
+    uint32_t mWritePackets;            ///< Number of packets written to the interface (Thread to host).
+    uint64_t mReadTimeUs;              ///< Time spent reading packets and passing them to OpenThread (usec).
+    uint64_t mWriteTimeUs;             ///< Time spent writing packets to the interface (usec).
+} otSysNetifTunCounters;
+
+/**
+ * Gets the packet I/O counters of the Thread network interface.
+ *
+ * The average number of packets read per mainloop wakeup is `mReadPackets / mReadWakeups`. Up to
+ * `OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE` packets are read per wakeup. All counters are zero when the platform
+ * network interface is disabled (`OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE`).
+ *
+ * @returns The packet I/O counters of the Thread network interface.
+ */
+const otSysNetifTunCounters *otSysGetNetifTunCounters(void);
+
+/**
+ * Resets the packet I/O counters of the Thread network interface.
+ */
+void otSysResetNetifTunCounters(void);
+
 /**
  * Sets the infrastructure network interface and the ICMPv6 socket.
  *
@@ -492,6 +492,11 @@ void InfraNetif::SetUp(void)
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     SuccessOrDie(otBorderRoutingInit(gInstance, mInfraIfIndex, IsRunning()));
     SuccessOrDie(otBorderRoutingSetEnabled(gInstance, /* aEnabled */ true));
+
+    if (mInfraIfIcmp6Socket != -1)
+    {
+        mInfraIfIcmp6Watcher.Start(mInfraIfIcmp6Socket, Mainloop::kEventReadable);
+    }
 #endif
 
 #if OPENTHREAD_POSIX_CONFIG_BACKBONE_ROUTER_MULTICAST_ROUTING_ENABLE
@@ -503,6 +508,7 @@ void InfraNetif::SetUp(void)
 #endif
 
     Mainloop::Manager::Get().Add(*this);
+    mIsSetUp = true;
 
     ExitNow(); // To silence unused `exit` label warning.
 
@@ -514,6 +520,7 @@ void InfraNetif::TearDown(void)
 {
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     IgnoreError(otBorderRoutingSetEnabled(gInstance, false));
+    mInfraIfIcmp6Watcher.Stop();
 #endif
 
 #if OT_POSIX_CONFIG_DHCP6_PD_SOCKET_ENABLE
@@ -525,6 +532,7 @@ void InfraNetif::TearDown(void)
 #endif
 
     Mainloop::Manager::Get().Remove(*this);
+    mIsSetUp = false;
 }
 
 void InfraNetif::Deinit(void)
@@ -534,6 +542,8 @@ void InfraNetif::Deinit(void)
 #endif
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
+    mInfraIfIcmp6Watcher.Stop();
+
     if (mInfraIfIcmp6Socket != -1)
     {
         close(mInfraIfIcmp6Socket);
@@ -565,8 +575,6 @@ void InfraNetif::Update(Mainloop::Context &aContext)
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     VerifyOrExit(mInfraIfIcmp6Socket != -1);
-
-    Mainloop::AddToReadFdSet(mInfraIfIcmp6Socket, aContext);
 #endif
 
 #ifdef __linux__
@@ -686,7 +694,7 @@ exit:
 #endif // #ifdef __linux__
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
-void InfraNetif::ReceiveIcmp6Message(void)
+otError InfraNetif::ReceiveIcmp6Message(void)
 {
     otError  error = OT_ERROR_NONE;
     uint8_t  buffer[1500];
@@ -715,11 +723,12 @@ void InfraNetif::ReceiveIcmp6Message(void)
     msg.msg_control    = cmsgbuf;
     msg.msg_controllen = sizeof(cmsgbuf);
 
-    rval = recvmsg(mInfraIfIcmp6Socket, &msg, 0);
+    rval = recvmsg(mInfraIfIcmp6Socket, &msg, MSG_DONTWAIT);
     if (rval < 0)
     {
+        VerifyOrExit(errno != EAGAIN && errno != EWOULDBLOCK, error = OT_ERROR_NOT_FOUND);
         LogWarn("Failed to receive ICMPv6 message: %s", strerror(errno));
-        ExitNow(error = OT_ERROR_DROP);
+        ExitNow(error = OT_ERROR_FAILED);
     }
 
     bufferLength = static_cast<uint16_t>(rval);
@@ -752,10 +761,12 @@ void InfraNetif::ReceiveIcmp6Message(void)
                              bufferLength);
 
 exit:
-    if (error != OT_ERROR_NONE)
+    if (error == OT_ERROR_DROP)
     {
         LogDebg("Failed to handle ICMPv6 message: %s", otThreadErrorToString(error));
     }
+
+    return error;
 }
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
@@ -769,9 +780,17 @@ void InfraNetif::SetInfraNetifIcmp6SocketForBorderRouting(int aIcmp6Socket)
 
     if (mInfraIfIcmp6Socket != -1)
     {
+        mInfraIfIcmp6Watcher.Stop();
         close(mInfraIfIcmp6Socket);
     }
     mInfraIfIcmp6Socket = aIcmp6Socket;
+
+    // The infra interface may be replaced after `SetUp()`, in which
+    // case the new socket needs to be watched right away.
+    if (mIsSetUp && (mInfraIfIcmp6Socket != -1))
+    {
+        mInfraIfIcmp6Watcher.Start(mInfraIfIcmp6Socket, Mainloop::kEventReadable);
+    }
 }
 #endif
 
@@ -789,13 +808,6 @@ void InfraNetif::Process(const Mainloop::Context &aContext)
     VerifyOrExit(mNetLinkSocket != -1);
 #endif
 
-#if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
-    if (Mainloop::IsFdReadable(mInfraIfIcmp6Socket, aContext))
-    {
-        ReceiveIcmp6Message();
-    }
-#endif
-
 #ifdef __linux__
     if (Mainloop::IsFdReadable(mNetLinkSocket, aContext))
     {
@@ -807,6 +819,29 @@ exit:
     return;
 }
 
+void InfraNetif::HandleFdEvents(Mainloop::FdWatcher &aWatcher, uint32_t aEvents)
+{
+    OT_UNUSED_VARIABLE(aWatcher);
+    OT_UNUSED_VARIABLE(aEvents);
+
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
+    if (&aWatcher == &mInfraIfIcmp6Watcher)
+    {
+        uint16_t numMessages = 0;
+        otError  error;
+
+        // At most `kMaxRxIcmp6MessagesPerEvent` messages are read, the
+        // watcher reports the socket again on the next mainloop
+        // iteration if more are pending.
+        do
+        {
+            error = ReceiveIcmp6Message();
+        } while ((error == OT_ERROR_NONE || error == OT_ERROR_DROP) &&
+                 (++numMessages < kMaxRxIcmp6MessagesPerEvent));
+    }
+#endif
+}
+
 InfraNetif &InfraNetif::Get(void)
 {
     static InfraNetif sInstance;
@@ -74,6 +74,14 @@ public:
      */
     void Process(const Mainloop::Context &aContext) override;
 
+    /**
+     * Handles the events of the watched file descriptors.
+     *
+     * @param[in]   aWatcher   The watcher of the file descriptor.
+     * @param[in]   aEvents    The events on the file descriptor.
+     */
+    void HandleFdEvents(Mainloop::FdWatcher &aWatcher, uint32_t aEvents) override;
+
     /**
      * Initializes the infrastructure network interface.
      *
@@ -207,15 +215,19 @@ private:
     static const otIp4Address kWellKnownIpv4OnlyAddress2; // 192.0.0.171
     static const uint8_t      kValidNat64PrefixLength[];
 
+    static constexpr uint16_t kMaxRxIcmp6MessagesPerEvent = 16;
+
     char     mInfraIfName[IFNAMSIZ];
     uint32_t mInfraIfIndex = 0;
+    bool     mIsSetUp      = false;
 
 #ifdef __linux__
     int mNetLinkSocket = -1;
 #endif
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
-    int mInfraIfIcmp6Socket = -1;
+    int                 mInfraIfIcmp6Socket = -1;
+    Mainloop::FdWatcher mInfraIfIcmp6Watcher{*this};
 #endif
 #if OPENTHREAD_POSIX_CONFIG_BACKBONE_ROUTER_MULTICAST_ROUTING_ENABLE
     MulticastRoutingManager mMulticastRoutingManager;
@@ -233,8 +245,8 @@ private:
 #endif
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
-    void SetInfraNetifIcmp6SocketForBorderRouting(int aIcmp6Socket);
-    void ReceiveIcmp6Message(void);
+    void    SetInfraNetifIcmp6SocketForBorderRouting(int aIcmp6Socket);
+    otError ReceiveIcmp6Message(void);
 #endif
 };
 
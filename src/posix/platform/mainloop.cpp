@@ -29,10 +29,12 @@
 #include "posix/platform/mainloop.hpp"
 
 #include <assert.h>
+#include <errno.h>
 
 #include <openthread/platform/time.h>
 
 #include "common/code_utils.hpp"
+#include "lib/platform/exit_code.h"
 
 namespace ot {
 namespace Posix {
@@ -72,6 +74,43 @@ exit:
     return;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// FdWatcher
+
+void FdWatcher::Start(int aFd, uint32_t aEvents)
+{
+    assert(aFd >= 0);
+
+    Stop();
+
+    mFd     = aFd;
+    mEvents = aEvents;
+    Manager::Get().Watch(*this);
+}
+
+void FdWatcher::SetEvents(uint32_t aEvents)
+{
+    VerifyOrExit(IsWatching());
+
+    mEvents = aEvents;
+    Manager::Get().Rewatch(*this);
+
+exit:
+    return;
+}
+
+void FdWatcher::Stop(void)
+{
+    VerifyOrExit(IsWatching());
+
+    Manager::Get().Unwatch(*this);
+    mFd     = -1;
+    mEvents = 0;
+
+exit:
+    return;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // Manager
 
@@ -103,6 +142,28 @@ void Manager::Update(Context &aContext)
     {
         source->Update(aContext);
     }
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    if (mNumWatchers > 0)
+    {
+        AddToReadFdSet(mEpollFd, aContext);
+    }
+#else
+    for (FdWatcher *watcher = mWatchers; watcher != nullptr; watcher = watcher->mNext)
+    {
+        if (watcher->mEvents & kEventReadable)
+        {
+            AddToReadFdSet(watcher->mFd, aContext);
+        }
+
+        if (watcher->mEvents & kEventWritable)
+        {
+            AddToWriteFdSet(watcher->mFd, aContext);
+        }
+
+        AddToErrorFdSet(watcher->mFd, aContext);
+    }
+#endif
 }
 
 void Manager::Process(const Context &aContext)
@@ -111,8 +172,162 @@ void Manager::Process(const Context &aContext)
     {
         source->Process(aContext);
     }
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    if ((mNumWatchers > 0) && IsFdReadable(mEpollFd, aContext))
+    {
+        struct epoll_event events[kMaxEpollEvents];
+        int                count;
+
+        // Only one batch of events is handled, if there are more
+        // the epoll fd stays readable for the next iteration.
+
+        count = epoll_wait(mEpollFd, events, kMaxEpollEvents, /* aTimeout */ 0);
+
+        mPendingEvents    = events;
+        mNumPendingEvents = count;
+
+        for (int i = 0; i < count; i++)
+        {
+            FdWatcher *watcher = static_cast<FdWatcher *>(events[i].data.ptr);
+            uint32_t   flags   = 0;
+
+            // `Unwatch()` clears the entry if the watcher is stopped
+            // by an earlier handler in this batch.
+            if (watcher == nullptr)
+            {
+                continue;
+            }
+
+            flags |= (events[i].events & EPOLLIN) ? kEventReadable : 0;
+            flags |= (events[i].events & EPOLLOUT) ? kEventWritable : 0;
+            flags |= (events[i].events & (EPOLLERR | EPOLLHUP)) ? kEventError : 0;
+
+            watcher->mSource.HandleFdEvents(*watcher, flags);
+        }
+
+        mPendingEvents    = nullptr;
+        mNumPendingEvents = 0;
+    }
+#else
+    for (FdWatcher *watcher = mWatchers; watcher != nullptr; watcher = mNextWatcher)
+    {
+        uint32_t flags = 0;
+
+        // `Unwatch()` advances `mNextWatcher` if the next watcher is
+        // stopped by the handler of the current one.
+        mNextWatcher = watcher->mNext;
+
+        flags |= IsFdReadable(watcher->mFd, aContext) ? kEventReadable : 0;
+        flags |= IsFdWritable(watcher->mFd, aContext) ? kEventWritable : 0;
+        flags |= HasFdErrored(watcher->mFd, aContext) ? kEventError : 0;
+
+        if (flags != 0)
+        {
+            watcher->mSource.HandleFdEvents(*watcher, flags);
+        }
+    }
+
+    mNextWatcher = nullptr;
+#endif
+}
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+static void UpdateEpoll(int aEpollFd, int aOperation, FdWatcher &aWatcher, int aFd, uint32_t aEvents)
+{
+    struct epoll_event event;
+
+    event.events   = 0;
+    event.data.ptr = &aWatcher;
+
+    if (aEvents & kEventReadable)
+    {
+        event.events |= EPOLLIN;
+    }
+
+    if (aEvents & kEventWritable)
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    VerifyOrDie(epoll_ctl(aEpollFd, aOperation, aFd, &event) == 0, OT_EXIT_ERROR_ERRNO);
 }
 
+void Manager::Watch(FdWatcher &aWatcher)
+{
+    if (mEpollFd < 0)
+    {
+        mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+        VerifyOrDie(mEpollFd >= 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+    UpdateEpoll(mEpollFd, EPOLL_CTL_ADD, aWatcher, aWatcher.mFd, aWatcher.mEvents);
+    mNumWatchers++;
+}
+
+void Manager::Rewatch(FdWatcher &aWatcher)
+{
+    UpdateEpoll(mEpollFd, EPOLL_CTL_MOD, aWatcher, aWatcher.mFd, aWatcher.mEvents);
+}
+
+void Manager::Unwatch(FdWatcher &aWatcher)
+{
+    // The fd may already be closed (which removes it from the epoll
+    // set), so `ENOENT` and `EBADF` are not considered failures.
+    if (epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aWatcher.mFd, nullptr) != 0)
+    {
+        VerifyOrDie(errno == ENOENT || errno == EBADF, OT_EXIT_ERROR_ERRNO);
+    }
+
+    for (int i = 0; i < mNumPendingEvents; i++)
+    {
+        if (mPendingEvents[i].data.ptr == &aWatcher)
+        {
+            mPendingEvents[i].data.ptr = nullptr;
+        }
+    }
+
+    mNumWatchers--;
+}
+
+#else // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+void Manager::Watch(FdWatcher &aWatcher)
+{
+    assert(aWatcher.mNext == nullptr);
+
+    aWatcher.mNext = mWatchers;
+    mWatchers      = &aWatcher;
+}
+
+void Manager::Rewatch(FdWatcher &aWatcher)
+{
+    // The fd sets are rebuilt from `mEvents` on every `Update()`.
+    OT_UNUSED_VARIABLE(aWatcher);
+}
+
+void Manager::Unwatch(FdWatcher &aWatcher)
+{
+    for (FdWatcher **pnext = &mWatchers; *pnext != nullptr; pnext = &(*pnext)->mNext)
+    {
+        if (*pnext == &aWatcher)
+        {
+            *pnext = aWatcher.mNext;
+            break;
+        }
+    }
+
+    if (mNextWatcher == &aWatcher)
+    {
+        mNextWatcher = aWatcher.mNext;
+    }
+
+    aWatcher.mNext = nullptr;
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
 Manager &Manager::Get(void)
 {
     static Manager sInstance;
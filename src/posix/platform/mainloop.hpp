@@ -34,7 +34,14 @@
 #ifndef OT_POSIX_PLATFORM_MAINLOOP_HPP_
 #define OT_POSIX_PLATFORM_MAINLOOP_HPP_
 
+#include "openthread-posix-config.h"
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#include <sys/epoll.h>
+#endif
+
 #include <openthread/openthread-system.h>
+#include <openthread/platform/toolchain.h>
 
 namespace ot {
 namespace Posix {
@@ -131,6 +138,90 @@ uint64_t GetTimeout(const Context &aContext);
  */
 void SetTimeoutIfEarlier(uint64_t aTimeout, Context &aContext);
 
+class Source;
+
+constexpr uint32_t kEventReadable = (1U << 0); ///< The file descriptor is readable.
+constexpr uint32_t kEventWritable = (1U << 1); ///< The file descriptor is writable.
+constexpr uint32_t kEventError    = (1U << 2); ///< The file descriptor has an error or was hung up.
+
+/**
+ * Represents a file descriptor watched by the mainloop on behalf of a `Source`.
+ *
+ * Instead of adding a file descriptor to the fd sets in `Source::Update()` and checking it in `Source::Process()`, a
+ * `Source` can use an `FdWatcher`. `Source::HandleFdEvents()` is then invoked only when the file descriptor is ready.
+ *
+ * When `OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE` is enabled, the file descriptor is registered with epoll in
+ * level-triggered mode. Otherwise, the file descriptor is added to the fd sets of the `select()` based mainloop. In
+ * both cases, `Source::HandleFdEvents()` is invoked again on the next mainloop iteration while the file descriptor is
+ * still ready, so it SHOULD handle a bounded amount of input per call and MUST only watch `kEventWritable` while it has
+ * pending output.
+ */
+class FdWatcher
+{
+    friend class Manager;
+
+public:
+    /**
+     * Initializes the `FdWatcher`.
+     *
+     * @param[in]  aSource  The source to notify of the file descriptor events.
+     */
+    explicit FdWatcher(Source &aSource)
+        : mSource(aSource)
+        , mFd(-1)
+        , mEvents(0)
+        , mNext(nullptr)
+    {
+    }
+
+    /**
+     * Starts watching a file descriptor.
+     *
+     * If the watcher is already watching a file descriptor, it is stopped first.
+     *
+     * @param[in]  aFd      The file descriptor to watch.
+     * @param[in]  aEvents  The events to watch (bitwise OR of `kEventReadable` and `kEventWritable`).
+     */
+    void Start(int aFd, uint32_t aEvents);
+
+    /**
+     * Stops watching the file descriptor.
+     *
+     * MUST be called before the file descriptor is closed.
+     */
+    void Stop(void);
+
+    /**
+     * Changes the events to watch.
+     *
+     * Does nothing if the watcher is not watching a file descriptor.
+     *
+     * @param[in]  aEvents  The events to watch (bitwise OR of `kEventReadable` and `kEventWritable`).
+     */
+    void SetEvents(uint32_t aEvents);
+
+    /**
+     * Indicates whether the watcher is watching a file descriptor.
+     *
+     * @retval TRUE   The watcher is watching a file descriptor.
+     * @retval FALSE  The watcher is not watching a file descriptor.
+     */
+    bool IsWatching(void) const { return mFd >= 0; }
+
+    /**
+     * Gets the watched file descriptor.
+     *
+     * @returns The watched file descriptor, or -1 if not watching.
+     */
+    int GetFd(void) const { return mFd; }
+
+private:
+    Source    &mSource;
+    int        mFd;
+    uint32_t   mEvents;
+    FdWatcher *mNext;
+};
+
 /**
  * Is the base for all mainloop event sources.
  */
@@ -142,16 +233,32 @@ public:
     /**
      * Registers events in the mainloop.
      *
+     * A source which only uses `FdWatcher` does not need to override it.
+     *
      * @param[in,out]   aContext    A reference to the mainloop context.
      */
-    virtual void Update(Context &aContext) = 0;
+    virtual void Update(Context &aContext) { OT_UNUSED_VARIABLE(aContext); }
 
     /**
      * Processes the mainloop events.
      *
+     * A source which only uses `FdWatcher` does not need to override it.
+     *
      * @param[in]   aContext    A reference to the mainloop context.
      */
-    virtual void Process(const Context &aContext) = 0;
+    virtual void Process(const Context &aContext) { OT_UNUSED_VARIABLE(aContext); }
+
+    /**
+     * Handles the events of a file descriptor watched by an `FdWatcher` of this source.
+     *
+     * @param[in]  aWatcher  The watcher of the file descriptor.
+     * @param[in]  aEvents   The events on the file descriptor (bitwise OR of `kEvent*` constants).
+     */
+    virtual void HandleFdEvents(FdWatcher &aWatcher, uint32_t aEvents)
+    {
+        OT_UNUSED_VARIABLE(aWatcher);
+        OT_UNUSED_VARIABLE(aEvents);
+    }
 
     /**
      * Marks destructor virtual method.
@@ -206,7 +313,26 @@ public:
     static Manager &Get(void);
 
 private:
+    friend class FdWatcher;
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    static constexpr int kMaxEpollEvents = 32;
+#endif
+
+    void Watch(FdWatcher &aWatcher);
+    void Rewatch(FdWatcher &aWatcher);
+    void Unwatch(FdWatcher &aWatcher);
+
     Source *mSources = nullptr;
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    int                 mEpollFd          = -1;
+    uint16_t            mNumWatchers      = 0;
+    struct epoll_event *mPendingEvents    = nullptr;
+    int                 mNumPendingEvents = 0;
+#else
+    FdWatcher *mWatchers    = nullptr;
+    FdWatcher *mNextWatcher = nullptr;
+#endif
 };
 
 } // namespace Mainloop
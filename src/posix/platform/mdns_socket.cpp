@@ -126,6 +126,12 @@ void MdnsSocket::TearDown(void)
         ClearTxQueue();
         mEnabled = false;
     }
+
+    mFd4Watcher.Stop();
+    mFd6Watcher.Stop();
+#if (OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR == OT_POSIX_MDNS_ADDR_MONITOR_NETLINK)
+    mNetlinkWatcher.Stop();
+#endif
 }
 
 void MdnsSocket::Deinit(void)
@@ -136,25 +142,14 @@ void MdnsSocket::Deinit(void)
 
 void MdnsSocket::Update(Mainloop::Context &aContext)
 {
-    VerifyOrExit(mEnabled);
+    // The sockets are watched by `mFd4Watcher` and `mFd6Watcher`.
 
-    Mainloop::AddToReadFdSet(mFd6, aContext);
-    Mainloop::AddToReadFdSet(mFd4, aContext);
+    OT_UNUSED_VARIABLE(aContext);
 
-    if (mPendingIp6Tx > 0)
-    {
-        Mainloop::AddToWriteFdSet(mFd6, aContext);
-    }
-
-    if (mPendingIp4Tx > 0)
-    {
-        Mainloop::AddToWriteFdSet(mFd4, aContext);
-    }
+    VerifyOrExit(mEnabled);
 
 #if (OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR == OT_POSIX_MDNS_ADDR_MONITOR_PERIODIC)
     UpdateTimeout(aContext);
-#elif (OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR == OT_POSIX_MDNS_ADDR_MONITOR_NETLINK)
-    UpdateNetlink(aContext);
 #endif
 
 exit:
@@ -163,38 +158,70 @@ exit:
 
 void MdnsSocket::Process(const Mainloop::Context &aContext)
 {
+    OT_UNUSED_VARIABLE(aContext);
+
     VerifyOrExit(mEnabled);
 
-    if (Mainloop::IsFdWritable(mFd6, aContext))
-    {
-        SendQueuedMessages(kIp6Msg);
-    }
+#if (OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR == OT_POSIX_MDNS_ADDR_MONITOR_PERIODIC)
+    ProcessTimeout();
+#endif
 
-    if (Mainloop::IsFdWritable(mFd4, aContext))
+exit:
+    return;
+}
+
+void MdnsSocket::HandleFdEvents(Mainloop::FdWatcher &aWatcher, uint32_t aEvents)
+{
+    MsgType  msgType     = (&aWatcher == &mFd6Watcher) ? kIp6Msg : kIp4Msg;
+    uint16_t numMessages = 0;
+    otError  error;
+
+#if (OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR == OT_POSIX_MDNS_ADDR_MONITOR_NETLINK)
+    if (&aWatcher == &mNetlinkWatcher)
     {
-        SendQueuedMessages(kIp4Msg);
+        // At most `kMaxRxMessagesPerEvent` messages are read, the
+        // watcher reports the socket again on the next mainloop
+        // iteration if more are pending.
+        do
+        {
+            error = ReceiveNetlinkMessage();
+        } while ((error == OT_ERROR_NONE) && (++numMessages < kMaxRxMessagesPerEvent));
+
+        ExitNow();
     }
+#endif
 
-    if (Mainloop::IsFdReadable(mFd6, aContext))
+    VerifyOrExit(mEnabled);
+
+    if (aEvents & Mainloop::kEventWritable)
     {
-        ReceiveMessage(kIp6Msg);
+        SendQueuedMessages(msgType);
+        UpdateWatchedEvents();
     }
 
-    if (Mainloop::IsFdReadable(mFd4, aContext))
+    if (aEvents & Mainloop::kEventReadable)
     {
-        ReceiveMessage(kIp4Msg);
+        // At most `kMaxRxMessagesPerEvent` messages are read, the
+        // watcher reports the socket again on the next mainloop
+        // iteration if more are pending. The loop stops if mDNS is
+        // disabled from `otPlatMdnsHandleReceive()`.
+        do
+        {
+            error = ReceiveMessage(msgType);
+        } while (mEnabled && (error == OT_ERROR_NONE || error == OT_ERROR_DROP) &&
+                 (++numMessages < kMaxRxMessagesPerEvent));
     }
 
-#if (OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR == OT_POSIX_MDNS_ADDR_MONITOR_PERIODIC)
-    ProcessTimeout();
-#elif (OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR == OT_POSIX_MDNS_ADDR_MONITOR_NETLINK)
-    ProcessNetlink(aContext);
-#endif
-
 exit:
     return;
 }
 
+void MdnsSocket::UpdateWatchedEvents(void)
+{
+    mFd6Watcher.SetEvents(Mainloop::kEventReadable | ((mPendingIp6Tx > 0) ? Mainloop::kEventWritable : 0));
+    mFd4Watcher.SetEvents(Mainloop::kEventReadable | ((mPendingIp4Tx > 0) ? Mainloop::kEventWritable : 0));
+}
+
 otError MdnsSocket::SetListeningEnabled(otInstance *aInstance, bool aEnable, uint32_t aInfraIfIndex)
 {
     otError error = OT_ERROR_NONE;
@@ -228,6 +255,9 @@ otError MdnsSocket::Enable(uint32_t aInfraIfIndex)
     mEnabled      = true;
     mInfraIfIndex = aInfraIfIndex;
 
+    mFd4Watcher.Start(mFd4, Mainloop::kEventReadable);
+    mFd6Watcher.Start(mFd6, Mainloop::kEventReadable);
+
     StartAddressMonitoring();
 
     LogInfo("Enabled");
@@ -287,6 +317,8 @@ void MdnsSocket::SendMulticast(otMessage *aMessage, uint32_t aInfraIfIndex)
     otMessageQueueEnqueue(&mTxQueue, aMessage);
     aMessage = NULL;
 
+    UpdateWatchedEvents();
+
 exit:
     if (aMessage != NULL)
     {
@@ -340,6 +372,8 @@ void MdnsSocket::SendUnicast(otMessage *aMessage, const otPlatMdnsAddressInfo *a
     otMessageQueueEnqueue(&mTxQueue, aMessage);
     aMessage = NULL;
 
+    UpdateWatchedEvents();
+
 exit:
     if (aMessage != NULL)
     {
@@ -505,8 +539,9 @@ exit:
 }
 #endif
 
-void MdnsSocket::ReceiveMessage(MsgType aMsgType)
+otError MdnsSocket::ReceiveMessage(MsgType aMsgType)
 {
+    otError                      error   = OT_ERROR_DROP;
     otMessage                   *message = nullptr;
     uint8_t                      buffer[kMaxMessageLength];
     otPlatMdnsAddressInfo        addrInfo;
@@ -537,18 +572,26 @@ void MdnsSocket::ReceiveMessage(MsgType aMsgType)
     switch (aMsgType)
     {
     case kIp6Msg:
-        rval = recvmsg(mFd6, &msg, 0);
-        VerifyOrExit(rval >= 0, LogCrit("recvmsg() for IPv6 socket failed, errno: %s", strerror(errno)));
-        length = static_cast<uint16_t>(rval);
+        rval = recvmsg(mFd6, &msg, MSG_DONTWAIT);
         break;
 
     case kIp4Msg:
-        rval = recvmsg(mFd4, &msg, 0);
-        VerifyOrExit(rval >= 0, LogCrit("recvmsg() for IPv4 socket failed, errno: %s", strerror(errno)));
-        length = static_cast<uint16_t>(rval);
+        rval = recvmsg(mFd4, &msg, MSG_DONTWAIT);
         break;
     }
 
+    if (rval < 0)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            LogCrit("recvmsg() for %s socket failed, errno: %s", (aMsgType == kIp6Msg) ? "IPv6" : "IPv4",
+                    strerror(errno));
+        }
+
+        ExitNow(error = OT_ERROR_FAILED);
+    }
+
+    length = static_cast<uint16_t>(rval);
     VerifyOrExit(length > 0);
 
 #ifdef __linux__
@@ -610,12 +653,15 @@ void MdnsSocket::ReceiveMessage(MsgType aMsgType)
 
     otPlatMdnsHandleReceive(mInstance, message, /* aInUnicast */ false, &addrInfo);
     message = nullptr;
+    error   = OT_ERROR_NONE;
 
 exit:
     if (message != nullptr)
     {
         otMessageFree(message);
     }
+
+    return error;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -719,11 +765,15 @@ void MdnsSocket::StartAddressMonitoring(void)
     rval = bind(mNetlinkFd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr));
     VerifyOrDie(rval == 0, OT_EXIT_ERROR_ERRNO);
 
+    mNetlinkWatcher.Start(mNetlinkFd, Mainloop::kEventReadable);
+
     ReportInfraIfAddresses();
 }
 
 void MdnsSocket::StopAddressMonitoring(void)
 {
+    mNetlinkWatcher.Stop();
+
     if (mNetlinkFd >= 0)
     {
         close(mNetlinkFd);
@@ -732,9 +782,7 @@ void MdnsSocket::StopAddressMonitoring(void)
     mNetlinkFd = -1;
 }
 
-void MdnsSocket::UpdateNetlink(Mainloop::Context &aContext) const { Mainloop::AddToReadFdSet(mNetlinkFd, aContext); }
-
-void MdnsSocket::ProcessNetlink(const Mainloop::Context &aContext) const
+otError MdnsSocket::ReceiveNetlinkMessage(void) const
 {
     static const size_t kBufSize = 8192;
 
@@ -744,20 +792,23 @@ void MdnsSocket::ProcessNetlink(const Mainloop::Context &aContext) const
         uint8_t         mBuffer[kBufSize];
     };
 
+    otError        error = OT_ERROR_NONE;
     NetlinkMessage rcvMsg;
     ssize_t        rval;
     size_t         len;
 
-    VerifyOrExit(mNetlinkFd >= 0);
+    VerifyOrExit(mNetlinkFd >= 0, error = OT_ERROR_INVALID_STATE);
 
-    VerifyOrExit(Mainloop::IsFdReadable(mNetlinkFd, aContext));
-
-    rval = recv(mNetlinkFd, rcvMsg.mBuffer, sizeof(rcvMsg.mBuffer), 0);
+    rval = recv(mNetlinkFd, rcvMsg.mBuffer, sizeof(rcvMsg.mBuffer), MSG_DONTWAIT);
 
     if (rval < 0)
     {
-        LogCrit("Failed to receive netlink message: %s", strerror(errno));
-        ExitNow();
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            LogCrit("Failed to receive netlink message: %s", strerror(errno));
+        }
+
+        ExitNow(error = OT_ERROR_FAILED);
     }
 
     VerifyOrExit(static_cast<size_t>(rval) <= sizeof(rcvMsg.mBuffer));
@@ -783,7 +834,7 @@ void MdnsSocket::ProcessNetlink(const Mainloop::Context &aContext) const
     }
 
 exit:
-    return;
+    return error;
 }
 
 void MdnsSocket::ProcessNetlinkAddrEvent(void *aNetlinkMsg) const
@@ -925,6 +976,8 @@ otError MdnsSocket::JoinOrLeaveIp4MulticastGroup(bool aJoin, uint32_t aInfraIfIn
 
 void MdnsSocket::CloseIp4Socket(void)
 {
+    mFd4Watcher.Stop();
+
     if (mFd4 >= 0)
     {
         close(mFd4);
@@ -1008,6 +1061,8 @@ otError MdnsSocket::JoinOrLeaveIp6MulticastGroup(bool aJoin, uint32_t aInfraIfIn
 
 void MdnsSocket::CloseIp6Socket(void)
 {
+    mFd6Watcher.Stop();
+
     if (mFd6 >= 0)
     {
         close(mFd6);
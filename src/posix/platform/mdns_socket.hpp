@@ -123,15 +123,24 @@ public:
      */
     void Process(const Mainloop::Context &aContext) override;
 
+    /**
+     * Handles the events of the watched file descriptors.
+     *
+     * @param[in]   aWatcher   The watcher of the file descriptor.
+     * @param[in]   aEvents    The events on the file descriptor.
+     */
+    void HandleFdEvents(Mainloop::FdWatcher &aWatcher, uint32_t aEvents) override;
+
     // otPlatMdns APIs
     otError SetListeningEnabled(otInstance *aInstance, bool aEnable, uint32_t aInfraIfIndex);
     void    SendMulticast(otMessage *aMessage, uint32_t aInfraIfIndex);
     void    SendUnicast(otMessage *aMessage, const otPlatMdnsAddressInfo *aAddress);
 
 private:
-    static constexpr uint16_t kMaxMessageLength  = 2000;
-    static constexpr uint16_t kMdnsPort          = 5353;
-    static constexpr uint64_t kAddrMonitorPeriod = OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR_PERIOD;
+    static constexpr uint16_t kMaxMessageLength      = 2000;
+    static constexpr uint16_t kMdnsPort              = 5353;
+    static constexpr uint64_t kAddrMonitorPeriod     = OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR_PERIOD;
+    static constexpr uint16_t kMaxRxMessagesPerEvent = 16;
 
     enum MsgType : uint8_t
     {
@@ -153,7 +162,8 @@ private:
     void    Disable(uint32_t aInfraIfIndex);
     void    ClearTxQueue(void);
     void    SendQueuedMessages(MsgType aMsgType);
-    void    ReceiveMessage(MsgType aMsgType);
+    otError ReceiveMessage(MsgType aMsgType);
+    void    UpdateWatchedEvents(void);
     void    StartAddressMonitoring(void);
     void    StopAddressMonitoring(void);
     void    ReportInfraIfAddresses(void);
@@ -161,9 +171,8 @@ private:
     void UpdateTimeout(Mainloop::Context &aContext);
     void ProcessTimeout(void);
 #elif (OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR == OT_POSIX_MDNS_ADDR_MONITOR_NETLINK)
-    void UpdateNetlink(Mainloop::Context &aContext) const;
-    void ProcessNetlink(const Mainloop::Context &aContext) const;
-    void ProcessNetlinkAddrEvent(void *aNetlinkMsg) const;
+    otError ReceiveNetlinkMessage(void) const;
+    void    ProcessNetlinkAddrEvent(void *aNetlinkMsg) const;
 #endif
 
     otError OpenIp4Socket(uint32_t aInfraIfIndex);
@@ -188,21 +197,24 @@ private:
                                         uint32_t    aValueLength,
                                         const char *aOptionName);
 
-    bool           mEnabled;
-    uint32_t       mInfraIfIndex;
-    int            mFd4;
-    int            mFd6;
-    uint32_t       mPendingIp6Tx;
-    uint32_t       mPendingIp4Tx;
-    otMessageQueue mTxQueue;
-    otIp6Address   mMulticastIp6Address;
-    otIp4Address   mMulticastIp4Address;
-    otInstance    *mInstance;
+    bool                mEnabled;
+    uint32_t            mInfraIfIndex;
+    int                 mFd4;
+    int                 mFd6;
+    Mainloop::FdWatcher mFd4Watcher{*this};
+    Mainloop::FdWatcher mFd6Watcher{*this};
+    uint32_t            mPendingIp6Tx;
+    uint32_t            mPendingIp4Tx;
+    otMessageQueue      mTxQueue;
+    otIp6Address        mMulticastIp6Address;
+    otIp4Address        mMulticastIp4Address;
+    otInstance         *mInstance;
 #if (OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR == OT_POSIX_MDNS_ADDR_MONITOR_PERIODIC)
     uint64_t mNextReportTime;
 #endif
 #if (OPENTHREAD_POSIX_CONFIG_MDNS_ADDR_MONITOR == OT_POSIX_MDNS_ADDR_MONITOR_NETLINK)
-    int mNetlinkFd;
+    int                 mNetlinkFd;
+    Mainloop::FdWatcher mNetlinkWatcher{*this};
 #endif
 };
 
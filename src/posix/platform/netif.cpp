@@ -163,11 +163,13 @@ extern int
 #include <openthread/thread.h>
 #include <openthread/platform/border_routing.h>
 #include <openthread/platform/misc.h>
+#include <openthread/platform/time.h>
 
 #include "ip6_utils.hpp"
 #include "logger.hpp"
 #include "mainloop.hpp"
 #include "resolver.hpp"
+#include "tun_drainer.hpp"
 #include "utils.hpp"
 #include "common/code_utils.hpp"
 
@@ -260,6 +262,8 @@ static otError destroyTunnel(void);
 static int sTunFd     = -1; ///< Used to exchange IPv6 packets.
 static int sIpFd      = -1; ///< Used to manage IPv6 stack on Thread interface.
 static int sNetlinkFd = -1; ///< Used to receive netlink events.
+
+static ot::Posix::TunDrainer sTunDrainer(OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE);
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
 static int sMLDMonitorFd = -1; ///< Used to receive MLD events.
 #endif
@@ -1250,7 +1254,13 @@ static void processReceive(otMessage *aMessage, void *aContext)
     length += 4;
 #endif
 
-    VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+    {
+        uint64_t startTime = otPlatTimeGet();
+        ssize_t  rval      = write(sTunFd, packet, length);
+
+        sTunDrainer.RecordWrite(rval == length, otPlatTimeGet() - startTime);
+        VerifyOrExit(rval == length, perror("write"); error = OT_ERROR_FAILED);
+    }
 
 exit:
     otMessageFree(aMessage);
@@ -1366,13 +1376,18 @@ exit:
 }
 #endif // __linux__
 
-static void processTransmit(otInstance *aInstance)
+static ot::Posix::TunDrainer::ReadResult processTransmit(otInstance *aInstance)
 {
+    // Reads a single packet from the TUN device and passes it to
+    // OpenThread.
+
     otMessage *message = nullptr;
     ssize_t    rval;
     char       packet[kMaxIp6Size];
     otError    error  = OT_ERROR_NONE;
     size_t     offset = 0;
+
+    ot::Posix::TunDrainer::ReadResult result = ot::Posix::TunDrainer::kReadNone;
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     bool isIp4 = false;
 #endif
@@ -1380,8 +1395,14 @@ static void processTransmit(otInstance *aInstance)
     assert(gInstance == aInstance);
 
     rval = read(sTunFd, packet, sizeof(packet));
+
+    // The TUN device is non-blocking, `EAGAIN` indicates that all
+    // pending packets are read.
+    VerifyOrExit((rval >= 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK)));
     VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
 
+    result = ot::Posix::TunDrainer::kReadPacket;
+
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
     if ((rval >= 4) && (packet[0] == 0) && (packet[1] == 0))
@@ -1445,6 +1466,18 @@ exit:
             LogWarn("Failed to transmit, error:%s", otThreadErrorToString(error));
         }
     }
+
+    if ((result == ot::Posix::TunDrainer::kReadPacket) && (error == OT_ERROR_NO_BUFS))
+    {
+        result = ot::Posix::TunDrainer::kReadPacketNoBufs;
+    }
+
+    return result;
+}
+
+static ot::Posix::TunDrainer::ReadResult readTunPacket(void *aContext)
+{
+    return processTransmit(static_cast<otInstance *>(aContext));
 }
 
 static void logAddrEvent(bool isAdd, const otIp6Address &aAddress, otError error)
@@ -2543,7 +2576,7 @@ void platformNetifProcess(const ot::Posix::Mainloop::Context *aContext)
 
     if (ot::Posix::Mainloop::IsFdReadable(sTunFd, *aContext))
     {
-        processTransmit(gInstance);
+        sTunDrainer.Drain(readTunPacket, gInstance);
     }
 
     if (ot::Posix::Mainloop::IsFdReadable(sNetlinkFd, *aContext))
@@ -2562,4 +2595,19 @@ exit:
     return;
 }
 
+const otSysNetifTunCounters *otSysGetNetifTunCounters(void) { return &sTunDrainer.GetCounters(); }
+
+void otSysResetNetifTunCounters(void) { sTunDrainer.ResetCounters(); }
+
+#else // OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
+
+const otSysNetifTunCounters *otSysGetNetifTunCounters(void)
+{
+    static const otSysNetifTunCounters sTunCounters = {};
+
+    return &sTunCounters;
+}
+
+void otSysResetNetifTunCounters(void) {}
+
 #endif // OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
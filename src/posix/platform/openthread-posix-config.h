@@ -140,6 +140,46 @@
 #define OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+ *
+ * Define as 1 to use the log-structured settings file.
+ *
+ * When enabled, the settings file keeps an in-memory index of all records and maps the data file read-only. Changes
+ * are appended to a separate log file (`<name>.log`) instead of rewriting the whole data file on every `Set`, `Add`
+ * or `Delete`. The log is periodically compacted back into the data file using the swap file.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_THRESHOLD
+ *
+ * The log file size in bytes above which the settings log is compacted into the data file.
+ *
+ * Applicable when `OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_THRESHOLD
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_THRESHOLD (16 * 1024)
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define as 1 to use epoll for the file descriptors watched by `Mainloop::FdWatcher`.
+ *
+ * The watched file descriptors are registered with a single epoll instance in level-triggered mode, and only the epoll
+ * file descriptor is added to the `select()` fd sets. Only available on Linux.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !defined(__linux__)
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE is only supported on Linux"
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_NETIF_LINK_LOCAL_ROUTE_METRIC
  *
@@ -259,6 +299,20 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE
+ *
+ * Specifies the maximum number of packets read from the Thread network interface (TUN device) and passed to
+ * OpenThread in a single mainloop wakeup.
+ *
+ * Larger values reduce the number of mainloop iterations under high host-to-Thread traffic, at the cost of delaying
+ * the processing of other file descriptors. Reading also stops early once OpenThread runs out of message buffers, so
+ * the default of 8 lets a burst of packets be handled in one wakeup without holding up the mainloop for long.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_TUN_BATCH_SIZE 8
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_THREAD_NETIF_DEFAULT_NAME
  *
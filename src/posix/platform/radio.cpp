@@ -493,6 +493,14 @@ void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
     SuccessOrDie(GetRadioSpinel().ClearSrcMatchExtEntries());
 }
 
+otError otPlatRadioUpdateSrcMatchEntries(otInstance                 *aInstance,
+                                         const otRadioSrcMatchEntry *aEntries,
+                                         uint16_t                    aNumEntries)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return GetRadioSpinel().UpdateSrcMatchEntries(aEntries, aNumEntries);
+}
+
 otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -1117,6 +1125,13 @@ otError otPlatResetToBootloader(otInstance *aInstance)
 
 const otRadioSpinelMetrics *otSysGetRadioSpinelMetrics(void) { return &GetRadioSpinel().GetRadioSpinelMetrics(); }
 
+otError otSysGetNextRadioSpinelPropertyRtt(uint8_t *aIterator, otRadioSpinelPropertyRtt *aRtt)
+{
+    return GetRadioSpinel().GetNextPropertyRtt(*aIterator, *aRtt);
+}
+
+void otSysResetRadioSpinelPropertyRtts(void) { GetRadioSpinel().ResetPropertyRtts(); }
+
 const otRcpInterfaceMetrics *otSysGetRcpInterfaceMetrics(void)
 {
     return sRadio.GetSpinelInterface().GetRcpInterfaceMetrics();
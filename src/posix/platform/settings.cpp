@@ -37,6 +37,7 @@
 #include <assert.h>
 #include <fcntl.h>
 #include <inttypes.h>
+#include <limits.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <string.h>
@@ -415,6 +416,99 @@ int main()
         assert(otPlatSettingsGet(instance, 0, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
     }
     otPlatSettingsWipe(instance);
+
+    // verify records are kept after re-init, including after many updates
+    for (uint8_t i = 0; i < 100; i++)
+    {
+        assert(otPlatSettingsSet(instance, 0, &data[i % sizeof(data)], sizeof(data) / 2) == OT_ERROR_NONE);
+        assert(otPlatSettingsAdd(instance, 1, &data[i % sizeof(data)], 1) == OT_ERROR_NONE);
+        assert(i == 0 || otPlatSettingsDelete(instance, 1, 0) == OT_ERROR_NONE);
+    }
+    assert(otPlatSettingsAdd(instance, 2, data, sizeof(data)) == OT_ERROR_NONE);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance, nullptr, 0);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, &data[99 % sizeof(data)], length));
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == 1);
+        assert(value[0] == data[99 % sizeof(data)]);
+        assert(otPlatSettingsGet(instance, 1, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 2, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+    }
+    otPlatSettingsWipe(instance);
+
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+    // verify a partially written log record is dropped on init
+    {
+        ot::Posix::SettingsFile crashedFile;
+        ot::Posix::SettingsFile settingsFile;
+        char                    logFile[PATH_MAX];
+        int                     fd;
+        uint8_t                 value[sizeof(data)];
+        uint16_t                length = sizeof(value);
+
+        assert(crashedFile.Init("self_test") == OT_ERROR_NONE);
+        crashedFile.Wipe();
+        crashedFile.Set(0, data, sizeof(data));
+        crashedFile.Set(1, data, sizeof(data));
+
+        snprintf(logFile, sizeof(logFile), "%s/self_test.log", ot::Posix::SettingsFile::GetSettingsPath());
+        fd = open(logFile, O_RDWR);
+        assert(fd >= 0);
+        assert(ftruncate(fd, lseek(fd, 0, SEEK_END) - 1) == 0);
+        close(fd);
+
+        // Init again without de-initializing `crashedFile`, as after a crash.
+        assert(settingsFile.Init("self_test") == OT_ERROR_NONE);
+        assert(settingsFile.Get(0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+        assert(settingsFile.Get(1, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+        settingsFile.Wipe();
+        settingsFile.Deinit();
+    }
+
+    // verify a zero-filled log record (e.g., the log grew but the record was not written) is dropped on init
+    {
+        ot::Posix::SettingsFile crashedFile;
+        ot::Posix::SettingsFile settingsFile;
+        char                    logFile[PATH_MAX];
+        int                     fd;
+        uint8_t                 value[sizeof(data)];
+        uint16_t                length = sizeof(value);
+
+        assert(crashedFile.Init("self_test") == OT_ERROR_NONE);
+        crashedFile.Wipe();
+        crashedFile.Set(0, data, sizeof(data));
+
+        snprintf(logFile, sizeof(logFile), "%s/self_test.log", ot::Posix::SettingsFile::GetSettingsPath());
+        fd = open(logFile, O_RDWR);
+        assert(fd >= 0);
+        assert(ftruncate(fd, lseek(fd, 0, SEEK_END) + 16) == 0);
+        close(fd);
+
+        assert(settingsFile.Init("self_test") == OT_ERROR_NONE);
+        assert(settingsFile.Get(0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+        assert(settingsFile.Get(0, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+        settingsFile.Wipe();
+        settingsFile.Deinit();
+    }
+#endif
+
+    otPlatSettingsWipe(instance);
     otPlatSettingsDeinit(instance);
 
     return 0;
@@ -38,12 +38,18 @@
 #include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+#include <sys/mman.h>
+#endif
 
 #include "common/code_utils.hpp"
+#include "common/crc.hpp"
 #include "common/debug.hpp"
+#include "common/num_utils.hpp"
 #include "posix/platform/settings_file.hpp"
 
 void platformSettingsInit(const char *aDataPath, const char *aSettingsFileName)
@@ -83,9 +89,11 @@ void SettingsFile::SetSettingsFileName(const char *aSettingsFileName)
 
 otError SettingsFile::Init(const char *aSettingsFileBaseName)
 {
-    otError     error           = OT_ERROR_NONE;
-    const char *directory       = GetSettingsPath();
-    off_t       lastValidOffset = 0;
+    otError     error     = OT_ERROR_NONE;
+    const char *directory = GetSettingsPath();
+#if !OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+    off_t lastValidOffset = 0;
+#endif
 
     OT_ASSERT(strlen(directory) < kMaxFileBasePathNameSize);
     OT_ASSERT((aSettingsFileBaseName != nullptr) && strlen(aSettingsFileBaseName) < kMaxFileBaseNameSize);
@@ -103,12 +111,16 @@ otError SettingsFile::Init(const char *aSettingsFileBaseName)
     {
         char fileName[kMaxFilePathSize];
 
-        GetSettingsFilePath(fileName, false);
+        GetSettingsFilePath(fileName, "data");
         mSettingsFd = open(fileName, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
     }
 
     VerifyOrDie(mSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
 
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+    error = LoadDataFile();
+    LoadLogFile();
+#else
     for (off_t size = lseek(mSettingsFd, 0, SEEK_END), offset = lseek(mSettingsFd, 0, SEEK_SET); offset < size;)
     {
         lastValidOffset = offset;
@@ -130,25 +142,487 @@ otError SettingsFile::Init(const char *aSettingsFileBaseName)
 exit:
     if (error == OT_ERROR_PARSE)
     {
-        off_t fileSize = lseek(mSettingsFd, 0, SEEK_END);
+        TruncateCorruptFile(mSettingsFd, lastValidOffset);
+    }
+#endif
+
+    return error;
+}
+
+void SettingsFile::TruncateCorruptFile(int aFd, off_t aLastValidOffset)
+{
+    off_t fileSize = lseek(aFd, 0, SEEK_END);
+
+    if (aLastValidOffset > 0)
+    {
+        otLogCritPlat("Settings file corrupt at offset %jd of %jd bytes, truncating to preserve %jd bytes of "
+                      "valid entries",
+                      (intmax_t)aLastValidOffset, (intmax_t)fileSize, (intmax_t)aLastValidOffset);
+    }
+    else
+    {
+        otLogCritPlat("Settings file corrupt from start (%jd bytes), truncating entire file", (intmax_t)fileSize);
+    }
+
+    VerifyOrDie(ftruncate(aFd, aLastValidOffset) == 0, OT_EXIT_ERROR_ERRNO);
+}
+
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+
+void SettingsFile::Deinit(void)
+{
+    VerifyOrExit(mSettingsFd != -1);
+
+    // Fold the log into the data file, so that the data file alone
+    // holds all the settings after a clean shutdown.
+    if (mLogLength > static_cast<off_t>(sizeof(LogHeader)))
+    {
+        Compact();
+    }
+
+    MapFile(-1, 0, mDataMap, mDataMapLength);
+    MapFile(-1, 0, mLogMap, mLogMapLength);
+    VerifyOrDie(close(mLogFd) == 0, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(close(mSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+    mLogFd      = -1;
+    mLogLength  = 0;
+    mSettingsFd = -1;
+
+    free(mEntries);
+    mEntries         = nullptr;
+    mNumEntries      = 0;
+    mEntriesCapacity = 0;
+
+exit:
+    return;
+}
+
+otError SettingsFile::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    otError      error = OT_ERROR_NOT_FOUND;
+    uint32_t     position;
+    const Entry *entry;
+
+    OT_ASSERT(mSettingsFd >= 0);
+
+    position = FindPosition(aKey);
+    VerifyOrExit((aIndex >= 0) && (static_cast<uint32_t>(aIndex) < mNumEntries - position));
+    position += static_cast<uint32_t>(aIndex);
+    VerifyOrExit(mEntries[position].mKey == aKey);
+
+    entry = &mEntries[position];
+    error = OT_ERROR_NONE;
+
+    if (aValueLength)
+    {
+        if (aValue)
+        {
+            memcpy(aValue, GetValue(*entry), (entry->mLength <= *aValueLength ? entry->mLength : *aValueLength));
+        }
+
+        *aValueLength = entry->mLength;
+    }
+
+exit:
+    return error;
+}
+
+void SettingsFile::Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    Entry entry;
+
+    OT_ASSERT(mSettingsFd >= 0);
+
+    entry.mOffset = AppendLogRecord(kOperationSet, aKey, 0, aValue, aValueLength);
+    entry.mKey    = aKey;
+    entry.mLength = aValueLength;
+    entry.mInLog  = true;
+
+    IgnoreError(RemoveEntries(aKey, -1));
+    InsertEntry(entry);
+
+    CompactIfNeeded();
+}
+
+void SettingsFile::Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    Entry entry;
+
+    OT_ASSERT(mSettingsFd >= 0);
+
+    entry.mOffset = AppendLogRecord(kOperationAdd, aKey, 0, aValue, aValueLength);
+    entry.mKey    = aKey;
+    entry.mLength = aValueLength;
+    entry.mInLog  = true;
+
+    InsertEntry(entry);
+
+    CompactIfNeeded();
+}
+
+otError SettingsFile::Delete(uint16_t aKey, int aIndex)
+{
+    otError error;
+
+    OT_ASSERT(mSettingsFd >= 0);
+
+    SuccessOrExit(error = RemoveEntries(aKey, aIndex));
+    IgnoreReturnValue(AppendLogRecord(kOperationDelete, aKey, aIndex, nullptr, 0));
+
+    CompactIfNeeded();
+
+exit:
+    return error;
+}
+
+void SettingsFile::Wipe(void)
+{
+    // Truncating a non-empty data file invalidates the log (its
+    // header no longer matches), otherwise resetting the log is
+    // the step which drops all the settings.
+
+    if (mDataMapLength > 0)
+    {
+        MapFile(-1, 0, mDataMap, mDataMapLength);
+        VerifyOrDie(0 == ftruncate(mSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie(0 == fsync(mSettingsFd), OT_EXIT_ERROR_ERRNO);
+    }
+
+    mNumEntries = 0;
+    ResetLog();
+}
+
+otError SettingsFile::LoadDataFile(void)
+{
+    otError error = OT_ERROR_NONE;
+    off_t   size  = lseek(mSettingsFd, 0, SEEK_END);
+    off_t   offset;
+
+    VerifyOrDie(size >= 0, OT_EXIT_ERROR_ERRNO);
+    MapFile(mSettingsFd, static_cast<size_t>(size), mDataMap, mDataMapLength);
+    mNumEntries = 0;
+
+    for (offset = 0; offset < size;)
+    {
+        Entry entry;
+
+        VerifyOrExit(size - offset >= static_cast<off_t>(sizeof(entry.mKey) + sizeof(entry.mLength)),
+                     error = OT_ERROR_PARSE);
+
+        memcpy(&entry.mKey, &mDataMap[offset], sizeof(entry.mKey));
+        memcpy(&entry.mLength, &mDataMap[offset + sizeof(entry.mKey)], sizeof(entry.mLength));
+        entry.mOffset = static_cast<uint32_t>(offset + sizeof(entry.mKey) + sizeof(entry.mLength));
+        entry.mInLog  = false;
+
+        VerifyOrExit(size - entry.mOffset >= entry.mLength, error = OT_ERROR_PARSE);
+
+        InsertEntry(entry);
+        offset = entry.mOffset + entry.mLength;
+    }
+
+exit:
+    if (error == OT_ERROR_PARSE)
+    {
+        TruncateCorruptFile(mSettingsFd, offset);
+        MapFile(mSettingsFd, static_cast<size_t>(offset), mDataMap, mDataMapLength);
+    }
+
+    return error;
+}
+
+void SettingsFile::LoadLogFile(void)
+{
+    char      fileName[kMaxFilePathSize];
+    off_t     size;
+    off_t     offset = sizeof(LogHeader);
+    LogHeader header;
+
+    GetSettingsFilePath(fileName, "log");
+    mLogFd = open(fileName, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    VerifyOrDie(mLogFd != -1, OT_EXIT_ERROR_ERRNO);
+
+    size = lseek(mLogFd, 0, SEEK_END);
+    VerifyOrDie(size >= 0, OT_EXIT_ERROR_ERRNO);
+
+    // A log not matching the current data file content is either
+    // empty or was already compacted into the data file before a
+    // crash or power loss, so it is discarded.
+
+    VerifyOrExit(size >= offset, ResetLog());
+    VerifyOrDie(pread(mLogFd, &header, sizeof(header), 0) == sizeof(header), OT_EXIT_ERROR_ERRNO);
+    VerifyOrExit(header.mMagic == kLogMagic && header.mDataLength == mDataMapLength &&
+                     header.mDataCrc == ComputeCrc(mDataMap, mDataMapLength),
+                 ResetLog());
 
-        if (lastValidOffset > 0)
+    MapFile(mLogFd, static_cast<size_t>(size), mLogMap, mLogMapLength);
+    mLogLength = offset;
+
+    while (offset < size)
+    {
+        LogRecordHeader record;
+        Entry           entry;
+
+        // A partially written record at the end of the log (e.g., the
+        // last operation was interrupted) is detected by its length or
+        // CRC and dropped along with anything after it.
+
+        VerifyOrExit(size - offset >= static_cast<off_t>(sizeof(record)));
+        memcpy(&record, &mLogMap[offset], sizeof(record));
+        offset += sizeof(record);
+
+        VerifyOrExit(size - offset >= record.mLength && record.mCrc == ComputeCrc(record, &mLogMap[offset]));
+
+        entry.mOffset = static_cast<uint32_t>(offset);
+        entry.mKey    = record.mKey;
+        entry.mLength = record.mLength;
+        entry.mInLog  = true;
+
+        switch (record.mOperation)
         {
-            otLogCritPlat("Settings file corrupt at offset %jd of %jd bytes, truncating to preserve %jd bytes of "
-                          "valid entries",
-                          (intmax_t)lastValidOffset, (intmax_t)fileSize, (intmax_t)lastValidOffset);
+        case kOperationSet:
+            IgnoreError(RemoveEntries(record.mKey, -1));
+            OT_FALL_THROUGH;
+
+        case kOperationAdd:
+            InsertEntry(entry);
+            break;
+
+        case kOperationDelete:
+            IgnoreError(RemoveEntries(record.mKey, record.mIndex));
+            break;
+
+        default:
+            break;
+        }
+
+        offset += record.mLength;
+        mLogLength = offset;
+    }
+
+exit:
+    if ((mLogMap != nullptr) && (mLogLength < size))
+    {
+        TruncateCorruptFile(mLogFd, mLogLength);
+        MapFile(mLogFd, static_cast<size_t>(mLogLength), mLogMap, mLogMapLength);
+    }
+}
+
+void SettingsFile::ResetLog(void)
+{
+    LogHeader header;
+
+    header.mMagic      = kLogMagic;
+    header.mDataLength = static_cast<uint32_t>(mDataMapLength);
+    header.mDataCrc    = ComputeCrc(mDataMap, mDataMapLength);
+
+    MapFile(-1, 0, mLogMap, mLogMapLength);
+    VerifyOrDie(0 == ftruncate(mLogFd, 0), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(pwrite(mLogFd, &header, sizeof(header), 0) == sizeof(header), OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(0 == fsync(mLogFd), OT_EXIT_ERROR_ERRNO);
+
+    mLogLength = sizeof(header);
+}
+
+uint32_t SettingsFile::AppendLogRecord(Operation      aOperation,
+                                       uint16_t       aKey,
+                                       int            aIndex,
+                                       const uint8_t *aValue,
+                                       uint16_t       aValueLength)
+{
+    LogRecordHeader record;
+    off_t           offset = mLogLength + static_cast<off_t>(sizeof(record));
+
+    record.mKey       = aKey;
+    record.mLength    = aValueLength;
+    record.mIndex     = static_cast<int16_t>(aIndex);
+    record.mOperation = aOperation;
+    record.mReserved  = 0;
+    record.mCrc       = ComputeCrc(record, aValue);
+
+    VerifyOrDie(pwrite(mLogFd, &record, sizeof(record), mLogLength) == sizeof(record) &&
+                    pwrite(mLogFd, aValue, aValueLength, offset) == aValueLength,
+                OT_EXIT_FAILURE);
+    VerifyOrDie(0 == fsync(mLogFd), OT_EXIT_ERROR_ERRNO);
+
+    mLogLength = offset + aValueLength;
+
+    return static_cast<uint32_t>(offset);
+}
+
+void SettingsFile::CompactIfNeeded(void)
+{
+    if (mLogLength > kLogCompactThreshold)
+    {
+        Compact();
+    }
+}
+
+void SettingsFile::Compact(void)
+{
+    // The live entries are written to the swap file which then
+    // atomically replaces the data file, exactly as the non-log
+    // settings file does for every change. Until the log is reset,
+    // its header does not match the new data file, so a crash in
+    // between cannot apply the log twice.
+
+    int      swapFd = SwapOpen();
+    uint32_t offset = 0;
+
+    for (uint32_t i = 0; i < mNumEntries; i++)
+    {
+        Entry &entry = mEntries[i];
+
+        VerifyOrDie(write(swapFd, &entry.mKey, sizeof(entry.mKey)) == sizeof(entry.mKey) &&
+                        write(swapFd, &entry.mLength, sizeof(entry.mLength)) == sizeof(entry.mLength) &&
+                        write(swapFd, GetValue(entry), entry.mLength) == entry.mLength,
+                    OT_EXIT_FAILURE);
+
+        offset += sizeof(entry.mKey) + sizeof(entry.mLength);
+        entry.mOffset = offset;
+        entry.mInLog  = false;
+        offset += entry.mLength;
+    }
+
+    SwapPersist(swapFd);
+    MapFile(mSettingsFd, offset, mDataMap, mDataMapLength);
+    ResetLog();
+}
+
+const uint8_t *SettingsFile::GetValue(const Entry &aEntry)
+{
+    if (aEntry.mInLog && (aEntry.mOffset + aEntry.mLength > mLogMapLength))
+    {
+        // The log has grown since it was mapped.
+        MapFile(mLogFd, static_cast<size_t>(mLogLength), mLogMap, mLogMapLength);
+    }
+
+    return (aEntry.mInLog ? mLogMap : mDataMap) + aEntry.mOffset;
+}
+
+uint32_t SettingsFile::FindPosition(uint32_t aKey) const
+{
+    // Entries are sorted by key, and entries with the same key are
+    // kept in the order they were added. Returns the position of the
+    // first entry with a key greater than or equal to `aKey`.
+
+    uint32_t low  = 0;
+    uint32_t high = mNumEntries;
+
+    while (low < high)
+    {
+        uint32_t middle = low + (high - low) / 2;
+
+        if (mEntries[middle].mKey < aKey)
+        {
+            low = middle + 1;
         }
         else
         {
-            otLogCritPlat("Settings file corrupt from start (%jd bytes), truncating entire file", (intmax_t)fileSize);
+            high = middle;
         }
+    }
 
-        VerifyOrDie(ftruncate(mSettingsFd, lastValidOffset) == 0, OT_EXIT_ERROR_ERRNO);
+    return low;
+}
+
+void SettingsFile::InsertEntry(const Entry &aEntry)
+{
+    uint32_t position = FindPosition(static_cast<uint32_t>(aEntry.mKey) + 1);
+
+    if (mNumEntries == mEntriesCapacity)
+    {
+        mEntriesCapacity = (mEntriesCapacity == 0) ? 16 : mEntriesCapacity * 2;
+        mEntries         = static_cast<Entry *>(realloc(mEntries, mEntriesCapacity * sizeof(Entry)));
+        VerifyOrDie(mEntries != nullptr, OT_EXIT_FAILURE);
     }
 
+    memmove(&mEntries[position + 1], &mEntries[position], (mNumEntries - position) * sizeof(Entry));
+    mEntries[position] = aEntry;
+    mNumEntries++;
+}
+
+otError SettingsFile::RemoveEntries(uint16_t aKey, int aIndex)
+{
+    otError  error = OT_ERROR_NOT_FOUND;
+    uint32_t start = FindPosition(aKey);
+    uint32_t end   = FindPosition(static_cast<uint32_t>(aKey) + 1);
+
+    if (aIndex == -1)
+    {
+        VerifyOrExit(start < end);
+    }
+    else
+    {
+        VerifyOrExit((aIndex >= 0) && (static_cast<uint32_t>(aIndex) < end - start));
+        start += static_cast<uint32_t>(aIndex);
+        end = start + 1;
+    }
+
+    memmove(&mEntries[start], &mEntries[end], (mNumEntries - end) * sizeof(Entry));
+    mNumEntries -= end - start;
+    error = OT_ERROR_NONE;
+
+exit:
     return error;
 }
 
+void SettingsFile::MapFile(int aFd, size_t aLength, uint8_t *&aMap, size_t &aMapLength)
+{
+    if (aMap != nullptr)
+    {
+        VerifyOrDie(0 == munmap(aMap, aMapLength), OT_EXIT_ERROR_ERRNO);
+        aMap       = nullptr;
+        aMapLength = 0;
+    }
+
+    VerifyOrExit(aLength > 0);
+
+    aMap = static_cast<uint8_t *>(mmap(nullptr, aLength, PROT_READ, MAP_SHARED, aFd, 0));
+    VerifyOrDie(aMap != MAP_FAILED, OT_EXIT_ERROR_ERRNO);
+    aMapLength = aLength;
+
+exit:
+    return;
+}
+
+uint32_t SettingsFile::ComputeCrc(const void *aData, size_t aLength)
+{
+    CrcCalculator<uint32_t> crc(kCrc32AnsiPolynomial);
+    const uint8_t          *data = static_cast<const uint8_t *>(aData);
+    const uint32_t          seed = kLogMagic;
+
+    // The CRC is seeded with the magic so that all-zero data (e.g.,
+    // a zero-filled log record or data file left by a crash) does not
+    // match a zero CRC. `FeedBytes()` takes a `uint16_t` length, so a
+    // large data file is fed in chunks.
+
+    crc.Feed(seed);
+
+    while (aLength > 0)
+    {
+        uint16_t length = static_cast<uint16_t>(Min<size_t>(aLength, NumericLimits<uint16_t>::kMax));
+
+        crc.FeedBytes(data, length);
+        data += length;
+        aLength -= length;
+    }
+
+    return crc.GetCrc();
+}
+
+uint32_t SettingsFile::ComputeCrc(const LogRecordHeader &aHeader, const uint8_t *aValue)
+{
+    CrcCalculator<uint32_t> crc(kCrc32AnsiPolynomial);
+    const uint32_t          seed = kLogMagic;
+
+    crc.Feed(seed);
+    crc.FeedBytes(&aHeader.mKey, sizeof(aHeader) - offsetof(LogRecordHeader, mKey));
+
+    return crc.FeedBytes(aValue, aHeader.mLength);
+}
+
+#else // OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+
 void SettingsFile::Deinit(void)
 {
     VerifyOrExit(mSettingsFd != -1);
@@ -353,11 +827,13 @@ exit:
 
 void SettingsFile::Wipe(void) { VerifyOrDie(0 == ftruncate(mSettingsFd, 0), OT_EXIT_ERROR_ERRNO); }
 
-void SettingsFile::GetSettingsFilePath(char aFileName[kMaxFilePathSize], bool aSwap)
+#endif // OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+
+void SettingsFile::GetSettingsFilePath(char aFileName[kMaxFilePathSize], const char *aExtension)
 {
     int length;
 
-    length = snprintf(aFileName, kMaxFilePathSize, "%s.%s", mSettingsFileFullPathName, (aSwap ? "Swap" : "data"));
+    length = snprintf(aFileName, kMaxFilePathSize, "%s.%s", mSettingsFileFullPathName, aExtension);
     VerifyOrDie(length > 0 && static_cast<size_t>(length) < kMaxFilePathSize, OT_EXIT_FAILURE);
 }
 
@@ -366,7 +842,7 @@ int SettingsFile::SwapOpen(void)
     char fileName[kMaxFilePathSize];
     int  fd;
 
-    GetSettingsFilePath(fileName, true);
+    GetSettingsFilePath(fileName, "Swap");
 
     fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
     VerifyOrDie(fd != -1, OT_EXIT_ERROR_ERRNO);
@@ -374,6 +850,7 @@ int SettingsFile::SwapOpen(void)
     return fd;
 }
 
+#if !OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
 void SettingsFile::SwapWrite(int aFd, uint16_t aLength)
 {
     const size_t kBlockSize = 512;
@@ -393,13 +870,15 @@ void SettingsFile::SwapWrite(int aFd, uint16_t aLength)
     }
 }
 
+#endif
+
 void SettingsFile::SwapPersist(int aFd)
 {
     char swapFile[kMaxFilePathSize];
     char dataFile[kMaxFilePathSize];
 
-    GetSettingsFilePath(swapFile, true);
-    GetSettingsFilePath(dataFile, false);
+    GetSettingsFilePath(swapFile, "Swap");
+    GetSettingsFilePath(dataFile, "data");
 
     VerifyOrDie(0 == close(mSettingsFd), OT_EXIT_ERROR_ERRNO);
     VerifyOrDie(0 == fsync(aFd), OT_EXIT_ERROR_ERRNO);
@@ -422,14 +901,16 @@ void SettingsFile::SwapPersist(int aFd)
     mSettingsFd = aFd;
 }
 
+#if !OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
 void SettingsFile::SwapDiscard(int aFd)
 {
     char swapFileName[kMaxFilePathSize];
 
     VerifyOrDie(0 == close(aFd), OT_EXIT_ERROR_ERRNO);
-    GetSettingsFilePath(swapFileName, true);
+    GetSettingsFilePath(swapFileName, "Swap");
     VerifyOrDie(0 == unlink(swapFileName), OT_EXIT_ERROR_ERRNO);
 }
+#endif
 
 } // namespace Posix
 } // namespace ot
@@ -30,6 +30,7 @@
 #define OT_POSIX_PLATFORM_SETTINGS_FILE_HPP_
 
 #include <limits.h>
+#include <sys/types.h>
 
 #include "openthread-posix-config.h"
 #include "platform-posix.h"
@@ -72,6 +73,17 @@ public:
 
     SettingsFile(void)
         : mSettingsFd(-1)
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+        , mLogFd(-1)
+        , mLogLength(0)
+        , mDataMap(nullptr)
+        , mDataMapLength(0)
+        , mLogMap(nullptr)
+        , mLogMapLength(0)
+        , mEntries(nullptr)
+        , mNumEntries(0)
+        , mEntriesCapacity(0)
+#endif
     {
     }
 
@@ -140,22 +152,94 @@ public:
 
 private:
     static constexpr size_t kSlashLength             = 1;
-    static constexpr size_t kMaxFileExtensionLength  = 5; ///< The length of `.Swap` or `.data`.
+    static constexpr size_t kMaxFileExtensionLength  = 5; ///< The length of `.Swap`, `.data` or `.log`.
     static constexpr size_t kMaxFileFullPathNameSize = PATH_MAX - kMaxFileExtensionLength;
     static constexpr size_t kMaxFileBasePathNameSize = kMaxFileFullPathNameSize - kSlashLength - kMaxFileBaseNameSize;
     static constexpr size_t kMaxFilePathSize         = PATH_MAX;
 
+    void TruncateCorruptFile(int aFd, off_t aLastValidOffset);
+    void GetSettingsFilePath(char aFileName[kMaxFilePathSize], const char *aExtension);
+    int  SwapOpen(void);
+    void SwapPersist(int aFd);
+
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+    // The data file uses the same format as the plain settings file.
+    // Changes are appended to the log file, which starts with a
+    // `LogHeader` identifying the data file content it applies to
+    // (so a log which is already compacted into the data file is
+    // discarded), followed by `LogRecordHeader` and value pairs.
+
+    static constexpr uint32_t kLogMagic            = 0x4c53544f; // "OTSL"
+    static constexpr off_t    kLogCompactThreshold = OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_THRESHOLD;
+
+    enum Operation : uint8_t
+    {
+        kOperationAdd,
+        kOperationSet,
+        kOperationDelete,
+    };
+
+    struct LogHeader
+    {
+        uint32_t mMagic;
+        uint32_t mDataLength;
+        uint32_t mDataCrc;
+    };
+
+    struct LogRecordHeader
+    {
+        uint32_t mCrc; // Covers the rest of the header and the value.
+        uint16_t mKey;
+        uint16_t mLength;
+        int16_t  mIndex;
+        uint8_t  mOperation;
+        uint8_t  mReserved;
+    };
+
+    struct Entry
+    {
+        uint32_t mOffset; // Offset of the value in the data or log file.
+        uint16_t mKey;
+        uint16_t mLength;
+        bool     mInLog;
+    };
+
+    otError        LoadDataFile(void);
+    void           LoadLogFile(void);
+    void           ResetLog(void);
+    uint32_t       AppendLogRecord(Operation aOperation, uint16_t aKey, int aIndex, const uint8_t *aValue,
+                                   uint16_t aValueLength);
+    void           CompactIfNeeded(void);
+    void           Compact(void);
+    const uint8_t *GetValue(const Entry &aEntry);
+    uint32_t       FindPosition(uint32_t aKey) const;
+    void           InsertEntry(const Entry &aEntry);
+    otError        RemoveEntries(uint16_t aKey, int aIndex);
+
+    static void     MapFile(int aFd, size_t aLength, uint8_t *&aMap, size_t &aMapLength);
+    static uint32_t ComputeCrc(const void *aData, size_t aLength);
+    static uint32_t ComputeCrc(const LogRecordHeader &aHeader, const uint8_t *aValue);
+#else
     otError Delete(uint16_t aKey, int aIndex, int *aSwapFd);
-    void    GetSettingsFilePath(char aFileName[kMaxFilePathSize], bool aSwap);
-    int     SwapOpen(void);
     void    SwapWrite(int aFd, uint16_t aLength);
-    void    SwapPersist(int aFd);
     void    SwapDiscard(int aFd);
+#endif
 
     static char sSettingsPath[kMaxFileBasePathNameSize];
     static char sSettingsFileName[kMaxFileBaseNameSize];
     char        mSettingsFileFullPathName[kMaxFileFullPathNameSize];
     int         mSettingsFd;
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_ENABLE
+    int      mLogFd;
+    off_t    mLogLength;
+    uint8_t *mDataMap;
+    size_t   mDataMapLength;
+    uint8_t *mLogMap;
+    size_t   mLogMapLength;
+    Entry   *mEntries;
+    uint32_t mNumEntries;
+    uint32_t mEntriesCapacity;
+#endif
 };
 
 } // namespace Posix
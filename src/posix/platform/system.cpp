@@ -250,14 +250,6 @@ void platformSetUp(otPlatformConfig *aPlatformConfig)
     platformResolverSetUp();
 #endif
 
-#if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
-    ot::Posix::Udp::Get().SetUp();
-#endif
-
-#if OPENTHREAD_CONFIG_PLATFORM_TCP_ENABLE
-    ot::Posix::Tcp::Get().SetUp();
-#endif
-
 #if OPENTHREAD_CONFIG_MULTICAST_DNS_ENABLE
     ot::Posix::MdnsSocket::Get().SetUp();
 #endif
@@ -316,14 +308,6 @@ void platformTearDown(void)
     ot::Posix::Daemon::Get().TearDown();
 #endif
 
-#if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
-    ot::Posix::Udp::Get().TearDown();
-#endif
-
-#if OPENTHREAD_CONFIG_PLATFORM_TCP_ENABLE
-    ot::Posix::Tcp::Get().TearDown();
-#endif
-
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
     platformNetifTearDown();
 #endif
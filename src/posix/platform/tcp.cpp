@@ -69,14 +69,100 @@ namespace {
 
 constexpr int kMaxListenBacklog     = 5;
 constexpr int kMaxReceiveBufferSize = 1500;
+constexpr int kMaxAcceptsPerEvent   = 8;
+constexpr int kMaxReceivesPerEvent  = 16;
 
-int GetFd(otPlatTcpListener *aListener) { return aListener->mData.mDescriptor; }
+// The platform data of a TCP listener or connection points to the
+// watcher of its file descriptor, or is null if there is none.
+class SocketWatcher : public ot::Posix::Mainloop::FdWatcher
+{
+public:
+    explicit SocketWatcher(otPlatTcpListener &aListener)
+        : FdWatcher(ot::Posix::Tcp::Get())
+        , mListener(&aListener)
+        , mConn(nullptr)
+    {
+    }
+
+    explicit SocketWatcher(otPlatTcpConnection &aConn)
+        : FdWatcher(ot::Posix::Tcp::Get())
+        , mListener(nullptr)
+        , mConn(&aConn)
+    {
+    }
+
+    otPlatTcpListener   *GetListener(void) const { return mListener; }
+    otPlatTcpConnection *GetConnection(void) const { return mConn; }
+
+private:
+    otPlatTcpListener   *mListener;
+    otPlatTcpConnection *mConn;
+};
+
+SocketWatcher *GetWatcher(const otPlatTcpPlatformData &aData) { return static_cast<SocketWatcher *>(aData.mContext); }
+
+int GetFd(const otPlatTcpPlatformData &aData)
+{
+    const SocketWatcher *watcher = GetWatcher(aData);
+
+    return (watcher != nullptr) ? watcher->GetFd() : -1;
+}
+
+int GetFd(otPlatTcpListener *aListener) { return GetFd(aListener->mData); }
+
+int GetFd(otPlatTcpConnection *aConn) { return GetFd(aConn->mData); }
+
+void WatchFd(otPlatTcpListener *aListener, int aFd)
+{
+    SocketWatcher *watcher = new SocketWatcher(*aListener);
+
+    watcher->Start(aFd, ot::Posix::Mainloop::kEventReadable);
+    aListener->mData.mContext = watcher;
+}
+
+void WatchFd(otPlatTcpConnection *aConn, int aFd, uint32_t aEvents)
+{
+    SocketWatcher *watcher = new SocketWatcher(*aConn);
+
+    watcher->Start(aFd, aEvents);
+    aConn->mData.mContext = watcher;
+}
+
+void UpdateConnectedEvents(otPlatTcpConnection *aConn)
+{
+    SocketWatcher *watcher = GetWatcher(aConn->mData);
+    uint32_t       events  = ot::Posix::Mainloop::kEventReadable;
+
+    VerifyOrExit(watcher != nullptr);
+
+    if (otPlatTcpIsTxPending(aConn))
+    {
+        events |= ot::Posix::Mainloop::kEventWritable;
+    }
+
+    watcher->SetEvents(events);
+
+exit:
+    return;
+}
+
+void CloseFd(otPlatTcpPlatformData &aData)
+{
+    SocketWatcher *watcher = GetWatcher(aData);
+    int            fd;
 
-void SetFd(otPlatTcpListener *aListener, int aFd) { aListener->mData.mDescriptor = aFd; }
+    VerifyOrExit(watcher != nullptr);
 
-int GetFd(otPlatTcpConnection *aConn) { return aConn->mData.mDescriptor; }
+    fd = watcher->GetFd();
+    watcher->Stop();
+    delete watcher;
+    aData.mContext = nullptr;
 
-void SetFd(otPlatTcpConnection *aConn, int aFd) { aConn->mData.mDescriptor = aFd; }
+    close(fd);
+
+exit:
+    return;
+}
 
 void ConvertSockAddr(const otPlatTcpSockAddr &aIn, struct sockaddr_in6 &aOut)
 {
@@ -167,7 +253,7 @@ extern "C" otError otPlatTcpEnableListener(otPlatTcpListener *aListener, const o
         ExitNow(error = OT_ERROR_FAILED);
     }
 
-    SetFd(aListener, fd);
+    WatchFd(aListener, fd);
     fd = -1;
 
 exit:
@@ -179,18 +265,7 @@ exit:
     return error;
 }
 
-extern "C" void otPlatTcpDisableListener(otPlatTcpListener *aListener)
-{
-    int fd = GetFd(aListener);
-
-    VerifyOrExit(fd >= 0);
-
-    close(fd);
-    SetFd(aListener, -1);
-
-exit:
-    return;
-}
+extern "C" void otPlatTcpDisableListener(otPlatTcpListener *aListener) { CloseFd(aListener->mData); }
 
 extern "C" otError otPlatTcpConnect(otPlatTcpConnection     *aConn,
                                     const otPlatTcpSockAddr *aPeerSockAddr,
@@ -234,7 +309,9 @@ extern "C" otError otPlatTcpConnect(otPlatTcpConnection     *aConn,
         }
     }
 
-    SetFd(aConn, fd);
+    // The socket becomes writable once the connection is established
+    // or has failed.
+    WatchFd(aConn, fd, ot::Posix::Mainloop::kEventWritable);
     fd = -1;
 
 exit:
@@ -248,10 +325,14 @@ exit:
 
 extern "C" void otPlatTcpNotifyTxPending(otPlatTcpConnection *aConn)
 {
-    // No action requires since we use `otPlatTcpIsTxPending()`
-    // in `Update(Mainloop::Context &aContext)`.
+    // While connecting, the socket is already watched for becoming
+    // writable and the events are updated once it is connected.
+    VerifyOrExit(!otPlatTcpIsConnecting(aConn));
 
-    OT_UNUSED_VARIABLE(aConn);
+    UpdateConnectedEvents(aConn);
+
+exit:
+    return;
 }
 
 extern "C" uint16_t otPlatTcpSend(otPlatTcpConnection *aConn, const uint8_t *aBuffer, uint16_t aLength)
@@ -275,13 +356,7 @@ exit:
 
 extern "C" void otPlatTcpClose(otPlatTcpConnection *aConn)
 {
-    int fd = GetFd(aConn);
-
-    if (fd >= 0)
-    {
-        close(fd);
-        SetFd(aConn, -1);
-    }
+    CloseFd(aConn->mData);
 
     otPlatTcpHandleDisconnected(aConn, OT_PLAT_TCP_DISCONNECT_REASON_CLOSED);
 }
@@ -297,8 +372,7 @@ extern "C" void otPlatTcpAbort(otPlatTcpConnection *aConn)
     sl.l_linger = 0;
     setsockopt(fd, SOL_SOCKET, SO_LINGER, &sl, sizeof(sl));
 
-    close(fd);
-    SetFd(aConn, -1);
+    CloseFd(aConn->mData);
 
 exit:
     return;
@@ -321,74 +395,45 @@ Tcp &Tcp::Get(void)
 
 void Tcp::Init(void) { LogDebg("Init"); }
 
-void Tcp::SetUp(void) { Mainloop::Manager::Get().Add(*this); }
-
-void Tcp::TearDown(void) { Mainloop::Manager::Get().Remove(*this); }
-
 void Tcp::Deinit(void) { LogDebg("Deinit"); }
 
-void Tcp::Update(Mainloop::Context &aContext)
+void Tcp::HandleFdEvents(Mainloop::FdWatcher &aWatcher, uint32_t aEvents)
 {
-    otPlatTcpListener   *listener = nullptr;
-    otPlatTcpConnection *conn     = nullptr;
+    SocketWatcher &watcher = static_cast<SocketWatcher &>(aWatcher);
 
-    while ((listener = otPlatTcpIterateListeners(gInstance, listener)) != nullptr)
+    if (watcher.GetListener() != nullptr)
     {
-        Mainloop::AddToReadFdSet(GetFd(listener), aContext);
-    }
+        otPlatTcpListener *listener = watcher.GetListener();
 
-    while ((conn = otPlatTcpIterateConnections(gInstance, conn)) != nullptr)
-    {
-        int fd = GetFd(conn);
-
-        if (otPlatTcpIsConnecting(conn))
+        // At most `kMaxAcceptsPerEvent` connections are accepted, the
+        // watcher reports the listener again on the next mainloop
+        // iteration if more are pending.
+        for (int i = 0; (i < kMaxAcceptsPerEvent) && (AcceptConnection(listener) == OT_ERROR_NONE); i++)
         {
-            Mainloop::AddToWriteFdSet(fd, aContext);
-            Mainloop::AddToErrorFdSet(fd, aContext);
         }
-        else
-        {
-            Mainloop::AddToReadFdSet(fd, aContext);
-
-            if (otPlatTcpIsTxPending(conn))
-            {
-                Mainloop::AddToWriteFdSet(fd, aContext);
-            }
-        }
-    }
-}
-
-void Tcp::Process(const Mainloop::Context &aContext)
-{
-    otPlatTcpListener   *listener = nullptr;
-    otPlatTcpConnection *conn     = nullptr;
-
-    while ((listener = otPlatTcpIterateListeners(gInstance, listener)) != nullptr)
-    {
-        ProcessListener(listener, aContext);
     }
-
-    while ((conn = otPlatTcpIterateConnections(gInstance, conn)) != nullptr)
+    else
     {
-        ProcessConnection(conn, aContext);
+        ProcessConnection(watcher.GetConnection(), aEvents);
     }
 }
 
-void Tcp::ProcessListener(otPlatTcpListener *aListener, const Mainloop::Context &aContext)
+otError Tcp::AcceptConnection(otPlatTcpListener *aListener)
 {
-    int                  fd = GetFd(aListener);
+    otError              error = OT_ERROR_NONE;
+    int                  fd    = GetFd(aListener);
     struct sockaddr_in6  peerAddr;
     socklen_t            addrLen = sizeof(peerAddr);
     int                  newFd;
     otPlatTcpSockAddr    peerSockAddr;
     otPlatTcpConnection *newConn;
 
-    VerifyOrExit(fd >= 0);
-
-    VerifyOrExit(Mainloop::IsFdReadable(fd, aContext));
+    // The listener may be disabled from a callback of a previously
+    // accepted connection.
+    VerifyOrExit(fd >= 0, error = OT_ERROR_INVALID_STATE);
 
     newFd = accept(fd, reinterpret_cast<struct sockaddr *>(&peerAddr), &addrLen);
-    VerifyOrExit(newFd >= 0);
+    VerifyOrExit(newFd >= 0, error = OT_ERROR_FAILED);
 
     memset(&peerSockAddr, 0, sizeof(peerSockAddr));
     peerSockAddr.mSockAddr.mPort = ntohs(peerAddr.sin6_port);
@@ -401,15 +446,15 @@ void Tcp::ProcessListener(otPlatTcpListener *aListener, const Mainloop::Context
     fcntl(newFd, F_SETFD, FD_CLOEXEC);
     fcntl(newFd, F_SETFL, fcntl(newFd, F_GETFL, 0) | O_NONBLOCK);
     SetNoSigPipe(newFd);
-    SetFd(newConn, newFd);
+    WatchFd(newConn, newFd, Mainloop::kEventReadable);
 
     otPlatTcpHandleConnected(newConn);
 
 exit:
-    return;
+    return error;
 }
 
-void Tcp::ProcessConnection(otPlatTcpConnection *aConn, const Mainloop::Context &aContext)
+void Tcp::ProcessConnection(otPlatTcpConnection *aConn, uint32_t aEvents)
 {
     int fd = GetFd(aConn);
 
@@ -420,11 +465,15 @@ void Tcp::ProcessConnection(otPlatTcpConnection *aConn, const Mainloop::Context
         int       err = 0;
         socklen_t len = sizeof(err);
 
-        VerifyOrExit(Mainloop::IsFdWritable(fd, aContext) || Mainloop::HasFdErrored(fd, aContext));
+        VerifyOrExit(aEvents & (Mainloop::kEventWritable | Mainloop::kEventError));
 
         if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0)
         {
             otPlatTcpHandleConnected(aConn);
+
+            // Start watching for received data, and for transmit
+            // buffer space if there is already data pending.
+            UpdateConnectedEvents(aConn);
         }
         else
         {
@@ -439,8 +488,7 @@ void Tcp::ProcessConnection(otPlatTcpConnection *aConn, const Mainloop::Context
                 reason = OT_PLAT_TCP_DISCONNECT_REASON_TIMEOUT;
             }
 
-            close(fd);
-            SetFd(aConn, -1);
+            CloseFd(aConn->mData);
 
             otPlatTcpHandleDisconnected(aConn, reason);
         }
@@ -450,35 +498,38 @@ void Tcp::ProcessConnection(otPlatTcpConnection *aConn, const Mainloop::Context
 
     // Connection is already connected
 
-    if (Mainloop::IsFdReadable(fd, aContext))
+    if (aEvents & (Mainloop::kEventReadable | Mainloop::kEventError))
     {
         uint8_t buffer[kMaxReceiveBufferSize];
-        ssize_t ret = recv(fd, buffer, sizeof(buffer), 0);
+        ssize_t ret         = 0;
+        int     numReceives = 0;
 
-        if (ret > 0)
+        // At most `kMaxReceivesPerEvent` reads are done, the watcher
+        // reports the socket again on the next mainloop iteration if
+        // more data is pending.
+        while ((numReceives < kMaxReceivesPerEvent) && ((ret = recv(fd, buffer, sizeof(buffer), 0)) > 0))
         {
+            numReceives++;
+
             otPlatTcpHandleReceive(aConn, buffer, static_cast<uint16_t>(ret));
 
             // The connection may be closed or aborted from within the
             // `otPlatTcpHandleReceive()` callback. We verify that the
             // file descriptor is still valid before proceeding, to
-            // avoid checking `IsFdWritable()` and possibly invoking
+            // avoid reading from it again and possibly invoking
             // `otPlatTcpHandleTxReady()` on an aborted connection.
-            // Note that `otPlatTcpIterateConnections()` guarantees
-            // that `aConn` remains valid during iteration (it is not
-            // removed from the list).
 
             VerifyOrExit(GetFd(aConn) >= 0);
         }
-        else if (ret == 0)
+
+        if (ret == 0)
         {
-            close(fd);
-            SetFd(aConn, -1);
+            CloseFd(aConn->mData);
 
             otPlatTcpHandleDisconnected(aConn, OT_PLAT_TCP_DISCONNECT_REASON_CLOSED);
             ExitNow();
         }
-        else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        else if (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
         {
             otPlatTcpDisconnectReason reason = OT_PLAT_TCP_DISCONNECT_REASON_ERROR;
 
@@ -491,17 +542,20 @@ void Tcp::ProcessConnection(otPlatTcpConnection *aConn, const Mainloop::Context
                 reason = OT_PLAT_TCP_DISCONNECT_REASON_TIMEOUT;
             }
 
-            close(fd);
-            SetFd(aConn, -1);
+            CloseFd(aConn->mData);
 
             otPlatTcpHandleDisconnected(aConn, reason);
             ExitNow();
         }
     }
 
-    if (Mainloop::IsFdWritable(fd, aContext))
+    if (aEvents & Mainloop::kEventWritable)
     {
         otPlatTcpHandleTxReady(aConn);
+
+        // Stop watching for transmit buffer space once all the data
+        // is sent, or re-arm the watcher if there is more.
+        UpdateConnectedEvents(aConn);
     }
 
 exit:
@@ -50,15 +50,12 @@ public:
     static Tcp &Get(void);
 
     void Init(void);
-    void SetUp(void);
-    void TearDown(void);
     void Deinit(void);
-    void Update(Mainloop::Context &aContext) override;
-    void Process(const Mainloop::Context &aContext) override;
+    void HandleFdEvents(Mainloop::FdWatcher &aWatcher, uint32_t aEvents) override;
 
 private:
-    void ProcessListener(otPlatTcpListener *aListener, const Mainloop::Context &aContext);
-    void ProcessConnection(otPlatTcpConnection *aConn, const Mainloop::Context &aContext);
+    otError AcceptConnection(otPlatTcpListener *aListener);
+    void    ProcessConnection(otPlatTcpConnection *aConn, uint32_t aEvents);
 };
 
 } // namespace Posix
@@ -77,6 +77,17 @@ static bool sInitialized = false;
 static bool sEnabled     = false;
 static int  sSocket      = -1;
 
+// Watches `sSocket` so that it is processed only when it is ready.
+class TrelSocketSource : public ot::Posix::Mainloop::Source
+{
+public:
+    void HandleFdEvents(ot::Posix::Mainloop::FdWatcher &aWatcher, uint32_t aEvents) override;
+};
+
+static TrelSocketSource               sSocketSource;
+static ot::Posix::Mainloop::FdWatcher sSocketWatcher(sSocketSource);
+static otInstance                    *sInstance = nullptr;
+
 static const char kLogModuleName[] = "Trel";
 
 static void LogCrit(const char *aFormat, ...) OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(1, 2);
@@ -274,19 +285,25 @@ exit:
     return error;
 }
 
-static void ReceivePacket(int aSocket, otInstance *aInstance)
+static void ReceivePackets(otInstance *aInstance)
 {
+    // At most `kMaxRxPacketsPerIteration` packets are read, the
+    // watcher reports the socket again on the next mainloop iteration
+    // if more are pending. The loop stops if TREL is disabled from
+    // `otPlatTrelHandleReceived()`.
+
     const uint16_t kMaxRxPacketsPerIteration = 64;
 
-    for (uint16_t i = 0; i < kMaxRxPacketsPerIteration;)
+    for (uint16_t i = 0; sEnabled && (i < kMaxRxPacketsPerIteration);)
     {
         struct sockaddr_in6 sockAddr;
         socklen_t           sockAddrLen = sizeof(sockAddr);
+        otSockAddr          senderAddr;
         ssize_t             ret;
 
         memset(&sockAddr, 0, sizeof(sockAddr));
 
-        ret = recvfrom(aSocket, (char *)sRxPacketBuffer, sizeof(sRxPacketBuffer), 0, (struct sockaddr *)&sockAddr,
+        ret = recvfrom(sSocket, (char *)sRxPacketBuffer, sizeof(sRxPacketBuffer), 0, (struct sockaddr *)&sockAddr,
                        &sockAddrLen);
         if (ret < 0)
         {
@@ -303,21 +320,16 @@ static void ReceivePacket(int aSocket, otInstance *aInstance)
 
         sRxPacketLength = (uint16_t)(ret);
 
-        LogDebg("ReceivePacket() - received from [%s]:%d, id:%d, pkt:%s", Ip6AddrToString(&sockAddr.sin6_addr),
+        LogDebg("ReceivePackets() - received from [%s]:%d, id:%d, pkt:%s", Ip6AddrToString(&sockAddr.sin6_addr),
                 ntohs(sockAddr.sin6_port), sockAddr.sin6_scope_id, BufferToString(sRxPacketBuffer, sRxPacketLength));
 
-        if (sEnabled)
-        {
-            otSockAddr senderAddr;
+        ++sCounters.mRxPackets;
+        sCounters.mRxBytes += sRxPacketLength;
 
-            ++sCounters.mRxPackets;
-            sCounters.mRxBytes += sRxPacketLength;
+        memcpy(&senderAddr.mAddress, &sockAddr.sin6_addr, sizeof(otIp6Address));
+        senderAddr.mPort = ntohs(sockAddr.sin6_port);
 
-            memcpy(&senderAddr.mAddress, &sockAddr.sin6_addr, sizeof(otIp6Address));
-            senderAddr.mPort = ntohs(sockAddr.sin6_port);
-
-            otPlatTrelHandleReceived(aInstance, sRxPacketBuffer, sRxPacketLength, &senderAddr);
-        }
+        otPlatTrelHandleReceived(aInstance, sRxPacketBuffer, sRxPacketLength, &senderAddr);
 
         i++;
     }
@@ -406,6 +418,34 @@ exit:
     return;
 }
 
+static uint32_t GetSocketEvents(void)
+{
+    uint32_t events = ot::Posix::Mainloop::kEventReadable;
+
+    if (sTxPacketQueueTail != NULL)
+    {
+        events |= ot::Posix::Mainloop::kEventWritable;
+    }
+
+    return events;
+}
+
+void TrelSocketSource::HandleFdEvents(ot::Posix::Mainloop::FdWatcher &aWatcher, uint32_t aEvents)
+{
+    OT_UNUSED_VARIABLE(aWatcher);
+
+    if (aEvents & ot::Posix::Mainloop::kEventWritable)
+    {
+        SendQueuedPackets();
+        sSocketWatcher.SetEvents(GetSocketEvents());
+    }
+
+    if (aEvents & ot::Posix::Mainloop::kEventReadable)
+    {
+        ReceivePackets(sInstance);
+    }
+}
+
 static void ResetCounters() { memset(&sCounters, 0, sizeof(sCounters)); }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -530,13 +570,13 @@ OT_TOOL_WEAK void trelDnssdProcess(otInstance *aInstance, const otSysMainloopCon
 
 void otPlatTrelEnable(otInstance *aInstance, uint16_t *aUdpPort)
 {
-    OT_UNUSED_VARIABLE(aInstance);
-
     VerifyOrExit(!IsSystemDryRun());
 
     VerifyOrExit(sInitialized && !sEnabled);
 
     PrepareSocket(*aUdpPort);
+    sInstance = aInstance;
+    sSocketWatcher.Start(sSocket, GetSocketEvents());
     trelDnssdStartBrowse();
 
     sEnabled = true;
@@ -553,6 +593,7 @@ void otPlatTrelDisable(otInstance *aInstance)
 
     VerifyOrExit(sInitialized && sEnabled);
 
+    sSocketWatcher.Stop();
     close(sSocket);
     sSocket = -1;
     trelDnssdStopBrowse();
@@ -587,6 +628,7 @@ void otPlatTrelSend(otInstance       *aInstance,
         (SendPacket(aUdpPayload, aUdpPayloadLen, aDestSockAddr) == OT_ERROR_INVALID_STATE))
     {
         EnqueuePacket(aUdpPayload, aUdpPayloadLen, aDestSockAddr);
+        sSocketWatcher.SetEvents(GetSocketEvents());
     }
 
 exit:
@@ -701,12 +743,7 @@ void platformTrelUpdateFdSet(ot::Posix::Mainloop::Context *aContext)
 
     VerifyOrExit(sEnabled);
 
-    ot::Posix::Mainloop::AddToReadFdSet(sSocket, *aContext);
-
-    if (sTxPacketQueueTail != nullptr)
-    {
-        ot::Posix::Mainloop::AddToWriteFdSet(sSocket, *aContext);
-    }
+    // `sSocket` is watched by `sSocketWatcher`.
 
     trelDnssdUpdateFdSet(aContext);
 
@@ -718,16 +755,6 @@ void platformTrelProcess(otInstance *aInstance, const ot::Posix::Mainloop::Conte
 {
     VerifyOrExit(sEnabled);
 
-    if (ot::Posix::Mainloop::IsFdWritable(sSocket, *aContext))
-    {
-        SendQueuedPackets();
-    }
-
-    if (ot::Posix::Mainloop::IsFdReadable(sSocket, *aContext))
-    {
-        ReceivePacket(sSocket, aInstance);
-    }
-
     trelDnssdProcess(aInstance, aContext);
 
 exit:
@@ -0,0 +1,94 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements draining packets from the Thread network interface (TUN device).
+ */
+
+#include "tun_drainer.hpp"
+
+#include <string.h>
+
+#include <openthread/platform/time.h>
+
+namespace ot {
+namespace Posix {
+
+TunDrainer::TunDrainer(uint16_t aBatchSize)
+    : mBatchSize(aBatchSize)
+{
+    ResetCounters();
+}
+
+void TunDrainer::Drain(ReadHandler aHandler, void *aContext)
+{
+    uint64_t startTime  = otPlatTimeGet();
+    uint32_t numPackets = 0;
+
+    while (numPackets < mBatchSize)
+    {
+        ReadResult result = aHandler(aContext);
+
+        if (result == kReadNone)
+        {
+            break;
+        }
+
+        numPackets++;
+
+        if (result == kReadPacketNoBufs)
+        {
+            break;
+        }
+    }
+
+    mCounters.mReadWakeups++;
+    mCounters.mReadPackets += numPackets;
+    mCounters.mReadTimeUs += otPlatTimeGet() - startTime;
+
+    if (numPackets > mCounters.mReadMaxPacketsPerWakeup)
+    {
+        mCounters.mReadMaxPacketsPerWakeup = numPackets;
+    }
+}
+
+void TunDrainer::RecordWrite(bool aIsWritten, uint64_t aTimeUs)
+{
+    mCounters.mWriteTimeUs += aTimeUs;
+
+    if (aIsWritten)
+    {
+        mCounters.mWritePackets++;
+    }
+}
+
+void TunDrainer::ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
+} // namespace Posix
+} // namespace ot
@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for draining packets from the Thread network interface (TUN device).
+ */
+
+#ifndef OT_POSIX_PLATFORM_TUN_DRAINER_HPP_
+#define OT_POSIX_PLATFORM_TUN_DRAINER_HPP_
+
+#include "openthread-posix-config.h"
+
+#include <stdint.h>
+
+#include <openthread/openthread-system.h>
+
+namespace ot {
+namespace Posix {
+
+/**
+ * Reads packets from the Thread network interface (TUN device) in batches and tracks its packet I/O counters.
+ */
+class TunDrainer
+{
+public:
+    /**
+     * Represents the result of reading a single packet from the TUN device.
+     */
+    enum ReadResult : uint8_t
+    {
+        kReadPacket,       ///< A packet was read, more packets may be pending.
+        kReadPacketNoBufs, ///< A packet was read but dropped due to lack of message buffers.
+        kReadNone,         ///< No packet was read (no more pending packets or the read failed).
+    };
+
+    /**
+     * Represents the function reading a single packet from the TUN device and passing it to OpenThread.
+     *
+     * @param[in] aContext  The arbitrary context information.
+     *
+     * @returns The result of the read.
+     */
+    typedef ReadResult (*ReadHandler)(void *aContext);
+
+    /**
+     * Initializes the `TunDrainer`.
+     *
+     * @param[in] aBatchSize  The maximum number of packets to read per `Drain()` call.
+     */
+    explicit TunDrainer(uint16_t aBatchSize);
+
+    /**
+     * Reads up to the batch size packets from the TUN device.
+     *
+     * Reading stops early when @p aHandler returns `kReadNone` or `kReadPacketNoBufs`. Packets not read remain in the
+     * TUN device, which stays readable, so they are read on the next mainloop wakeup.
+     *
+     * @param[in] aHandler  The function reading a single packet.
+     * @param[in] aContext  The arbitrary context information passed to @p aHandler.
+     */
+    void Drain(ReadHandler aHandler, void *aContext);
+
+    /**
+     * Records a write of a packet to the TUN device.
+     *
+     * @param[in] aIsWritten  Whether the packet was written successfully.
+     * @param[in] aTimeUs     The time spent writing the packet (in microseconds).
+     */
+    void RecordWrite(bool aIsWritten, uint64_t aTimeUs);
+
+    /**
+     * Gets the packet I/O counters.
+     *
+     * @returns The packet I/O counters.
+     */
+    const otSysNetifTunCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the packet I/O counters.
+     */
+    void ResetCounters(void);
+
+private:
+    uint16_t              mBatchSize;
+    otSysNetifTunCounters mCounters;
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OT_POSIX_PLATFORM_TUN_DRAINER_HPP_
@@ -65,11 +65,26 @@ using namespace ot::Posix::Ip6Utils;
 
 namespace {
 
-constexpr size_t kMaxUdpSize = 1280;
+constexpr size_t   kMaxUdpSize           = 1280;
+constexpr uint16_t kMaxRxPacketsPerEvent = 64;
 
-void *FdToHandle(int aFd) { return reinterpret_cast<void *>(aFd); }
+// The `mHandle` of a platform UDP socket points to the watcher of its file descriptor.
+class SocketWatcher : public ot::Posix::Mainloop::FdWatcher
+{
+public:
+    explicit SocketWatcher(otUdpSocket &aUdpSocket)
+        : FdWatcher(ot::Posix::Udp::Get())
+        , mUdpSocket(aUdpSocket)
+    {
+    }
+
+    otUdpSocket &GetUdpSocket(void) const { return mUdpSocket; }
 
-int FdFromHandle(void *aHandle) { return static_cast<int>(reinterpret_cast<long>(aHandle)); }
+private:
+    otUdpSocket &mUdpSocket;
+};
+
+int FdFromHandle(void *aHandle) { return (aHandle != nullptr) ? static_cast<SocketWatcher *>(aHandle)->GetFd() : -1; }
 
 otError transmitPacket(int aFd, uint8_t *aPayload, uint16_t aLength, const otMessageInfo &aMessageInfo)
 {
@@ -176,6 +191,7 @@ exit:
 
 otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageInfo &aMessageInfo)
 {
+    otError             error = OT_ERROR_NONE;
     struct sockaddr_in6 peerAddr;
     uint8_t             control[kMaxUdpSize];
     struct iovec        iov;
@@ -194,7 +210,18 @@ otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageIn
     msg.msg_flags      = 0;
 
     rval = recvmsg(aFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("recvmsg"));
+
+    if (rval < 0)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            perror("recvmsg");
+        }
+
+        ExitNow(error = OT_ERROR_FAILED);
+    }
+
+    VerifyOrExit(rval > 0, error = OT_ERROR_DROP);
     aLength = static_cast<uint16_t>(rval);
 
     for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
@@ -224,22 +251,25 @@ otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageIn
     ReadIp6AddressFrom(&peerAddr.sin6_addr, aMessageInfo.mPeerAddr);
 
 exit:
-    return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
+    return error;
 }
 
 } // namespace
 
 otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
 {
-    otError error = OT_ERROR_NONE;
-    int     fd;
+    otError        error = OT_ERROR_NONE;
+    SocketWatcher *watcher;
+    int            fd;
 
     assert(aUdpSocket->mHandle == nullptr);
 
     fd = ot::Posix::SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, ot::Posix::kSocketNonBlock);
     VerifyOrExit(fd >= 0, error = OT_ERROR_FAILED);
 
-    aUdpSocket->mHandle = FdToHandle(fd);
+    watcher = new SocketWatcher(*aUdpSocket);
+    watcher->Start(fd, ot::Posix::Mainloop::kEventReadable);
+    aUdpSocket->mHandle = watcher;
 
 exit:
     return error;
@@ -247,18 +277,23 @@ exit:
 
 otError otPlatUdpClose(otUdpSocket *aUdpSocket)
 {
-    otError error = OT_ERROR_NONE;
-    int     fd;
+    otError        error = OT_ERROR_NONE;
+    SocketWatcher *watcher;
+    int            fd;
 
     // Only call `close()` on platform UDP sockets.
     // Platform UDP sockets always have valid `mHandle` upon creation.
     VerifyOrExit(aUdpSocket->mHandle != nullptr);
 
-    fd = FdFromHandle(aUdpSocket->mHandle);
-    VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
+    watcher = static_cast<SocketWatcher *>(aUdpSocket->mHandle);
+    fd      = watcher->GetFd();
 
+    watcher->Stop();
+    delete watcher;
     aUdpSocket->mHandle = nullptr;
 
+    VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
+
 exit:
     return error;
 }
@@ -569,27 +604,6 @@ namespace Posix {
 
 const char Udp::kLogModuleName[] = "Udp";
 
-void Udp::Update(Mainloop::Context &aContext)
-{
-    VerifyOrExit(gNetifIndex != 0);
-
-    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
-    {
-        int fd;
-
-        if (socket->mHandle == nullptr)
-        {
-            continue;
-        }
-
-        fd = FdFromHandle(socket->mHandle);
-        Mainloop::AddToReadFdSet(fd, aContext);
-    }
-
-exit:
-    return;
-}
-
 void Udp::Init(const char *aIfName)
 {
     if (aIfName == nullptr)
@@ -609,10 +623,6 @@ void Udp::Init(const char *aIfName)
     assert(gNetifIndex != 0);
 }
 
-void Udp::SetUp(void) { Mainloop::Manager::Get().Add(*this); }
-
-void Udp::TearDown(void) { Mainloop::Manager::Get().Remove(*this); }
-
 void Udp::Deinit(void)
 {
     // TODO All platform sockets should be closed
@@ -625,50 +635,56 @@ Udp &Udp::Get(void)
     return sInstance;
 }
 
-void Udp::Process(const Mainloop::Context &aContext)
+void Udp::HandleFdEvents(Mainloop::FdWatcher &aWatcher, uint32_t aEvents)
 {
+    otUdpSocket      *socket      = &static_cast<SocketWatcher &>(aWatcher).GetUdpSocket();
+    void             *handle      = socket->mHandle;
     otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    uint16_t          numPackets  = 0;
+    otError           error;
 
-    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
-    {
-        int fd = FdFromHandle(socket->mHandle);
+    OT_UNUSED_VARIABLE(aEvents);
 
-        if (fd > 0 && Mainloop::IsFdReadable(fd, aContext))
-        {
-            otMessageInfo messageInfo;
-            otMessage    *message = nullptr;
-            uint8_t       payload[kMaxUdpSize];
-            uint16_t      length = sizeof(payload);
+    // At most `kMaxRxPacketsPerEvent` packets are read, the watcher
+    // reports the socket again on the next mainloop iteration if more
+    // are pending. The loop stops if the socket is closed from the
+    // receive handler.
 
-            memset(&messageInfo, 0, sizeof(messageInfo));
-            messageInfo.mSockPort = socket->mSockName.mPort;
+    do
+    {
+        otMessageInfo messageInfo;
+        otMessage    *message = nullptr;
+        uint8_t       payload[kMaxUdpSize];
+        uint16_t      length = sizeof(payload);
 
-            if (OT_ERROR_NONE != receivePacket(fd, payload, length, messageInfo))
-            {
-                continue;
-            }
+        memset(&messageInfo, 0, sizeof(messageInfo));
+        messageInfo.mSockPort = socket->mSockName.mPort;
 
-            message = otUdpNewMessage(gInstance, &msgSettings);
+        error = receivePacket(FdFromHandle(handle), payload, length, messageInfo);
+        numPackets++;
 
-            if (message == nullptr)
-            {
-                continue;
-            }
+        if (error != OT_ERROR_NONE)
+        {
+            continue;
+        }
 
-            if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
-            {
-                otMessageFree(message);
-                continue;
-            }
+        message = otUdpNewMessage(gInstance, &msgSettings);
 
-            socket->mHandler(socket->mContext, message, &messageInfo);
+        if (message == nullptr)
+        {
+            continue;
+        }
+
+        if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
+        {
             otMessageFree(message);
-            // only process one socket a time
-            break;
+            continue;
         }
-    }
 
-    return;
+        socket->mHandler(socket->mContext, message, &messageInfo);
+        otMessageFree(message);
+    } while ((error == OT_ERROR_NONE || error == OT_ERROR_DROP) && (socket->mHandle == handle) &&
+             (numPackets < kMaxRxPacketsPerEvent));
 }
 
 } // namespace Posix
@@ -44,11 +44,8 @@ public:
     static Udp &Get(void);
 
     void Init(const char *aIfName);
-    void SetUp(void);
-    void TearDown(void);
     void Deinit(void);
-    void Update(Mainloop::Context &aContext) override;
-    void Process(const Mainloop::Context &aContext) override;
+    void HandleFdEvents(Mainloop::FdWatcher &aWatcher, uint32_t aEvents) override;
 };
 
 } // namespace Posix
@@ -26,6 +26,9 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <string.h>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -519,4 +522,238 @@ TEST(RadioSpinelSrcMatch, shouldNotDuplicateSrcMatchEntriesOnRestoreProperties)
     ASSERT_EQ(platform.SrcMatchHasShortEntry(kTestShortAddr), 1);
     ASSERT_EQ(platform.SrcMatchHasExtEntry(kTestExtAddrReversed), 1);
 }
+
+TEST(RadioSpinelSrcMatch, shouldRestoreSrcMatchTablesWithPipelinedRequests)
+{
+    constexpr uint16_t      kNumEntries = 3;
+    constexpr uint16_t      kTestShortAddrs[kNumEntries]{0x1001, 0x1002, 0x1003};
+    constexpr otExtAddress  kTestExtAddrs[kNumEntries]{{0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x01},
+                                                      {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x02},
+                                                      {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x03}};
+    FakeCoprocessorPlatform platform;
+
+    ASSERT_EQ(platform.mRadioSpinel.Enable(FakePlatform::CurrentInstance()), kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.EnableSrcMatch(true), kErrorNone);
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        ASSERT_EQ(platform.mRadioSpinel.AddSrcMatchShortEntry(kTestShortAddrs[i]), kErrorNone);
+        ASSERT_EQ(platform.mRadioSpinel.AddSrcMatchExtEntry(kTestExtAddrs[i]), kErrorNone);
+    }
+
+    // Simulate the RCP losing its state.
+    platform.SrcMatchEnable(false);
+    platform.SrcMatchClearShortEntries();
+    platform.SrcMatchClearExtEntries();
+
+    platform.mRadioSpinel.RestoreProperties();
+
+    ASSERT_FALSE(platform.mRadioSpinel.HasPendingAsyncRequests());
+    ASSERT_TRUE(platform.SrcMatchIsEnabled());
+    ASSERT_EQ(platform.SrcMatchCountShortEntries(), kNumEntries);
+    ASSERT_EQ(platform.SrcMatchCountExtEntries(), kNumEntries);
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        otExtAddress reversed;
+
+        for (uint8_t j = 0; j < sizeof(otExtAddress); j++)
+        {
+            reversed.m8[j] = kTestExtAddrs[i].m8[sizeof(otExtAddress) - 1 - j];
+        }
+
+        ASSERT_EQ(platform.SrcMatchHasShortEntry(kTestShortAddrs[i]), 1);
+        ASSERT_EQ(platform.SrcMatchHasExtEntry(reversed), 1);
+    }
+}
+
+#if OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES > 64
+TEST(RadioSpinelSrcMatch, shouldRestoreLargeSrcMatchTablesWithinRcpFrameSize)
+{
+    // The restored tables do not fit in one frame of the RCP receive
+    // buffer, so the remaining entries must be inserted individually.
+    constexpr uint16_t      kNumEntries = OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES;
+    FakeCoprocessorPlatform platform;
+
+    ASSERT_EQ(platform.mRadioSpinel.Enable(FakePlatform::CurrentInstance()), kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.EnableSrcMatch(true), kErrorNone);
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        otExtAddress extAddr = {{0x11, 0x22, 0x33, 0x44, 0x55, 0x66, static_cast<uint8_t>(i >> 8),
+                                 static_cast<uint8_t>(i & 0xff)}};
+
+        ASSERT_EQ(platform.mRadioSpinel.AddSrcMatchShortEntry(0x1000 + i), kErrorNone);
+        ASSERT_EQ(platform.mRadioSpinel.AddSrcMatchExtEntry(extAddr), kErrorNone);
+    }
+
+    platform.SrcMatchEnable(false);
+    platform.SrcMatchClearShortEntries();
+    platform.SrcMatchClearExtEntries();
+
+    platform.mRadioSpinel.RestoreProperties();
+
+    ASSERT_FALSE(platform.mRadioSpinel.HasPendingAsyncRequests());
+    ASSERT_TRUE(platform.SrcMatchIsEnabled());
+    ASSERT_EQ(platform.SrcMatchCountShortEntries(), kNumEntries);
+    ASSERT_EQ(platform.SrcMatchCountExtEntries(), kNumEntries);
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        otExtAddress reversed = {{static_cast<uint8_t>(i & 0xff), static_cast<uint8_t>(i >> 8), 0x66, 0x55, 0x44,
+                                  0x33, 0x22, 0x11}};
+
+        ASSERT_EQ(platform.SrcMatchHasShortEntry(0x1000 + i), 1);
+        ASSERT_EQ(platform.SrcMatchHasExtEntry(reversed), 1);
+    }
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_MAX_SRC_MATCH_ENTRIES > 64
 #endif // OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+
+TEST(RadioSpinelSrcMatch, shouldBeAbleToUpdateRadioSrcMatchEntries)
+{
+    constexpr uint16_t      kTestShortAddr  = 0x1234;
+    constexpr uint16_t      kTestShortAddr2 = 0x5678;
+    constexpr otExtAddress  kTestExtAddr{0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    constexpr otExtAddress  kTestExtAddrReversed{0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11};
+    FakeCoprocessorPlatform platform;
+    otRadioSrcMatchEntry    entries[2];
+
+    platform.SrcMatchEnable(true);
+    platform.SrcMatchClearShortEntries();
+    platform.SrcMatchClearExtEntries();
+
+    ASSERT_EQ(platform.mRadioSpinel.Enable(FakePlatform::CurrentInstance()), kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.UpdateSrcMatchEntries(nullptr, 0), kErrorNone);
+
+    memset(entries, 0, sizeof(entries));
+    entries[0].mIsShort      = true;
+    entries[0].mIsAdd        = true;
+    entries[0].mShortAddress = kTestShortAddr;
+    entries[1].mIsShort      = false;
+    entries[1].mIsAdd        = true;
+    entries[1].mExtAddress   = kTestExtAddr;
+
+    ASSERT_EQ(platform.mRadioSpinel.UpdateSrcMatchEntries(entries, 2), kErrorNone);
+
+    ASSERT_EQ(platform.SrcMatchHasShortEntry(kTestShortAddr), 1);
+    ASSERT_EQ(platform.SrcMatchHasExtEntry(kTestExtAddrReversed), 1);
+
+    // Replace the short address in a single update, then clear the extended one.
+    entries[0].mIsAdd        = false;
+    entries[1].mIsShort      = true;
+    entries[1].mShortAddress = kTestShortAddr2;
+    ASSERT_EQ(platform.mRadioSpinel.UpdateSrcMatchEntries(entries, 2), kErrorNone);
+
+    entries[0].mIsShort    = false;
+    entries[0].mExtAddress = kTestExtAddr;
+    ASSERT_EQ(platform.mRadioSpinel.UpdateSrcMatchEntries(entries, 1), kErrorNone);
+
+    ASSERT_EQ(platform.SrcMatchCountShortEntries(), 1);
+    ASSERT_EQ(platform.SrcMatchHasShortEntry(kTestShortAddr2), 1);
+    ASSERT_EQ(platform.SrcMatchCountExtEntries(), 0);
+}
+
+TEST(RadioSpinelAsyncRequest, shouldPipelineMultipleRequests)
+{
+    struct Completions
+    {
+        static void HandleDone(otError aError, spinel_prop_key_t aKey, void *aContext)
+        {
+            Completions &completions = *static_cast<Completions *>(aContext);
+
+            completions.mErrors.push_back(aError);
+            completions.mKeys.push_back(aKey);
+        }
+
+        std::vector<otError>           mErrors;
+        std::vector<spinel_prop_key_t> mKeys;
+    };
+
+    constexpr uint16_t      kTestShortAddr = 0x1234;
+    constexpr uint16_t      kTestPanId     = 0xface;
+    FakeCoprocessorPlatform platform;
+    Completions             completions;
+
+    ASSERT_EQ(platform.mRadioSpinel.Enable(FakePlatform::CurrentInstance()), kErrorNone);
+
+    ASSERT_EQ(platform.mRadioSpinel.SetAsync(SPINEL_PROP_MAC_15_4_PANID, Completions::HandleDone, &completions,
+                                             SPINEL_DATATYPE_UINT16_S, kTestPanId),
+              kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.SetAsync(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, Completions::HandleDone, &completions,
+                                             SPINEL_DATATYPE_BOOL_S, true),
+              kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.InsertAsync(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, Completions::HandleDone,
+                                                &completions, SPINEL_DATATYPE_UINT16_S, kTestShortAddr),
+              kErrorNone);
+
+    EXPECT_TRUE(platform.mRadioSpinel.HasPendingAsyncRequests());
+    ASSERT_EQ(platform.mRadioSpinel.WaitAsyncRequests(), kErrorNone);
+    EXPECT_FALSE(platform.mRadioSpinel.HasPendingAsyncRequests());
+
+    ASSERT_EQ(completions.mKeys.size(), 3u);
+    EXPECT_EQ(completions.mKeys[0], SPINEL_PROP_MAC_15_4_PANID);
+    EXPECT_EQ(completions.mKeys[1], SPINEL_PROP_MAC_SRC_MATCH_ENABLED);
+    EXPECT_EQ(completions.mKeys[2], SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES);
+    EXPECT_THAT(completions.mErrors, ::testing::Each(kErrorNone));
+
+    EXPECT_TRUE(platform.SrcMatchHasShortEntry(kTestShortAddr));
+
+    // The removal is completed while the synchronous request waits for its response.
+
+    ASSERT_EQ(platform.mRadioSpinel.RemoveAsync(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, Completions::HandleDone,
+                                                &completions, SPINEL_DATATYPE_UINT16_S, kTestShortAddr),
+              kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.SetShortAddress(kTestShortAddr), kErrorNone);
+    EXPECT_FALSE(platform.mRadioSpinel.HasPendingAsyncRequests());
+
+    ASSERT_EQ(completions.mKeys.size(), 4u);
+    EXPECT_EQ(completions.mKeys[3], SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES);
+    EXPECT_EQ(completions.mErrors[3], kErrorNone);
+    EXPECT_EQ(platform.SrcMatchCountShortEntries(), 0u);
+}
+
+TEST(RadioSpinelAsyncRequest, shouldChangeChannelWhenEnablingReceive)
+{
+    FakeCoprocessorPlatform platform;
+
+    ASSERT_EQ(platform.mRadioSpinel.Enable(FakePlatform::CurrentInstance()), kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.Receive(11), kErrorNone);
+    EXPECT_EQ(platform.GetReceiveChannel(), 11);
+
+    ASSERT_EQ(platform.mRadioSpinel.Sleep(), kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.Receive(25), kErrorNone);
+    EXPECT_FALSE(platform.mRadioSpinel.HasPendingAsyncRequests());
+    EXPECT_TRUE(platform.mRadioSpinel.IsEnabled());
+    EXPECT_EQ(platform.GetReceiveChannel(), 25);
+}
+
+TEST(RadioSpinelAsyncRequest, shouldTrackPropertyRoundTripTime)
+{
+    FakeCoprocessorPlatform  platform;
+    otRadioSpinelPropertyRtt rtt;
+    uint8_t                  iterator = 0;
+    bool                     found    = false;
+
+    ASSERT_EQ(platform.mRadioSpinel.Enable(FakePlatform::CurrentInstance()), kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.SetPanId(0x1234), kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.SetPanId(0x4321), kErrorNone);
+
+    while (platform.mRadioSpinel.GetNextPropertyRtt(iterator, rtt) == kErrorNone)
+    {
+        if (rtt.mPropertyKey == SPINEL_PROP_MAC_15_4_PANID)
+        {
+            found = true;
+            break;
+        }
+    }
+
+    ASSERT_TRUE(found);
+    EXPECT_GE(rtt.mNumRequests, 2u);
+    EXPECT_LE(rtt.mMinRttUs, rtt.mMaxRttUs);
+    EXPECT_GE(rtt.mTotalRttUs, static_cast<uint64_t>(rtt.mMinRttUs) * rtt.mNumRequests);
+
+    platform.mRadioSpinel.ResetPropertyRtts();
+    iterator = 0;
+    EXPECT_EQ(platform.mRadioSpinel.GetNextPropertyRtt(iterator, rtt), kErrorNotFound);
+}
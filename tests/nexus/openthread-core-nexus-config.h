@@ -153,6 +153,7 @@
 #define OPENTHREAD_CONFIG_TCP_ENABLE 1
 #define OPENTHREAD_CONFIG_TLS_ENABLE 0
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES 256
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE 1
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES 16
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_INITIAL_RETRY_DELAY 4
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_RETRY_DELAY 120
@@ -41,8 +41,9 @@
 namespace ot {
 namespace Nexus {
 
-Core *Core::sCore  = nullptr;
-bool  Core::sInUse = false;
+Core           *Core::sCore      = nullptr;
+bool            Core::sInUse     = false;
+Core::HeapUsage Core::sHeapUsage = {0, 0};
 
 Core::Core(void)
     : mCurNodeId(0)
@@ -58,6 +59,7 @@ Core::Core(void)
     sInUse = true;
 
     mNextAlarmTime = NumericLimits<uint64_t>::kMax;
+    ResetRadioStats();
 
     pcapFile = getenv("OT_NEXUS_PCAP_FILE");
 
@@ -414,6 +416,7 @@ Node &Core::CreateNode(void)
 #endif
 
     mNodes.Push(*node);
+    mNodeGrid.MarkStale();
 
     node->GetInstance().AfterInit();
 
@@ -608,6 +611,12 @@ exit:
     return;
 }
 
+void Core::HandleHeapAlloc(size_t aSize)
+{
+    sHeapUsage.mCurrentSize += aSize;
+    sHeapUsage.mPeakSize = Max(sHeapUsage.mPeakSize, sHeapUsage.mCurrentSize);
+}
+
 void Core::UpdateNextAlarmMilli(const Alarm &aAlarm)
 {
     if (aAlarm.mScheduled)
@@ -668,6 +677,7 @@ void Core::Reset(void)
     mCurNodeId     = 0;
     mNow           = 0;
     mNextAlarmTime = NumericLimits<uint64_t>::kMax;
+    mNodeGrid.MarkStale();
 
     for (Observer &observer : mObservers)
     {
@@ -722,11 +732,12 @@ void Core::Process(Node &aNode)
 
 void Core::ProcessRadio(Node &aNode)
 {
-    Mac::Address dstAddr;
-    uint16_t     dstPanId;
-    bool         ackRequested;
-    AckMode      ackMode = kNoAck;
-    Node        *ackNode = nullptr;
+    Mac::Address        dstAddr;
+    uint16_t            dstPanId;
+    bool                ackRequested;
+    AckMode             ackMode = kNoAck;
+    Node               *ackNode = nullptr;
+    std::vector<Node *> candidates;
 
     VerifyOrExit(aNode.mRadio.mState == Radio::kStateTransmit);
 
@@ -783,9 +794,22 @@ void Core::ProcessRadio(Node &aNode)
 
     otPlatRadioTxStarted(&aNode.GetInstance(), &aNode.mRadio.mTxFrame);
 
-    for (Node &rxNode : mNodes)
+    mRadioStats.mNumTxFrames++;
+
+    // Only visit the nodes which are close enough to possibly receive
+    // the frame. The candidates follow the `mNodes` order, so the
+    // frame is delivered (and acked) exactly as if all nodes were
+    // visited. They are copied into a local list since delivering
+    // the frame can add or move nodes and rebuild the grid.
+
+    FindRadioRxCandidates(aNode, candidates);
+
+    for (Node *candidate : candidates)
     {
-        bool matchesDst;
+        Node &rxNode = *candidate;
+        bool  matchesDst;
+
+        mRadioStats.mNumRxCandidates++;
 
         if ((&rxNode == &aNode) || !rxNode.mRadio.CanReceiveOnChannel(aNode.mRadio.mTxFrame.GetChannel()))
         {
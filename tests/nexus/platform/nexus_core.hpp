@@ -37,6 +37,7 @@
 #include "nexus_observer.hpp"
 #include "nexus_pcap.hpp"
 #include "nexus_radio.hpp"
+#include "nexus_radio_model.hpp"
 #include "nexus_utils.hpp"
 #include "common/array.hpp"
 #include "common/owning_list.hpp"
@@ -77,6 +78,36 @@ public:
     void Reset(void);
     void SetNodeEnabled(uint32_t aNodeId, bool aEnabled);
 
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Heap usage tracking (shared by all nodes)
+
+    struct HeapUsage
+    {
+        size_t mCurrentSize; // Number of bytes currently allocated using `otPlatCAlloc()`.
+        size_t mPeakSize;    // High-water mark of `mCurrentSize` since the last `ResetHeapPeakSize()`.
+    };
+
+    static const HeapUsage &GetHeapUsage(void) { return sHeapUsage; }
+    static void             ResetHeapPeakSize(void) { sHeapUsage.mPeakSize = sHeapUsage.mCurrentSize; }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Radio frame delivery statistics
+
+    struct RadioStats
+    {
+        uint32_t mNumTxFrames;     // Number of frames transmitted by all nodes.
+        uint64_t mNumRxCandidates; // Number of nodes visited to deliver the transmitted frames.
+    };
+
+    const RadioStats &GetRadioStats(void) const { return mRadioStats; }
+    void              ResetRadioStats(void) { ClearAllBytes(mRadioStats); }
+
+    // Finds the nodes visited to deliver a frame from `aTxNode` (in `mNodes` order, including `aTxNode`).
+    void FindRadioRxCandidates(const Node &aTxNode, std::vector<Node *> &aCandidates)
+    {
+        mNodeGrid.FindCandidates(mNodes, aTxNode, aCandidates);
+    }
+
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Test specific helper methods
 
@@ -118,6 +149,10 @@ public:
     void UpdateNextAlarmMilli(const Alarm &aAlarm);
     void UpdateNextAlarmMicro(const Alarm &aAlarm);
     void MarkPendingAction(void) { mPendingAction = true; }
+    void HandleNodePositionChanged(void) { mNodeGrid.MarkStale(); }
+
+    static void HandleHeapAlloc(size_t aSize);
+    static void HandleHeapFree(size_t aSize) { sHeapUsage.mCurrentSize -= aSize; }
 
     Node *FindNodeByAddress(const Ip6::Address &aAddress);
     bool  IsThreadAddress(const Ip6::Address &aAddress);
@@ -166,8 +201,9 @@ private:
                                    const otMessageInfo *aMessageInfo,
                                    const otIcmp6Header *aIcmpHeader);
 
-    static Core *sCore;
-    static bool  sInUse;
+    static Core     *sCore;
+    static bool      sInUse;
+    static HeapUsage sHeapUsage;
 
     OwningList<Node>      mNodes;
     Pcap                  mPcap;
@@ -178,6 +214,8 @@ private:
     bool                  mSaveNodeLogs;
     uint64_t              mNow;
     uint64_t              mNextAlarmTime;
+    NodeGrid              mNodeGrid;
+    RadioStats            mRadioStats;
 
     LinkedList<Observer> mObservers;
 };
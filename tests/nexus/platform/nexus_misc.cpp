@@ -26,8 +26,11 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <openthread/platform/entropy.h>
 #include <openthread/platform/misc.h>
@@ -53,13 +56,45 @@ void otTaskletsSignalPending(otInstance *aInstance)
 //---------------------------------------------------------------------------------------------------------------------
 // Heap allocation APIs
 
+// Each allocation is prefixed with a header recording its size so
+// that `Core` can track the heap usage.
+
+static constexpr size_t kHeapHeaderSize = sizeof(max_align_t);
+
 void *otPlatCAlloc(size_t aNum, size_t aSize)
 {
-    void *ptr = calloc(aNum, aSize);
+    uint8_t *ptr = nullptr;
+    size_t   size;
+
+    VerifyOrExit((aSize == 0) || (aNum <= (SIZE_MAX - kHeapHeaderSize) / aSize));
+    size = aNum * aSize;
+
+    ptr = static_cast<uint8_t *>(calloc(1, kHeapHeaderSize + size));
+    VerifyOrExit(ptr != nullptr);
+
+    memcpy(ptr, &size, sizeof(size));
+    Core::HandleHeapAlloc(size);
+    ptr += kHeapHeaderSize;
+
+exit:
     return ptr;
 }
 
-void otPlatFree(void *aPtr) { free(aPtr); }
+void otPlatFree(void *aPtr)
+{
+    uint8_t *ptr = static_cast<uint8_t *>(aPtr);
+    size_t   size;
+
+    VerifyOrExit(ptr != nullptr);
+
+    ptr -= kHeapHeaderSize;
+    memcpy(&size, ptr, sizeof(size));
+    Core::HandleHeapFree(size);
+    free(ptr);
+
+exit:
+    return;
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 // Entropy
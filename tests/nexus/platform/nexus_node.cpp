@@ -152,6 +152,13 @@ void Node::SendEchoRequest(const Ip6::Address &aDestination,
 
 void Node::SetName(const char *aPrefix, uint16_t aIndex) { mName.Clear().Append("%s_%u", aPrefix, aIndex); }
 
+void Node::SetPosition(float aX, float aY)
+{
+    mX = aX;
+    mY = aY;
+    Core::Get().HandleNodePositionChanged();
+}
+
 void Node::HandleIp6Receive(otMessage *aMessage, void *aContext)
 {
     OwnedPtr<Message> messagePtr(AsCoreTypePtr(aMessage));
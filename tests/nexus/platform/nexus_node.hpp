@@ -129,7 +129,7 @@ public:
     void        SetName(const char *aName) { mName.Clear().Append("%s", aName); }
     void        SetName(const char *aPrefix, uint16_t aIndex);
     const char *GetName(void) const { return mName.AsCString(); }
-    void        SetPosition(float aX, float aY) { mX = aX, mY = aY; }
+    void        SetPosition(float aX, float aY);
     float       GetPositionX(void) const { return mX; }
     float       GetPositionY(void) const { return mY; }
     uint32_t    GetLastParentId(void) const { return mLastParentId; }
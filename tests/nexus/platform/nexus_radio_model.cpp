@@ -31,6 +31,7 @@
 #include "nexus_node.hpp"
 #include "common/num_utils.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace ot {
@@ -58,5 +59,96 @@ int16_t RadioModel::CalculateRssi(const Node &aTxNode, const Node &aRxNode)
 
 bool RadioModel::ShouldDropPacket(int16_t aRssi) { return aRssi < Radio::kRadioSensitivity; }
 
+double RadioModel::GetMaxRange(void)
+{
+    // `CalculateRssi()` rounds the RSSI, so a packet is dropped
+    // once the RSSI falls below `kRadioSensitivity - 0.5`. One
+    // extra meter is added to stay on the safe side of floating
+    // point rounding.
+
+    return std::pow(10.0, (-(Radio::kRadioSensitivity - 0.5) - kPathLossConstant) / kPathLossExponent) + 1.0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// NodeGrid
+
+NodeGrid::NodeGrid(void)
+    : mIsStale(true)
+    , mCellSize(RadioModel::GetMaxRange())
+{
+}
+
+void NodeGrid::FindCandidates(LinkedList<Node> &aNodes, const Node &aTxNode, std::vector<Node *> &aCandidates)
+{
+    int32_t  cellX;
+    int32_t  cellY;
+    uint16_t numCells = 0;
+
+    if (mIsStale)
+    {
+        Rebuild(aNodes);
+    }
+
+    cellX = ToCellIndex(aTxNode.GetPositionX());
+    cellY = ToCellIndex(aTxNode.GetPositionY());
+
+    mEntries.clear();
+
+    for (int32_t x = cellX - 1; x <= cellX + 1; x++)
+    {
+        for (int32_t y = cellY - 1; y <= cellY + 1; y++)
+        {
+            auto iter = mCells.find(ToCellKey(x, y));
+
+            if (iter != mCells.end())
+            {
+                mEntries.insert(mEntries.end(), iter->second.begin(), iter->second.end());
+                numCells++;
+            }
+        }
+    }
+
+    // Each cell is already sorted, so entries only need to be sorted
+    // when they are gathered from more than one cell.
+
+    if (numCells > 1)
+    {
+        std::sort(mEntries.begin(), mEntries.end());
+    }
+
+    aCandidates.clear();
+
+    for (const Entry &entry : mEntries)
+    {
+        aCandidates.push_back(entry.mNode);
+    }
+}
+
+void NodeGrid::Rebuild(LinkedList<Node> &aNodes)
+{
+    uint32_t order = 0;
+
+    mCells.clear();
+
+    for (Node &node : aNodes)
+    {
+        Entry entry;
+
+        entry.mOrder = order++;
+        entry.mNode  = &node;
+
+        mCells[ToCellKey(ToCellIndex(node.GetPositionX()), ToCellIndex(node.GetPositionY()))].push_back(entry);
+    }
+
+    mIsStale = false;
+}
+
+int32_t NodeGrid::ToCellIndex(float aPosition) const { return static_cast<int32_t>(std::floor(aPosition / mCellSize)); }
+
+uint64_t NodeGrid::ToCellKey(int32_t aCellX, int32_t aCellY)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(aCellX)) << 32) | static_cast<uint32_t>(aCellY);
+}
+
 } // namespace Nexus
 } // namespace ot
@@ -31,6 +31,11 @@
 
 #include <stdint.h>
 
+#include <unordered_map>
+#include <vector>
+
+#include "common/linked_list.hpp"
+
 namespace ot {
 namespace Nexus {
 
@@ -67,6 +72,74 @@ public:
      * @retval false if the packet should not be dropped.
      */
     static bool ShouldDropPacket(int16_t aRssi);
+
+    /**
+     * This static method returns the maximum distance at which a packet can be received.
+     *
+     * `CalculateRssi()` for any two nodes further apart than this distance returns an RSSI for which
+     * `ShouldDropPacket()` returns `true`.
+     *
+     * @returns The maximum receive range.
+     */
+    static double GetMaxRange(void);
+};
+
+/**
+ * This class implements a grid spatial index of node positions.
+ *
+ * The grid cell size is the radio model's maximum receive range, so all nodes which can receive a frame from a given
+ * transmitter are in the transmitter's cell or one of its eight neighboring cells.
+ *
+ */
+class NodeGrid
+{
+public:
+    /**
+     * This constructor initializes the `NodeGrid`.
+     *
+     */
+    NodeGrid(void);
+
+    /**
+     * This method marks the grid as stale, e.g., after a node is added or its position is changed.
+     *
+     * The grid is then rebuilt on next call to `FindCandidates()`.
+     *
+     */
+    void MarkStale(void) { mIsStale = true; }
+
+    /**
+     * This method finds all nodes which may be in the receive range of a given transmitter node.
+     *
+     * The candidates are copied into a list owned by the caller, so it stays valid if the grid is marked stale and
+     * rebuilt while the caller goes through it (e.g., a node is added or moved while a frame is being delivered). The
+     * list includes `aTxNode` itself and follows the same order as the nodes in `aNodes`.
+     *
+     * @param[in]  aNodes       The list of all nodes.
+     * @param[in]  aTxNode      The transmitter node.
+     * @param[out] aCandidates  A vector to output the candidate receiver nodes.
+     */
+    void FindCandidates(LinkedList<Node> &aNodes, const Node &aTxNode, std::vector<Node *> &aCandidates);
+
+private:
+    struct Entry
+    {
+        bool operator<(const Entry &aOther) const { return mOrder < aOther.mOrder; }
+
+        uint32_t mOrder; // Index of the node in the node list.
+        Node    *mNode;
+    };
+
+    typedef std::vector<Entry> Cell;
+
+    void            Rebuild(LinkedList<Node> &aNodes);
+    int32_t         ToCellIndex(float aPosition) const;
+    static uint64_t ToCellKey(int32_t aCellX, int32_t aCellY);
+
+    bool                               mIsStale;
+    double                             mCellSize;
+    std::unordered_map<uint64_t, Cell> mCells;
+    std::vector<Entry>                 mEntries;
 };
 
 } // namespace Nexus
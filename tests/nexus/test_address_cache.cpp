@@ -0,0 +1,333 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+#include "thread/address_resolver.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * Number of entries in the address cache.
+ */
+static constexpr uint16_t kCacheEntries = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES;
+
+/**
+ * Number of EIDs used by the test. Twice the cache size so that adding them all requires evicting entries.
+ */
+static constexpr uint16_t kNumEids = 2 * kCacheEntries;
+
+/**
+ * Number of distinct RLOC16s (children of `router`) the EIDs are mapped to.
+ */
+static constexpr uint16_t kNumRloc16s = 8;
+
+/**
+ * Prepares the EID for a given index.
+ *
+ * Odd indexes use an IID whose two 32-bit halves are equal. These EIDs all hash to the same initial slot in the
+ * address cache hash index, forming a long probe run, which exercises the collision handling when entries are
+ * added, looked up, and removed.
+ */
+static void PrepareEid(Ip6::Address &aEid, uint16_t aIndex)
+{
+    SuccessOrQuit(aEid.FromString("fd00:1234::"));
+
+    aEid.GetIid().mFields.m32[0] = aIndex;
+    aEid.GetIid().mFields.m32[1] = (aIndex & 1) ? aIndex : 0;
+}
+
+/**
+ * Represents the expected state of the address cache, i.e., the RLOC16 of each EID, or `Mle::kInvalidRloc16` if
+ * the EID is expected to be absent.
+ */
+struct CacheModel
+{
+    void RemoveAll(void)
+    {
+        for (uint16_t &rloc16 : mRloc16s)
+        {
+            rloc16 = Mle::kInvalidRloc16;
+        }
+    }
+
+    uint16_t GetNumEntries(void) const
+    {
+        uint16_t count = 0;
+
+        for (uint16_t rloc16 : mRloc16s)
+        {
+            count += (rloc16 != Mle::kInvalidRloc16) ? 1 : 0;
+        }
+
+        return count;
+    }
+
+    uint16_t mRloc16s[kNumEids];
+};
+
+/**
+ * Validates the address cache entries (iterated over the cache lists) against the model.
+ *
+ * If `aAllowEvicted` is true, EIDs in the model may be missing from the cache (evicted), and the model is updated
+ * to reflect the iterated entries.
+ */
+static void VerifyCacheEntries(Node &aNode, CacheModel &aModel, bool aAllowEvicted)
+{
+    AddressResolver::Iterator  iterator;
+    AddressResolver::EntryInfo entryInfo;
+    bool                       found[kNumEids];
+    uint16_t                   numEntries = 0;
+
+    for (bool &flag : found)
+    {
+        flag = false;
+    }
+
+    iterator.Clear();
+
+    while (aNode.Get<AddressResolver>().GetNextCacheEntry(entryInfo, iterator) == kErrorNone)
+    {
+        Ip6::Address eid;
+        uint16_t     index = static_cast<uint16_t>(AsCoreType(&entryInfo.mTarget).GetIid().mFields.m32[0]);
+
+        VerifyOrQuit(index < kNumEids);
+        PrepareEid(eid, index);
+        VerifyOrQuit(AsCoreType(&entryInfo.mTarget) == eid);
+
+        VerifyOrQuit(!found[index], "EID is present in more than one cache entry");
+        found[index] = true;
+
+        VerifyOrQuit(entryInfo.mRloc16 == aModel.mRloc16s[index]);
+        numEntries++;
+    }
+
+    for (uint16_t index = 0; index < kNumEids; index++)
+    {
+        if (found[index])
+        {
+            continue;
+        }
+
+        if (aAllowEvicted)
+        {
+            aModel.mRloc16s[index] = Mle::kInvalidRloc16;
+        }
+
+        VerifyOrQuit(aModel.mRloc16s[index] == Mle::kInvalidRloc16, "EID is missing from the address cache");
+    }
+
+    VerifyOrQuit(numEntries == aModel.GetNumEntries());
+    VerifyOrQuit(numEntries <= kCacheEntries);
+}
+
+/**
+ * Looks up all EIDs and validates the result against the model.
+ */
+static void VerifyLookUps(Node &aNode, const CacheModel &aModel)
+{
+    for (uint16_t index = 0; index < kNumEids; index++)
+    {
+        Ip6::Address eid;
+
+        PrepareEid(eid, index);
+        VerifyOrQuit(aNode.Get<AddressResolver>().LookUp(eid) == aModel.mRloc16s[index]);
+    }
+}
+
+static void VerifyCache(Node &aNode, CacheModel &aModel, bool aAllowEvicted = false)
+{
+    VerifyCacheEntries(aNode, aModel, aAllowEvicted);
+    VerifyLookUps(aNode, aModel);
+
+    // `LookUp()` moves the snooped entries to the cached list,
+    // validate the entries again after the move.
+
+    VerifyCacheEntries(aNode, aModel, /* aAllowEvicted */ false);
+}
+
+void TestAddressCache(void)
+{
+    // Validate address cache operations with a large number of
+    // entries (with many EIDs colliding in the hash index) using a
+    // model of the expected cache content.
+
+    Core       nexus;
+    CacheModel model;
+    uint16_t   leaderRloc16;
+    uint16_t   routerRloc16;
+
+    Node &leader = nexus.CreateNode();
+    Node &router = nexus.CreateNode();
+
+    nexus.AdvanceTime(0);
+
+    SuccessOrQuit(Instance::SetGlobalLogLevel(kLogLevelNote));
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Form network");
+
+    leader.Form();
+    nexus.AdvanceTime(13 * 1000);
+    VerifyOrQuit(leader.Get<Mle::Mle>().IsLeader());
+
+    router.Join(leader);
+    nexus.AdvanceTime(200 * 1000);
+    VerifyOrQuit(router.Get<Mle::Mle>().IsRouter());
+
+    leaderRloc16 = leader.Get<Mle::Mle>().GetRloc16();
+    routerRloc16 = router.Get<Mle::Mle>().GetRloc16();
+
+    // The EIDs are mapped to the child RLOC16s of `router`, which are
+    // reachable from `leader`, so the cache entries are not removed
+    // as stale on `LookUp()`.
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Fill the address cache with snooped entries");
+
+    model.RemoveAll();
+
+    for (uint16_t index = 0; index < kCacheEntries; index++)
+    {
+        Ip6::Address eid;
+        uint16_t     rloc16 = routerRloc16 + 1 + (index % kNumRloc16s);
+
+        PrepareEid(eid, index);
+        leader.Get<AddressResolver>().UpdateSnoopedCacheEntry(eid, rloc16, leaderRloc16);
+        model.mRloc16s[index] = rloc16;
+    }
+
+    VerifyCache(leader, model);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Update the RLOC16 of existing entries");
+
+    for (uint16_t index = 0; index < kCacheEntries; index += 4)
+    {
+        Ip6::Address eid;
+
+        PrepareEid(eid, index);
+        model.mRloc16s[index] = (model.mRloc16s[index] == routerRloc16 + 1) ? routerRloc16 + 2 : routerRloc16 + 1;
+        leader.Get<AddressResolver>().UpdateSnoopedCacheEntry(eid, model.mRloc16s[index], leaderRloc16);
+    }
+
+    VerifyCache(leader, model);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Remove entries for specific EIDs");
+
+    for (uint16_t index = 0; index < kCacheEntries; index += 3)
+    {
+        Ip6::Address eid;
+
+        PrepareEid(eid, index);
+        leader.Get<AddressResolver>().RemoveEntryForAddress(eid);
+        model.mRloc16s[index] = Mle::kInvalidRloc16;
+    }
+
+    VerifyCache(leader, model);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Remove entries for an RLOC16");
+
+    leader.Get<AddressResolver>().RemoveEntriesForRloc16(routerRloc16 + 3);
+
+    for (uint16_t &rloc16 : model.mRloc16s)
+    {
+        if (rloc16 == routerRloc16 + 3)
+        {
+            rloc16 = Mle::kInvalidRloc16;
+        }
+    }
+
+    VerifyCache(leader, model);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Replace entries for an RLOC16");
+
+    leader.Get<AddressResolver>().ReplaceEntriesForRloc16(routerRloc16 + 4, routerRloc16 + 5);
+
+    for (uint16_t &rloc16 : model.mRloc16s)
+    {
+        if (rloc16 == routerRloc16 + 4)
+        {
+            rloc16 = routerRloc16 + 5;
+        }
+    }
+
+    VerifyCache(leader, model);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Add more entries than the cache size, evicting older entries");
+
+    for (uint16_t round = 0; round < 4; round++)
+    {
+        for (uint16_t index = round; index < kNumEids; index += 4)
+        {
+            Ip6::Address eid;
+            uint16_t     rloc16 = routerRloc16 + 1 + (index % kNumRloc16s);
+
+            if (model.mRloc16s[index] != Mle::kInvalidRloc16)
+            {
+                continue;
+            }
+
+            PrepareEid(eid, index);
+            leader.Get<AddressResolver>().UpdateSnoopedCacheEntry(eid, rloc16, leaderRloc16);
+            model.mRloc16s[index] = rloc16;
+        }
+
+        // Allow the newly snooped entries to become evictable.
+        nexus.AdvanceTime(5 * 1000);
+
+        VerifyCache(leader, model, /* aAllowEvicted */ true);
+    }
+
+    VerifyOrQuit(model.GetNumEntries() == kCacheEntries);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Clear the address cache");
+
+    leader.Get<AddressResolver>().Clear();
+    model.RemoveAll();
+
+    VerifyCache(leader, model);
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestAddressCache();
+    printf("All tests passed\n");
+    return 0;
+}
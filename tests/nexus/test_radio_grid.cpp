@@ -0,0 +1,182 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+namespace {
+
+constexpr uint16_t kNumRandomNodes = 60;
+constexpr uint16_t kMoveInterval   = 3; // Every third node is moved.
+
+float GetRandomPosition(double aRange)
+{
+    // Returns a random position in [-aRange, aRange].
+
+    return static_cast<float>(aRange * (2.0 * rand() / RAND_MAX - 1.0));
+}
+
+void VerifyCandidates(Core &aNexus, const Node &aTxNode)
+{
+    // Checks that delivering a frame from `aTxNode` to the grid
+    // candidates reaches exactly the nodes (in the same order) which
+    // a scan of all nodes would reach.
+
+    std::vector<Node *> candidates;
+    std::vector<Node *> delivered;
+    std::vector<Node *> expected;
+    bool                hasTxNode = false;
+
+    aNexus.FindRadioRxCandidates(aTxNode, candidates);
+
+    for (Node *candidate : candidates)
+    {
+        if (candidate == &aTxNode)
+        {
+            hasTxNode = true;
+            continue;
+        }
+
+        if (!RadioModel::ShouldDropPacket(RadioModel::CalculateRssi(aTxNode, *candidate)))
+        {
+            delivered.push_back(candidate);
+        }
+    }
+
+    for (Node &node : aNexus.GetNodes())
+    {
+        if ((&node != &aTxNode) && !RadioModel::ShouldDropPacket(RadioModel::CalculateRssi(aTxNode, node)))
+        {
+            expected.push_back(&node);
+        }
+    }
+
+    VerifyOrQuit(hasTxNode);
+    VerifyOrQuit(delivered == expected);
+}
+
+void VerifyAllCandidates(Core &aNexus)
+{
+    for (Node &node : aNexus.GetNodes())
+    {
+        VerifyCandidates(aNexus, node);
+    }
+}
+
+} // namespace
+
+void TestRadioGrid(void)
+{
+    Core         nexus;
+    const double range = RadioModel::GetMaxRange();
+    uint16_t     index = 0;
+
+    srand(0);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Nodes at random positions (max range %.1f m)", range);
+
+    for (uint16_t i = 0; i < kNumRandomNodes; i++)
+    {
+        nexus.CreateNode().SetPosition(GetRandomPosition(3 * range), GetRandomPosition(3 * range));
+    }
+
+    VerifyAllCandidates(nexus);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Nodes on and next to the cell edges");
+
+    // Nodes are placed on the cell edges (multiples of the range) and
+    // just before or after them, so that nodes within range of each
+    // other are in neighboring cells. The grid is already built, so
+    // this also checks that creating nodes updates it.
+
+    for (int i = -2; i <= 2; i++)
+    {
+        const float edge = static_cast<float>(i * range);
+
+        nexus.CreateNode().SetPosition(edge, edge);
+        nexus.CreateNode().SetPosition(edge - 0.01f, 0);
+        nexus.CreateNode().SetPosition(edge + 0.01f, 0);
+        nexus.CreateNode().SetPosition(0, edge - 0.01f);
+        nexus.CreateNode().SetPosition(0, edge + 0.01f);
+        nexus.CreateNode().SetPosition(edge - static_cast<float>(range) + 2.0f, edge);
+        nexus.CreateNode().SetPosition(edge, edge + static_cast<float>(range) - 2.0f);
+    }
+
+    VerifyAllCandidates(nexus);
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("Move nodes with `SetPosition()` after they are created");
+
+    for (uint16_t iter = 0; iter < 3; iter++)
+    {
+        index = 0;
+
+        for (Node &node : nexus.GetNodes())
+        {
+            if ((index++ % kMoveInterval) == 0)
+            {
+                node.SetPosition(GetRandomPosition(3 * range), GetRandomPosition(3 * range));
+            }
+        }
+
+        VerifyAllCandidates(nexus);
+    }
+
+    // Move a single node to a cell edge and then far away, while
+    // checking the candidates of its former and new neighbors.
+
+    {
+        Node &node = *nexus.GetNodes().GetHead();
+
+        node.SetPosition(static_cast<float>(range), static_cast<float>(-range));
+        VerifyAllCandidates(nexus);
+
+        node.SetPosition(static_cast<float>(10 * range), static_cast<float>(10 * range));
+        VerifyAllCandidates(nexus);
+    }
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestRadioGrid();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,189 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <cmath>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+namespace {
+
+// The radio scaling benchmark places nodes on a square lattice with a
+// fixed spacing (so the node density stays the same as the network
+// grows), starts them all at once (one leader, all other nodes join
+// as FTDs) and simulates the attach process for a fixed amount of
+// time.
+//
+// For each network size it reports the wall-clock time, the number of
+// transmitted frames and the average number of nodes visited to
+// deliver each frame. With the radio grid index, the number of nodes
+// visited per frame depends on the node density and not on the
+// number of nodes.
+//
+// The largest network size defaults to `kDefaultMaxNumNodes` (to
+// keep the run time low under ctest) and can be given as the first
+// command line argument, e.g., `nexus_radio_scaling 1000`.
+
+constexpr uint16_t kNetworkSizes[]     = {50, 100, 200, 500, 1000};
+constexpr uint16_t kDefaultMaxNumNodes = 200;
+constexpr uint16_t kMaxNumNodes        = 1000;
+constexpr float    kNodeSpacing    = 400.0f; // Distance between neighboring nodes on the lattice (in meters).
+constexpr uint32_t kSimulationTime = 30 * Time::kOneSecondInMsec;
+
+struct Result
+{
+    uint16_t mNumNodes;
+    uint16_t mNumAttached;
+    double   mDuration; // Wall-clock time (in seconds).
+    uint32_t mNumTxFrames;
+    uint64_t mNumRxCandidates;
+};
+
+void RunBenchmark(uint16_t aNumNodes, Result &aResult)
+{
+    Core                                  nexus;
+    Node                                 *leader;
+    uint16_t                              numColumns;
+    uint16_t                              numAttached = 0;
+    std::chrono::steady_clock::time_point startTime;
+    double                                duration;
+    const Core::RadioStats               &stats = nexus.GetRadioStats();
+
+    SuccessOrQuit(Instance::SetGlobalLogLevel(kLogLevelNote));
+
+    numColumns = static_cast<uint16_t>(std::ceil(std::sqrt(static_cast<double>(aNumNodes))));
+
+    for (uint16_t i = 0; i < aNumNodes; i++)
+    {
+        Node &node = nexus.CreateNode();
+
+        node.SetPosition((i % numColumns) * kNodeSpacing, (i / numColumns) * kNodeSpacing);
+    }
+
+    nexus.AdvanceTime(0);
+
+    leader = nexus.GetNodes().GetHead();
+    leader->Form();
+
+    for (Node &node : nexus.GetNodes())
+    {
+        if (&node != leader)
+        {
+            node.Join(*leader);
+        }
+    }
+
+    nexus.ResetRadioStats();
+    startTime = std::chrono::steady_clock::now();
+
+    nexus.AdvanceTime(kSimulationTime);
+
+    duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    for (Node &node : nexus.GetNodes())
+    {
+        if (node.Get<Mle::Mle>().IsAttached())
+        {
+            numAttached++;
+        }
+    }
+
+    VerifyOrQuit(stats.mNumTxFrames > 0);
+
+    Log("%u nodes: %lu frames in %.3f sec, %u nodes attached", aNumNodes, ToUlong(stats.mNumTxFrames), duration,
+        numAttached);
+
+    aResult.mNumNodes        = aNumNodes;
+    aResult.mNumAttached     = numAttached;
+    aResult.mDuration        = duration;
+    aResult.mNumTxFrames     = stats.mNumTxFrames;
+    aResult.mNumRxCandidates = stats.mNumRxCandidates;
+}
+
+} // namespace
+
+void TestRadioScaling(uint16_t aMaxNumNodes)
+{
+    Result   results[GetArrayLength(kNetworkSizes)];
+    uint16_t numResults = 0;
+
+    for (uint16_t numNodes : kNetworkSizes)
+    {
+        if (numNodes <= aMaxNumNodes)
+        {
+            RunBenchmark(numNodes, results[numResults++]);
+        }
+    }
+
+    // `Log()` requires a `Core` instance, so the summary is printed
+    // directly.
+
+    printf("\nRadio scaling: %lu sec of simulation per network size, node spacing %.0f m, max range %.0f m\n",
+           ToUlong(kSimulationTime / Time::kOneSecondInMsec), static_cast<double>(kNodeSpacing),
+           RadioModel::GetMaxRange());
+    printf("+-------+----------+----------+-----------+----------+----------+\n");
+    printf("| Nodes | Wall (s) | TxFrames | Visits/Tx | usec/Tx  | Attached |\n");
+    printf("+-------+----------+----------+-----------+----------+----------+\n");
+
+    for (uint16_t i = 0; i < numResults; i++)
+    {
+        const Result &result = results[i];
+
+        printf("| %5u | %8.3f | %8lu | %9.1f | %8.1f | %8u |\n", result.mNumNodes, result.mDuration,
+               ToUlong(result.mNumTxFrames), static_cast<double>(result.mNumRxCandidates) / result.mNumTxFrames,
+               (result.mDuration * 1e6) / result.mNumTxFrames, result.mNumAttached);
+    }
+
+    printf("+-------+----------+----------+-----------+----------+----------+\n\n");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(int argc, char *argv[])
+{
+    uint16_t maxNumNodes = ot::Nexus::kDefaultMaxNumNodes;
+
+    if (argc > 1)
+    {
+        unsigned long value = strtoul(argv[1], nullptr, 0);
+
+        maxNumNodes = static_cast<uint16_t>(ot::Min<unsigned long>(value, ot::Nexus::kMaxNumNodes));
+    }
+
+    ot::Nexus::TestRadioScaling(maxNumNodes);
+    printf("All tests passed\n");
+    return 0;
+}
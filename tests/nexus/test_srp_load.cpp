@@ -0,0 +1,338 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+namespace {
+
+// The SRP load test registers, renews and then removes a number of
+// synthetic SRP hosts (each with one service) on a single SRP server
+// (with Advertising Proxy and DNS-SD server) and reports the number
+// of updates per second (wall-clock), the heap high-water mark and
+// the p50/p99 commit latency of each phase.
+//
+// The synthetic hosts are spread over `kNumClientNodes` client nodes.
+// Each client node runs one SRP update at a time, cycling its SRP
+// client through its share of host names. All hosts registered from
+// the same client node use the same key.
+//
+// The number of hosts defaults to `kDefaultNumHosts` and can be
+// given as the first command line argument, e.g., `nexus_srp_load
+// 5000`.
+
+constexpr uint16_t kDefaultNumHosts = 100;
+constexpr uint16_t kMaxNumHosts     = 10000;
+constexpr uint16_t kNumClientNodes  = 8;
+constexpr uint32_t kInfraIfIndex    = 1;
+constexpr uint16_t kServicePort     = 4321;
+constexpr uint32_t kStepInterval    = 10;                                 // Time advanced per step (in msec).
+constexpr uint32_t kMaxUpdateTime   = 30 * TimeMilli::kOneSecondInMsec; // Max expected time per update (in msec).
+
+const char kServiceName[] = "_load._udp";
+
+enum Phase : uint8_t
+{
+    kRegister,
+    kRenew,
+    kRemove,
+};
+
+const char *PhaseToString(Phase aPhase)
+{
+    static const char *const kPhaseStrings[] = {"Register", "Renew", "Remove"};
+
+    return kPhaseStrings[aPhase];
+}
+
+struct ClientInfo
+{
+    Node                *mNode;
+    Srp::Client::Service mService;
+    String<32>           mHostName;
+    String<32>           mInstanceName;
+    uint16_t             mNextHostIndex;
+    TimeMilli            mStartTime;
+    bool                 mIsBusy;
+};
+
+ClientInfo sClients[kNumClientNodes];
+uint32_t   sLatencies[kMaxNumHosts]; // Commit latency (in msec) of each update in the current phase.
+uint16_t   sNumLatencies;
+
+// Commit latency is measured from when the SRP client is asked to
+// send the update until it receives the response which the SRP
+// server sends once it commits the update (after Advertising Proxy
+// has finished advertising it).
+
+void HandleSrpClientCallback(otError                    aError,
+                             const otSrpClientHostInfo *aHostInfo,
+                             const otSrpClientService  *aServices,
+                             const otSrpClientService  *aRemovedServices,
+                             void                      *aContext)
+{
+    ClientInfo &client = *static_cast<ClientInfo *>(aContext);
+
+    OT_UNUSED_VARIABLE(aHostInfo);
+    OT_UNUSED_VARIABLE(aServices);
+    OT_UNUSED_VARIABLE(aRemovedServices);
+
+    SuccessOrQuit(aError);
+    VerifyOrExit(client.mIsBusy);
+
+    VerifyOrQuit(sNumLatencies < kMaxNumHosts);
+    sLatencies[sNumLatencies++] = TimerMilli::GetNow() - client.mStartTime;
+
+    client.mIsBusy = false;
+
+exit:
+    return;
+}
+
+void StartUpdate(ClientInfo &aClient, uint16_t aHostIndex, Phase aPhase)
+{
+    Srp::Client &srpClient = aClient.mNode->Get<Srp::Client>();
+
+    srpClient.ClearHostAndServices();
+
+    aClient.mHostName.Clear().Append("load-host-%u", aHostIndex);
+    aClient.mInstanceName.Clear().Append("load-instance-%u", aHostIndex);
+
+    SuccessOrQuit(srpClient.SetHostName(aClient.mHostName.AsCString()));
+    SuccessOrQuit(srpClient.EnableAutoHostAddress());
+
+    if (aPhase == kRemove)
+    {
+        // Registering the host name and then removing it (with its
+        // key lease) sends an SRP update removing the host and all
+        // its services from the server.
+
+        SuccessOrQuit(srpClient.RemoveHostAndServices(/* aShouldRemoveKeyLease */ true,
+                                                      /* aSendUnregToServer */ true));
+    }
+    else
+    {
+        ClearAllBytes(aClient.mService);
+        aClient.mService.mName         = kServiceName;
+        aClient.mService.mInstanceName = aClient.mInstanceName.AsCString();
+        aClient.mService.mPort         = kServicePort;
+
+        SuccessOrQuit(srpClient.AddService(aClient.mService));
+    }
+
+    aClient.mStartTime = TimerMilli::GetNow();
+    aClient.mIsBusy    = true;
+}
+
+uint16_t CountRegisteredHosts(Node &aServer)
+{
+    uint16_t                 count = 0;
+    const Srp::Server::Host *host  = nullptr;
+
+    while ((host = aServer.Get<Srp::Server>().GetNextHost(host)) != nullptr)
+    {
+        if (!host->IsDeleted())
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+uint32_t GetPercentile(uint16_t aPercent)
+{
+    // `sLatencies` MUST be sorted.
+
+    uint16_t index = static_cast<uint16_t>((static_cast<uint32_t>(sNumLatencies) * aPercent) / 100);
+
+    return sLatencies[Min<uint16_t>(index, sNumLatencies - 1)];
+}
+
+void RunPhase(Core &aNexus, Node &aServer, uint16_t aNumHosts, Phase aPhase)
+{
+    std::chrono::steady_clock::time_point startTime;
+    double                                duration;
+    size_t                                startHeapSize;
+    uint16_t                              numCompleted;
+    TimeMilli                             deadline;
+
+    Log("---------------------------------------------------------------------------------------");
+    Log("%s %u hosts", PhaseToString(aPhase), aNumHosts);
+
+    for (ClientInfo &client : sClients)
+    {
+        client.mNextHostIndex = static_cast<uint16_t>(&client - sClients);
+        client.mIsBusy        = false;
+    }
+
+    sNumLatencies = 0;
+    startHeapSize = Core::GetHeapUsage().mCurrentSize;
+    Core::ResetHeapPeakSize();
+
+    deadline  = TimerMilli::GetNow() + (static_cast<uint32_t>(aNumHosts) * kMaxUpdateTime);
+    startTime = std::chrono::steady_clock::now();
+
+    do
+    {
+        numCompleted = 0;
+
+        for (ClientInfo &client : sClients)
+        {
+            if (client.mIsBusy)
+            {
+                continue;
+            }
+
+            if (client.mNextHostIndex >= aNumHosts)
+            {
+                numCompleted++;
+                continue;
+            }
+
+            StartUpdate(client, client.mNextHostIndex, aPhase);
+            client.mNextHostIndex += kNumClientNodes;
+        }
+
+        aNexus.AdvanceTime(kStepInterval);
+        VerifyOrQuit(TimerMilli::GetNow() < deadline);
+
+    } while (numCompleted < kNumClientNodes);
+
+    duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    VerifyOrQuit(sNumLatencies == aNumHosts);
+    std::sort(sLatencies, sLatencies + sNumLatencies);
+
+    Log("%s: %u updates in %.3f sec, %.1f updates/sec", PhaseToString(aPhase), sNumLatencies, duration,
+        sNumLatencies / duration);
+    Log("%s: heap high-water: %lu bytes (%lu at start, %lu at end)", PhaseToString(aPhase),
+        ToUlong(Core::GetHeapUsage().mPeakSize), ToUlong(startHeapSize),
+        ToUlong(Core::GetHeapUsage().mCurrentSize));
+    Log("%s: commit latency p50:%lu msec, p99:%lu msec, max:%lu msec", PhaseToString(aPhase),
+        ToUlong(GetPercentile(50)), ToUlong(GetPercentile(99)), ToUlong(sLatencies[sNumLatencies - 1]));
+
+    VerifyOrQuit(CountRegisteredHosts(aServer) == ((aPhase == kRemove) ? 0 : aNumHosts));
+}
+
+} // namespace
+
+void TestSrpLoad(uint16_t aNumHosts)
+{
+    /**
+     * Topology:
+     *
+     *          BR (SRP server, Advertising Proxy, DNS-SD server)
+     *           |
+     *     +-----+-----+- ... -+
+     *     |     |     |       |
+     *    FED1  FED2  FED3 ... FED8 (SRP clients)
+     */
+
+    Core  nexus;
+    Node &br = nexus.CreateNode();
+
+    Log("SRP load test: %u hosts over %u client nodes", aNumHosts, kNumClientNodes);
+
+    br.SetName("BR");
+    br.Form();
+    nexus.AdvanceTime(0);
+
+    SuccessOrQuit(Instance::SetGlobalLogLevel(kLogLevelNote));
+
+    SuccessOrQuit(br.Get<Srp::Server>().SetAddressMode(Srp::Server::kAddressModeUnicast));
+    br.Get<Srp::Server>().SetEnabled(true);
+    br.Get<BorderRouter::InfraIf>().Init(kInfraIfIndex, true);
+    br.Get<BorderRouter::RoutingManager>().Init();
+    SuccessOrQuit(br.Get<BorderRouter::RoutingManager>().SetEnabled(true));
+    nexus.AdvanceTime(15 * TimeMilli::kOneSecondInMsec);
+
+    VerifyOrQuit(br.Get<Mle::Mle>().IsLeader());
+    VerifyOrQuit(br.Get<Srp::Server>().GetState() == Srp::Server::kStateRunning);
+
+    for (uint16_t i = 0; i < kNumClientNodes; i++)
+    {
+        ClientInfo &client = sClients[i];
+
+        client.mNode = &nexus.CreateNode();
+        client.mNode->SetName("FED", i + 1);
+        client.mNode->Join(br, Node::kAsFed);
+    }
+
+    nexus.AdvanceTime(30 * TimeMilli::kOneSecondInMsec);
+
+    for (ClientInfo &client : sClients)
+    {
+        VerifyOrQuit(client.mNode->Get<Mle::Mle>().IsChild());
+
+        client.mNode->Get<Srp::Client>().SetCallback(HandleSrpClientCallback, &client);
+        client.mNode->Get<Srp::Client>().EnableAutoStartMode(nullptr, nullptr);
+    }
+
+    nexus.AdvanceTime(5 * TimeMilli::kOneSecondInMsec);
+
+    for (ClientInfo &client : sClients)
+    {
+        VerifyOrQuit(client.mNode->Get<Srp::Client>().IsRunning());
+    }
+
+    RunPhase(nexus, br, aNumHosts, kRegister);
+    RunPhase(nexus, br, aNumHosts, kRenew);
+    RunPhase(nexus, br, aNumHosts, kRemove);
+
+    Log("Test passed");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(int argc, char *argv[])
+{
+    uint16_t numHosts = ot::Nexus::kDefaultNumHosts;
+
+    if (argc > 1)
+    {
+        unsigned long value = strtoul(argv[1], nullptr, 0);
+
+        numHosts = static_cast<uint16_t>(ot::Clamp<unsigned long>(value, 1, ot::Nexus::kMaxNumHosts));
+    }
+
+    ot::Nexus::TestSrpLoad(numHosts);
+    printf("All tests passed\n");
+    return 0;
+}
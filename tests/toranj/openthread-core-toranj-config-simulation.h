@@ -123,4 +123,24 @@
 
 #define OPENTHREAD_CONFIG_OTNS_ENABLE 1
 
+#define OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE 1
+
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE 1
+
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE 1
+
+#define OPENTHREAD_CONFIG_NETDATA_CONTEXT_TABLE_ENABLE 1
+
+#define OPENTHREAD_CONFIG_CRC_TABLE_SLICES 8
+
+#define OPENTHREAD_CONFIG_MESSAGE_CHUNK_CURSOR_ENABLE 1
+
+#define OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE 1
+
+#define OPENTHREAD_CONFIG_SRP_SERVER_VERIFY_BATCH_SIZE 2
+
+#define OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS 8
+
+#define OPENTHREAD_CONFIG_CRYPTO_AES_HW_ACCEL_ENABLE 1
+
 #endif // OT_TORANJ_OPENTHREAD_CORE_TORANJ_CONFIG_SIMULATION_H_
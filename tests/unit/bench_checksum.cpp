@@ -0,0 +1,110 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/code_utils.hpp"
+#include "common/random.hpp"
+#include "instance/instance.hpp"
+#include "net/checksum.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+class ChecksumTester
+{
+public:
+    static void BenchmarkAddData(void)
+    {
+        // Measures the throughput of `AddData()` against adding the
+        // same data one byte at a time (using `AddUint8()`), for
+        // typical IPv6 payload sizes.
+
+        static const uint16_t     kSizes[]       = {64, 127, 512, 1280};
+        static const char *const  kColumnNames[] = {"AddData(MB/s)", "AddUint8(MB/s)"};
+        static constexpr uint32_t kNumRounds     = 20000;
+
+        Instance       *instance = static_cast<Instance *>(testInitInstance());
+        uint8_t         bytes[1280];
+        BenchmarkReport report("size", kColumnNames);
+
+        printf("\nBenchmarkAddData\n");
+
+        VerifyOrQuit(instance != nullptr);
+
+        Random::NonCrypto::Fill(bytes);
+
+        for (uint16_t size : kSizes)
+        {
+            BenchmarkTimer addDataTimer;
+            BenchmarkTimer addUint8Timer;
+
+            addDataTimer.Start();
+
+            for (uint32_t round = 0; round < kNumRounds; round++)
+            {
+                Checksum checksum;
+
+                checksum.AddData(bytes, size);
+                KeepBenchmarkResult(checksum.GetValue());
+            }
+
+            addDataTimer.Stop();
+            addUint8Timer.Start();
+
+            for (uint32_t round = 0; round < kNumRounds; round++)
+            {
+                Checksum checksum;
+
+                for (uint16_t i = 0; i < size; i++)
+                {
+                    checksum.AddUint8(bytes[i]);
+                }
+
+                KeepBenchmarkResult(checksum.GetValue());
+            }
+
+            addUint8Timer.Stop();
+
+            report.BeginRow("%u", size);
+            report.AddValue(addDataTimer.GetMbPerSec(static_cast<uint64_t>(size) * kNumRounds));
+            report.AddValue(addUint8Timer.GetMbPerSec(static_cast<uint64_t>(size) * kNumRounds));
+            report.EndRow();
+        }
+
+        testFreeInstance(instance);
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::ChecksumTester::BenchmarkAddData();
+    return 0;
+}
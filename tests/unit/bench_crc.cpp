@@ -0,0 +1,125 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+
+#include "common/code_utils.hpp"
+#include "common/crc.hpp"
+
+#include "test_util.hpp"
+
+namespace ot {
+
+template <typename UintType>
+static UintType CalculateBitwiseCrc(UintType aPolynomial, const uint8_t *aBytes, uint16_t aLength)
+{
+    // Reference bit-wise CRC computation.
+
+    static constexpr uint8_t  kBitShift = (sizeof(UintType) - 1) * 8;
+    static constexpr UintType kMsb      = static_cast<UintType>(1u << (sizeof(UintType) * 8 - 1));
+
+    UintType crc = 0;
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        crc ^= static_cast<UintType>(aBytes[i]) << kBitShift;
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & kMsb) ? static_cast<UintType>((crc << 1) ^ aPolynomial) : static_cast<UintType>(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+template <typename UintType>
+static void BenchmarkCrc(const char *aName, UintType aPolynomial, BenchmarkReport &aReport)
+{
+    static constexpr uint16_t kBufferSize = 1280;
+    static constexpr uint32_t kNumRounds  = 2000;
+
+    uint8_t        bytes[kBufferSize];
+    uint64_t       totalBytes = static_cast<uint64_t>(kBufferSize) * kNumRounds;
+    BenchmarkTimer feedTimer;
+    BenchmarkTimer bitwiseTimer;
+
+    for (uint8_t &byte : bytes)
+    {
+        byte = static_cast<uint8_t>(rand());
+    }
+
+    VerifyOrQuit(CrcCalculator<UintType>(aPolynomial).FeedBytes(bytes, kBufferSize) ==
+                 CalculateBitwiseCrc(aPolynomial, bytes, kBufferSize));
+
+    feedTimer.Start();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        KeepBenchmarkResult(CrcCalculator<UintType>(aPolynomial).FeedBytes(bytes, kBufferSize));
+    }
+
+    feedTimer.Stop();
+    bitwiseTimer.Start();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        KeepBenchmarkResult(CalculateBitwiseCrc(aPolynomial, bytes, kBufferSize));
+    }
+
+    bitwiseTimer.Stop();
+
+    aReport.BeginRow("%s", aName);
+    aReport.AddValue(feedTimer.GetMbPerSec(totalBytes));
+    aReport.AddValue(bitwiseTimer.GetMbPerSec(totalBytes));
+    aReport.EndRow();
+}
+
+void BenchmarkCrc(void)
+{
+    // Measures the throughput of `CrcCalculator::FeedBytes()` (which
+    // depends on `OPENTHREAD_CONFIG_CRC_TABLE_SLICES`) against the
+    // reference bit-wise computation.
+
+    static const char *const kColumnNames[] = {"FeedBytes(MB/s)", "bitwise(MB/s)"};
+
+    BenchmarkReport report("crc", kColumnNames);
+
+    printf("\nBenchmarkCrc (slices: %u)\n", OPENTHREAD_CONFIG_CRC_TABLE_SLICES);
+
+    BenchmarkCrc<uint16_t>("crc16", kCrc16CcittPolynomial, report);
+    BenchmarkCrc<uint32_t>("crc32", kCrc32AnsiPolynomial, report);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::BenchmarkCrc();
+    return 0;
+}
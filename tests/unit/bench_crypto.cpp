@@ -0,0 +1,206 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "common/debug.hpp"
+#include "common/message.hpp"
+#include "crypto/aes_ccm.hpp"
+#include "instance/instance.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+// Micro-benchmark of the AES-CCM* operations used to secure MAC
+// frames and MLE messages. The reported rates depend on the host.
+// Each case also validates that the processed content round-trips.
+
+static constexpr uint16_t kNumIterations = 2000;
+static constexpr uint8_t  kTagLength     = 4; // MIC-32 (security level 5)
+
+static const uint8_t kKey[] = {
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+};
+
+static const uint8_t kNonce[] = {
+    0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x05,
+};
+
+static void ReportRate(const char *aName, uint16_t aPayloadLength, const BenchmarkTimer &aTimer)
+{
+    uint64_t elapsed = aTimer.GetElapsedUsec();
+
+    printf("  %-34s payload %4u bytes: %8.1f ops/s, %8.1f KiB/s (%.2f us/op)\n", aName, aPayloadLength,
+           kNumIterations * 1e6 / elapsed, kNumIterations * static_cast<double>(aPayloadLength) * 1e6 / elapsed / 1024,
+           static_cast<double>(elapsed) / kNumIterations);
+}
+
+void BenchmarkMacFrame(uint16_t aHeaderLength, uint16_t aPayloadLength)
+{
+    static constexpr uint16_t kMaxFrameSize = 127;
+
+    uint8_t        frame[kMaxFrameSize];
+    uint8_t        original[kMaxFrameSize];
+    uint8_t        encrypted[kMaxFrameSize];
+    BenchmarkTimer encryptTimer;
+    BenchmarkTimer decryptTimer;
+    Crypto::AesCcm aesCcm;
+
+    VerifyOrQuit(aHeaderLength + aPayloadLength + kTagLength <= kMaxFrameSize);
+
+    for (uint16_t i = 0; i < sizeof(frame); i++)
+    {
+        frame[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    memcpy(original, frame, sizeof(frame));
+
+    aesCcm.SetKey(kKey, sizeof(kKey));
+    aesCcm.SetNonce(kNonce, sizeof(kNonce));
+    aesCcm.SetTagLength(kTagLength);
+    aesCcm.SetAuthData(frame, aHeaderLength);
+
+    // Encryption is repeated in place over the same frame. Decryption
+    // restores the same encrypted frame before each iteration.
+
+    encryptTimer.Start();
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kEncrypt, &frame[aHeaderLength], aPayloadLength));
+    }
+
+    encryptTimer.Stop();
+
+    ReportRate("MAC frame encrypt", aPayloadLength, encryptTimer);
+
+    memcpy(frame, original, sizeof(frame));
+    SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kEncrypt, &frame[aHeaderLength], aPayloadLength));
+    VerifyOrQuit(memcmp(frame, original, aHeaderLength) == 0);
+
+    memcpy(encrypted, frame, sizeof(frame));
+
+    decryptTimer.Start();
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        memcpy(&frame[aHeaderLength], &encrypted[aHeaderLength], aPayloadLength + kTagLength);
+        SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kDecrypt, &frame[aHeaderLength], aPayloadLength));
+    }
+
+    decryptTimer.Stop();
+
+    ReportRate("MAC frame decrypt", aPayloadLength, decryptTimer);
+
+    VerifyOrQuit(memcmp(frame, original, aHeaderLength + aPayloadLength) == 0);
+}
+
+void BenchmarkMessage(uint16_t aAuthDataLength, uint16_t aPayloadLength)
+{
+    static constexpr uint16_t kMaxBufferSize = 1280;
+
+    Instance      *instance = testInitInstance();
+    Message       *message;
+    uint8_t        buffer[kMaxBufferSize];
+    BenchmarkTimer timer;
+    Crypto::AesCcm aesCcm;
+
+    VerifyOrQuit(instance != nullptr);
+    VerifyOrQuit(aAuthDataLength + aPayloadLength + kTagLength <= kMaxBufferSize);
+
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+
+    for (uint16_t i = 0; i < aAuthDataLength + aPayloadLength; i++)
+    {
+        buffer[i] = static_cast<uint8_t>(i ^ (i >> 8));
+    }
+
+    SuccessOrQuit(message->AppendBytes(buffer, aAuthDataLength + aPayloadLength));
+
+    aesCcm.SetKey(kKey, sizeof(kKey));
+    aesCcm.SetNonce(kNonce, sizeof(kNonce));
+    aesCcm.SetTagLength(kTagLength);
+    aesCcm.SetAuthData(buffer, aAuthDataLength);
+
+    // Each iteration encrypts and then decrypts the message in place
+    // (walking its buffer chunks), so the content is restored.
+
+    timer.Start();
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kEncrypt, *message, aAuthDataLength));
+        SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kDecrypt, *message, aAuthDataLength));
+    }
+
+    timer.Stop();
+
+    ReportRate("Message encrypt+decrypt", aPayloadLength, timer);
+
+    VerifyOrQuit(message->GetLength() == aAuthDataLength + aPayloadLength);
+    VerifyOrQuit(message->CompareBytes(0, buffer, aAuthDataLength + aPayloadLength));
+
+    // Validate that processing the message gives the same result as
+    // processing the same content in a contiguous buffer.
+
+    SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kEncrypt, *message, aAuthDataLength));
+    SuccessOrQuit(aesCcm.Process(Crypto::AesCcm::kEncrypt, &buffer[aAuthDataLength], aPayloadLength));
+    VerifyOrQuit(message->CompareBytes(0, buffer, aAuthDataLength + aPayloadLength + kTagLength));
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+void BenchmarkAesCcm(void)
+{
+    printf("BenchmarkAesCcm (%u iterations per case)\n", kNumIterations);
+
+    // MAC data frame with short addresses and auxiliary security header.
+    BenchmarkMacFrame(/* aHeaderLength */ 15, /* aPayloadLength */ 5);
+    BenchmarkMacFrame(/* aHeaderLength */ 15, /* aPayloadLength */ 64);
+    BenchmarkMacFrame(/* aHeaderLength */ 15, /* aPayloadLength */ 102);
+
+    // MAC data frame with extended addresses.
+    BenchmarkMacFrame(/* aHeaderLength */ 27, /* aPayloadLength */ 90);
+
+    // MLE message (auth data has the IPv6 addresses and security header).
+    BenchmarkMessage(/* aAuthDataLength */ 42, /* aPayloadLength */ 96);
+    BenchmarkMessage(/* aAuthDataLength */ 42, /* aPayloadLength */ 600);
+    BenchmarkMessage(/* aAuthDataLength */ 42, /* aPayloadLength */ 1200);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::BenchmarkAesCcm();
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+
+#include "common/array.hpp"
+#include "common/code_utils.hpp"
+#include "lib/hdlc/hdlc.hpp"
+#include "lib/spinel/multi_frame_buffer.hpp"
+
+#include "test_util.hpp"
+
+namespace ot {
+namespace Ncp {
+
+constexpr uint16_t kBufferSize = 1500;
+
+static bool NeedsEscape(uint8_t aByte)
+{
+    static const uint8_t kHdlcSpecials[] = {0x7e, 0x7d, 0x11, 0x13, 0xf8};
+
+    bool needsEscape = false;
+
+    for (uint8_t special : kHdlcSpecials)
+    {
+        if (aByte == special)
+        {
+            needsEscape = true;
+            break;
+        }
+    }
+
+    return needsEscape;
+}
+
+struct BenchmarkContext
+{
+    Spinel::FrameBuffer<kBufferSize> *mBuffer;
+    uint32_t                          mNumFrames;
+};
+
+static void ProcessBenchmarkFrame(void *aContext, otError aError)
+{
+    BenchmarkContext &context = *static_cast<BenchmarkContext *>(aContext);
+
+    VerifyOrQuit(aError == OT_ERROR_NONE);
+    context.mNumFrames++;
+    context.mBuffer->Clear();
+}
+
+void BenchmarkDecoder(void)
+{
+    // Measures the decoder throughput (in bytes/sec of encoded input)
+    // when the received data is fed as one block (as read from the
+    // UART/socket) versus fed one byte at a time, which always goes
+    // through the byte-wise state machine. Frames carry either random
+    // payloads (some escaped bytes) or payloads without any bytes that
+    // need escaping.
+
+    static constexpr uint16_t kFrameLength    = 127;
+    static constexpr uint16_t kNumFrames      = 64;
+    static constexpr uint16_t kStreamSize     = kNumFrames * (2 * kFrameLength + 8);
+    static constexpr uint32_t kNumRounds      = 500;
+    static const char *const  kPayloadNames[] = {"random", "no-escape"};
+    static const char *const  kColumnNames[]  = {"block(MB/s)", "byte-wise(MB/s)"};
+
+    BenchmarkReport report("payload", kColumnNames);
+
+    printf("\nBenchmarkDecoder\n");
+
+    for (uint8_t payloadType = 0; payloadType < GetArrayLength(kPayloadNames); payloadType++)
+    {
+        static uint8_t                   stream[kStreamSize];
+        uint16_t                         streamLength = 0;
+        Spinel::FrameBuffer<kBufferSize> encoderBuffer;
+        Spinel::FrameBuffer<kBufferSize> decoderBuffer;
+        Hdlc::Encoder                    encoder(encoderBuffer);
+        Hdlc::Decoder                    decoder;
+        BenchmarkContext                 context;
+        BenchmarkTimer                   blockTimer;
+        BenchmarkTimer                   byteTimer;
+        uint64_t                         totalBytes;
+
+        for (uint16_t n = 0; n < kNumFrames; n++)
+        {
+            uint8_t frame[kFrameLength];
+
+            for (uint8_t &byte : frame)
+            {
+                do
+                {
+                    byte = static_cast<uint8_t>(rand());
+                } while ((payloadType == 1) && NeedsEscape(byte));
+            }
+
+            encoderBuffer.Clear();
+            SuccessOrQuit(encoder.BeginFrame());
+            SuccessOrQuit(encoder.Encode(frame, sizeof(frame)));
+            SuccessOrQuit(encoder.EndFrame());
+
+            VerifyOrQuit(streamLength + encoderBuffer.GetLength() <= kStreamSize);
+            memcpy(&stream[streamLength], encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+            streamLength += encoderBuffer.GetLength();
+        }
+
+        context.mBuffer    = &decoderBuffer;
+        context.mNumFrames = 0;
+        decoder.Init(decoderBuffer, ProcessBenchmarkFrame, &context);
+
+        decoder.Decode(stream, streamLength);
+        VerifyOrQuit(context.mNumFrames == kNumFrames);
+
+        blockTimer.Start();
+
+        for (uint32_t round = 0; round < kNumRounds; round++)
+        {
+            decoder.Decode(stream, streamLength);
+        }
+
+        blockTimer.Stop();
+        byteTimer.Start();
+
+        for (uint32_t round = 0; round < kNumRounds; round++)
+        {
+            for (uint16_t i = 0; i < streamLength; i++)
+            {
+                decoder.Decode(&stream[i], 1);
+            }
+        }
+
+        byteTimer.Stop();
+
+        totalBytes = static_cast<uint64_t>(streamLength) * kNumRounds;
+
+        report.BeginRow("%s", kPayloadNames[payloadType]);
+        report.AddValue(blockTimer.GetMbPerSec(totalBytes));
+        report.AddValue(byteTimer.GetMbPerSec(totalBytes));
+        report.EndRow();
+    }
+}
+
+} // namespace Ncp
+} // namespace ot
+
+int main(void)
+{
+    ot::Ncp::BenchmarkDecoder();
+    return 0;
+}
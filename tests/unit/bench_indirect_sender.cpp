@@ -0,0 +1,205 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include <openthread/config.h>
+
+#include "common/code_utils.hpp"
+#include "instance/instance.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD
+
+class UnitTester
+{
+public:
+    static void BenchmarkPoll(void);
+
+private:
+    static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+    static constexpr uint16_t kMaxMessages = 256;
+
+    static void           AddChildren(Instance &aInstance, uint16_t aNumChildren);
+    static Message       *NewQueuedMessage(Instance &aInstance);
+    static void           ClearQueue(Instance &aInstance);
+    static const Message *FindByScan(Instance &aInstance, const Child &aChild);
+};
+
+void UnitTester::AddChildren(Instance &aInstance, uint16_t aNumChildren)
+{
+    ChildTable &childTable = aInstance.Get<ChildTable>();
+
+    childTable.Clear();
+
+    for (uint16_t i = 0; i < aNumChildren; i++)
+    {
+        Child *child = childTable.GetNewChild();
+
+        VerifyOrQuit(child != nullptr);
+        child->SetState(Neighbor::kStateValid);
+        child->SetRloc16(0x1001 + i);
+        child->SetDeviceMode(Mle::DeviceMode(0));
+    }
+}
+
+Message *UnitTester::NewQueuedMessage(Instance &aInstance)
+{
+    Message *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+
+    if (message != nullptr)
+    {
+        SuccessOrQuit(message->SetLength(40));
+        aInstance.Get<MeshForwarder>().mSendQueue.Enqueue(*message);
+    }
+
+    return message;
+}
+
+void UnitTester::ClearQueue(Instance &aInstance)
+{
+    for (Child &child : aInstance.Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        aInstance.Get<MeshForwarder>().mIndirectSender.ClearAllMessagesForSleepyChild(child);
+    }
+
+    VerifyOrQuit(aInstance.Get<MeshForwarder>().mSendQueue.GetHead() == nullptr);
+}
+
+const Message *UnitTester::FindByScan(Instance &aInstance, const Child &aChild)
+{
+    // Finds the first message for the child by scanning the entire
+    // send queue (the lookup done before the per-child queue head).
+
+    const Message *match      = nullptr;
+    uint16_t       childIndex = aInstance.Get<ChildTable>().GetChildIndex(aChild);
+
+    for (const Message &message : aInstance.Get<MeshForwarder>().mSendQueue)
+    {
+        if (message.GetIndirectTxChildMask().Has(childIndex))
+        {
+            match = &message;
+            break;
+        }
+    }
+
+    return match;
+}
+
+void UnitTester::BenchmarkPoll(void)
+{
+    // Measures the time to find the next queued message for a sleepy
+    // child (i.e., the lookup done on each data poll and tx done) as
+    // the number of children and queue depth grow. Messages are queued
+    // round-robin to the children so the first message for the child
+    // with the highest index is deep in the queue.
+
+    static const uint16_t    kNumChildren[] = {1, kMaxChildren / 2, kMaxChildren};
+    static const uint16_t    kQueueDepths[] = {16, 64, kMaxMessages};
+    static const uint16_t    kNumLookups    = 20000;
+    static const char *const kColumnNames[] = {"indexed(ns/poll)", "scan(ns/poll)"};
+
+    Instance       *instance = static_cast<Instance *>(testInitInstance());
+    BenchmarkReport report("children/depth", kColumnNames);
+
+    VerifyOrQuit(instance != nullptr);
+
+    printf("\nBenchmarkPoll\n");
+
+    for (uint16_t numChildren : kNumChildren)
+    {
+        AddChildren(*instance, numChildren);
+
+        for (uint16_t depth : kQueueDepths)
+        {
+            IndirectSender &indirectSender = instance->Get<MeshForwarder>().mIndirectSender;
+            uint16_t        numQueued      = 0;
+            BenchmarkTimer  indexedTimer;
+            BenchmarkTimer  scanTimer;
+
+            for (; numQueued < depth; numQueued++)
+            {
+                Message *message = NewQueuedMessage(*instance);
+
+                if (message == nullptr)
+                {
+                    break;
+                }
+
+                indirectSender.AddMessageForSleepyChild(*message, *instance->Get<ChildTable>().GetChildAtIndex(
+                                                                      numQueued % numChildren));
+            }
+
+            indexedTimer.Start();
+
+            for (uint16_t i = 0; i < kNumLookups; i++)
+            {
+                const Child &child = *instance->Get<ChildTable>().GetChildAtIndex(i % numChildren);
+
+                KeepBenchmarkResult(reinterpret_cast<uintptr_t>(
+                    indirectSender.FindQueuedMessageForSleepyChild(child, IndirectSender::AcceptAnyMessage)));
+            }
+
+            indexedTimer.Stop();
+            scanTimer.Start();
+
+            for (uint16_t i = 0; i < kNumLookups; i++)
+            {
+                KeepBenchmarkResult(reinterpret_cast<uintptr_t>(
+                    FindByScan(*instance, *instance->Get<ChildTable>().GetChildAtIndex(i % numChildren))));
+            }
+
+            scanTimer.Stop();
+
+            report.BeginRow("%u/%u", numChildren, numQueued);
+            report.AddValue(indexedTimer.GetNsPerOp(kNumLookups));
+            report.AddValue(scanTimer.GetNsPerOp(kNumLookups));
+            report.EndRow();
+
+            ClearQueue(*instance);
+        }
+    }
+
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    ot::UnitTester::BenchmarkPoll();
+#endif
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/code_utils.hpp"
+#include "common/frame_builder.hpp"
+#include "instance/instance.hpp"
+#include "thread/lowpan.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+static void InitNetworkData(Instance &aInstance)
+{
+    otMeshLocalPrefix meshLocalPrefix = {{0xfd, 0x00, 0xca, 0xfe, 0xfa, 0xce, 0x12, 0x34}};
+    OffsetRange       offsetRange;
+    Message          *message;
+
+    aInstance.Get<Mle::Mle>().SetMeshLocalPrefix(static_cast<Ip6::NetworkPrefix &>(meshLocalPrefix));
+
+    // Prefixes with 6LoWPAN contexts.
+    const uint8_t kNetworkData[] = {
+        0x0c, // MLE Network Data Type
+        0x20, // MLE Network Data Length
+
+        // Prefix 2001:2:0:1::/64
+        0x03, 0x0e,                                                             // Prefix TLV
+        0x00, 0x40, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x07, 0x02, // 6LoWPAN Context ID TLV
+        0x11, 0x40,                                                             // Context ID = 1, C = TRUE
+
+        // Prefix 2001:2:0:2::/64
+        0x03, 0x0e,                                                             // Prefix TLV
+        0x00, 0x40, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x07, 0x02, // 6LoWPAN Context ID TLV
+        0x02, 0x40                                                              // Context ID = 2, C = FALSE
+    };
+
+    message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+
+    SuccessOrQuit(message->AppendBytes(kNetworkData, sizeof(kNetworkData)));
+
+    offsetRange.Init(2, 0x20);
+
+    IgnoreError(
+        aInstance.Get<NetworkData::Leader>().SetNetworkData(0, 0, NetworkData::kStableSubset, *message, offsetRange));
+
+    message->Free();
+}
+
+void BenchmarkLowpan(void)
+{
+    // Measures the throughput of compressing and decompressing a frame
+    // whose source and destination addresses use stateful (context
+    // based) compression, i.e., each frame requires finding the
+    // context for its addresses (on compression) or for its Context
+    // ID (on decompression).
+
+    static constexpr uint32_t kNumIterations = 50000;
+    static const uint8_t      kPayload[]     = {0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    static const char *const  kColumnNames[] = {"compress(ns/frame)", "decompress(ns/frame)"};
+
+    Instance       *instance = testInitInstance();
+    Lowpan::Lowpan *lowpan;
+    Mac::Addresses  macAddrs;
+    Ip6::Header     ip6Header;
+    Message        *message;
+    Message        *decompressedMsg;
+    FrameBuilder    frameBuilder;
+    FrameData       frameData;
+    uint8_t         frame[127];
+    uint16_t        frameLength;
+    BenchmarkTimer  compressTimer;
+    BenchmarkTimer  decompressTimer;
+    BenchmarkReport report("frame", kColumnNames);
+
+    printf("\nBenchmarkLowpan\n");
+
+    VerifyOrQuit(instance != nullptr);
+    lowpan = &instance->Get<Lowpan::Lowpan>();
+
+    InitNetworkData(*instance);
+
+    macAddrs.mSource.SetShort(0x0000);
+    macAddrs.mDestination.SetShort(0xc003);
+
+    ip6Header.Clear();
+    ip6Header.InitVersionTrafficClassFlow();
+    ip6Header.SetPayloadLength(sizeof(kPayload));
+    ip6Header.SetNextHeader(Ip6::kProtoIcmp6);
+    ip6Header.SetHopLimit(64);
+    SuccessOrQuit(ip6Header.GetSource().FromString("2001:2:0:1:abcd:ef01:2345:6789"));
+    SuccessOrQuit(ip6Header.GetDestination().FromString("2001:2:0:1:c31d:a702:0d41:beef"));
+
+    VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+    VerifyOrQuit((decompressedMsg = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+
+    SuccessOrQuit(message->Append(ip6Header));
+    SuccessOrQuit(message->AppendBytes(kPayload, sizeof(kPayload)));
+
+    // Check that the frame decompresses to the original header.
+
+    frameBuilder.Init(frame, sizeof(frame));
+    SuccessOrQuit(lowpan->Compress(*message, macAddrs, frameBuilder));
+    frameLength = frameBuilder.GetLength();
+
+    frameData.Init(frame, frameLength);
+    SuccessOrQuit(lowpan->Decompress(*decompressedMsg, macAddrs, frameData, 0));
+
+    VerifyOrQuit(decompressedMsg->GetLength() == message->GetOffset());
+    VerifyOrQuit(decompressedMsg->CompareBytes(0, *message, 0, decompressedMsg->GetLength()));
+
+    compressTimer.Start();
+
+    for (uint32_t i = 0; i < kNumIterations; i++)
+    {
+        message->SetOffset(0);
+        frameBuilder.Init(frame, sizeof(frame));
+        SuccessOrQuit(lowpan->Compress(*message, macAddrs, frameBuilder));
+    }
+
+    compressTimer.Stop();
+    decompressTimer.Start();
+
+    for (uint32_t i = 0; i < kNumIterations; i++)
+    {
+        SuccessOrQuit(decompressedMsg->SetLength(0));
+        decompressedMsg->SetOffset(0);
+        frameData.Init(frame, frameLength);
+        SuccessOrQuit(lowpan->Decompress(*decompressedMsg, macAddrs, frameData, 0));
+    }
+
+    decompressTimer.Stop();
+
+    report.BeginRow("iphc");
+    report.AddValue(compressTimer.GetNsPerOp(kNumIterations));
+    report.AddValue(decompressTimer.GetNsPerOp(kNumIterations));
+    report.EndRow();
+
+    message->Free();
+    decompressedMsg->Free();
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::BenchmarkLowpan();
+    return 0;
+}
@@ -0,0 +1,272 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "common/as_core_type.hpp"
+#include "common/string.hpp"
+#include "common/time.hpp"
+#include "instance/instance.hpp"
+#include "net/mdns.hpp"
+
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_ENABLE
+
+namespace ot {
+namespace Dns {
+namespace Multicast {
+
+static constexpr uint16_t kMdnsPort     = 5353;
+static constexpr uint32_t kInfraIfIndex = 1;
+
+static const char    kDeviceIp6Address[] = "fd01::1";
+static const uint8_t kTxtData[]          = {3, 'a', '=', '1', 0};
+
+typedef String<Name::kMaxNameSize> DnsNameString;
+
+static Instance *sInstance;
+static uint32_t  sNow;
+static uint32_t  sAlarmTime;
+static bool      sAlarmOn;
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+otError otPlatMdnsSetListeningEnabled(otInstance *, bool, uint32_t) { return kErrorNone; }
+
+// The sent messages are dropped. The benchmark only measures the
+// processing of the received queries.
+
+void otPlatMdnsSendMulticast(otInstance *, otMessage *aMessage, uint32_t) { AsCoreType(aMessage).Free(); }
+
+void otPlatMdnsSendUnicast(otInstance *, otMessage *aMessage, const otPlatMdnsAddressInfo *)
+{
+    AsCoreType(aMessage).Free();
+}
+
+} // extern "C"
+
+static void ProcessTasklets(void)
+{
+    while (otTaskletsArePending(sInstance))
+    {
+        otTaskletsProcess(sInstance);
+    }
+}
+
+static void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        ProcessTasklets();
+        sNow = sAlarmTime;
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    ProcessTasklets();
+    sNow = time;
+}
+
+static Core *InitBenchmark(void)
+{
+    sNow     = 0;
+    sAlarmOn = false;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+#if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
+    // Disable the Border Agent so that its `_meshcop._udp` service
+    // is not registered.
+
+    sInstance->Get<MeshCoP::BorderAgent::Manager>().SetEnabled(false);
+#endif
+
+    return &sInstance->Get<Core>();
+}
+
+static Message *PrepareQuery(const char *aName, uint16_t aRecordType)
+{
+    Message *message;
+    Header   header;
+
+    message = sInstance->Get<MessagePool>().Allocate(Message::kTypeOther);
+    VerifyOrQuit(message != nullptr);
+
+    header.Clear();
+    header.SetType(Header::kTypeQuery);
+    header.SetQuestionCount(1);
+
+    SuccessOrQuit(message->Append(header));
+    SuccessOrQuit(Name::AppendName(aName, *message));
+    SuccessOrQuit(message->Append(Question(aRecordType, ResourceRecord::kClassInternet)));
+
+    return message;
+}
+
+void BenchmarkQuery(void)
+{
+    // Measures the time spent by `Core` processing a received query
+    // (one question) as the number of registered services grows.
+    // Only `otPlatMdnsHandleReceive()` is timed; preparing the query
+    // and sending the scheduled responses are excluded.
+
+    static constexpr uint16_t kNumServiceTypes = 8;
+    static constexpr uint16_t kNumQueries      = 200;
+    static constexpr uint16_t kBatchSize       = 20;
+
+    static const uint16_t    kNumServices[] = {8, 32, 128};
+    static const char *const kColumnNames[] = {"SRV(ns/query)", "PTR(ns/query)", "no-match(ns/query)"};
+
+    enum QueryKind : uint8_t
+    {
+        kQuerySrv,
+        kQueryPtr,
+        kQueryNoMatch,
+        kNumQueryKinds,
+    };
+
+    BenchmarkReport report("services", kColumnNames);
+
+    printf("\nBenchmarkQuery\n");
+
+    for (uint16_t numServices : kNumServices)
+    {
+        Core             *mdns = InitBenchmark();
+        Core::Service     service;
+        Core::AddressInfo senderAddrInfo;
+        BenchmarkTimer    queryTimers[kNumQueryKinds];
+
+        AdvanceTime(1);
+
+        SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+        ClearAllBytes(service);
+        service.mHostName      = "myhost";
+        service.mTxtData       = kTxtData;
+        service.mTxtDataLength = sizeof(kTxtData);
+        service.mPort          = 1234;
+        service.mTtl           = 1000;
+
+        for (uint16_t index = 0; index < numServices; index++)
+        {
+            char instanceLabel[16];
+            char serviceType[16];
+
+            snprintf(instanceLabel, sizeof(instanceLabel), "svc%u", index);
+            snprintf(serviceType, sizeof(serviceType), "_t%u._udp", index % kNumServiceTypes);
+
+            service.mServiceInstance = instanceLabel;
+            service.mServiceType     = serviceType;
+
+            SuccessOrQuit(mdns->RegisterService(service, 0, nullptr));
+        }
+
+        // Let probes and announcements finish.
+        AdvanceTime(20000);
+
+        SuccessOrQuit(AsCoreType(&senderAddrInfo.mAddress).FromString(kDeviceIp6Address));
+        senderAddrInfo.mPort         = kMdnsPort;
+        senderAddrInfo.mInfraIfIndex = 0;
+
+        for (uint8_t kind = 0; kind < kNumQueryKinds; kind++)
+        {
+            for (uint16_t count = 0; count < kNumQueries; count++)
+            {
+                DnsNameString name;
+                Message      *message;
+                uint16_t      recordType = ResourceRecord::kTypeSrv;
+                uint16_t      index      = (count * 7) % numServices;
+
+                switch (kind)
+                {
+                case kQuerySrv:
+                    name.Append("svc%u._t%u._udp.local.", index, index % kNumServiceTypes);
+                    break;
+                case kQueryPtr:
+                    name.Append("_t%u._udp.local.", index % kNumServiceTypes);
+                    recordType = ResourceRecord::kTypePtr;
+                    break;
+                default:
+                    name.Append("missing%u._t%u._udp.local.", index, index % kNumServiceTypes);
+                    break;
+                }
+
+                message = PrepareQuery(name.AsCString(), recordType);
+
+                queryTimers[kind].Start();
+                otPlatMdnsHandleReceive(sInstance, message, /* aIsUnicast */ false, &senderAddrInfo);
+                queryTimers[kind].Stop();
+
+                if ((count % kBatchSize) == kBatchSize - 1)
+                {
+                    AdvanceTime(2000);
+                }
+            }
+        }
+
+        report.BeginRow("%u", numServices);
+
+        for (const BenchmarkTimer &queryTimer : queryTimers)
+        {
+            report.AddValue(queryTimer.GetNsPerOp(kNumQueries));
+        }
+
+        report.EndRow();
+
+        SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+        testFreeInstance(sInstance);
+    }
+}
+
+} // namespace Multicast
+} // namespace Dns
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_MULTICAST_DNS_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_MULTICAST_DNS_ENABLE
+    ot::Dns::Multicast::BenchmarkQuery();
+#endif
+    return 0;
+}
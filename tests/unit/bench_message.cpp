@@ -0,0 +1,119 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/code_utils.hpp"
+#include "common/message.hpp"
+#include "common/random.hpp"
+#include "instance/instance.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+void BenchmarkMessageRead(void)
+{
+    // Compares parsing a message as a sequence of small fields
+    // using `Message::Read()` at increasing offsets against using
+    // a `MessageReader`.
+
+    static const uint16_t     kSizes[]       = {127, 512, 1280, 4096};
+    static const uint16_t     kReadSize      = 4;
+    static constexpr uint32_t kNumRounds     = 2000;
+    static const char *const  kColumnNames[] = {"Read(offset)(ns/read)", "MessageReader(ns/read)"};
+
+    Instance       *instance;
+    Message        *message;
+    uint8_t         bytes[4096];
+    BenchmarkReport report("size", kColumnNames);
+
+    printf("\nBenchmarkMessageRead\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    Random::NonCrypto::FillBuffer(bytes, sizeof(bytes));
+
+    for (uint16_t size : kSizes)
+    {
+        BenchmarkTimer readTimer;
+        BenchmarkTimer readerTimer;
+        uint32_t       numReads = static_cast<uint32_t>(size / kReadSize) * kNumRounds;
+
+        VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+        SuccessOrQuit(message->AppendBytes(bytes, size));
+
+        readTimer.Start();
+
+        for (uint32_t round = 0; round < kNumRounds; round++)
+        {
+            for (uint16_t offset = 0; offset + kReadSize <= size; offset += kReadSize)
+            {
+                uint32_t value;
+
+                SuccessOrQuit(message->Read(offset, value));
+                KeepBenchmarkResult(value);
+            }
+        }
+
+        readTimer.Stop();
+        readerTimer.Start();
+
+        for (uint32_t round = 0; round < kNumRounds; round++)
+        {
+            MessageReader reader(*message);
+
+            while (reader.GetRemainingLength() >= kReadSize)
+            {
+                uint32_t value;
+
+                SuccessOrQuit(reader.Read(value));
+                KeepBenchmarkResult(value);
+            }
+        }
+
+        readerTimer.Stop();
+
+        report.BeginRow("%u", size);
+        report.AddValue(readTimer.GetNsPerOp(numReads));
+        report.AddValue(readerTimer.GetNsPerOp(numReads));
+        report.EndRow();
+
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::BenchmarkMessageRead();
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+#include "common/random.hpp"
+#include "common/timer.hpp"
+#include "instance/instance.hpp"
+
+#include "test_util.hpp"
+
+namespace ot {
+
+static uint32_t sNow;
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) {}
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t, uint32_t) {}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+void otPlatAlarmMicroStop(otInstance *) {}
+
+void otPlatAlarmMicroStartAt(otInstance *, uint32_t, uint32_t) {}
+
+uint32_t otPlatAlarmMicroGetNow(void) { return sNow; }
+#endif
+
+} // extern "C"
+
+template <typename TimerType> class BenchTimer : public TimerType
+{
+public:
+    explicit BenchTimer(Instance &aInstance)
+        : TimerType(aInstance, BenchTimer::HandleTimerFired)
+    {
+    }
+
+    static void HandleTimerFired(Timer &) {}
+
+    static void RemoveAll(Instance &aInstance) { TimerType::RemoveAll(aInstance); }
+};
+
+/**
+ * Measures the cost of re-starting a timer for a different number of running timers.
+ */
+template <typename TimerType> void BenchmarkTimerRestart(const char *aName)
+{
+    static constexpr uint16_t kNumTimers[]   = {10, 100, 1000, 4000};
+    static constexpr uint32_t kNumRestarts   = 50000;
+    static constexpr uint32_t kMaxInterval   = 600000;
+    static constexpr uint16_t kMaxNumTimers  = 4000;
+    static const char *const  kColumnNames[] = {"restart(ns)"};
+
+    Instance              *instance = testInitInstance();
+    BenchTimer<TimerType> *timers[kMaxNumTimers];
+    BenchmarkReport        report("timers", kColumnNames);
+
+    VerifyOrQuit(instance != nullptr);
+
+    BenchTimer<TimerType>::RemoveAll(*instance);
+    sNow = 0;
+
+    for (BenchTimer<TimerType> *&timer : timers)
+    {
+        timer = new BenchTimer<TimerType>(*instance);
+    }
+
+    printf("\nBenchmarkTimerRestart<%s>\n", aName);
+
+    for (uint16_t numTimers : kNumTimers)
+    {
+        BenchmarkTimer restartTimer;
+
+        for (uint16_t i = 0; i < numTimers; i++)
+        {
+            timers[i]->Start(Random::NonCrypto::GenerateUpToExcluding<uint32_t>(kMaxInterval) + 1);
+        }
+
+        restartTimer.Start();
+
+        for (uint32_t i = 0; i < kNumRestarts; i++)
+        {
+            BenchTimer<TimerType> &timer = *timers[i % numTimers];
+
+            timer.Start(Random::NonCrypto::GenerateUpToExcluding<uint32_t>(kMaxInterval) + 1);
+            sNow++;
+        }
+
+        restartTimer.Stop();
+
+        BenchTimer<TimerType>::RemoveAll(*instance);
+
+        report.BeginRow("%u", numTimers);
+        report.AddValue(restartTimer.GetNsPerOp(kNumRestarts));
+        report.EndRow();
+    }
+
+    for (BenchTimer<TimerType> *timer : timers)
+    {
+        delete timer;
+    }
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::BenchmarkTimerRestart<ot::TimerMilli>("TimerMilli");
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    ot::BenchmarkTimerRestart<ot::TimerMicro>("TimerMicro");
+#endif
+    return 0;
+}
@@ -467,6 +467,113 @@ public:
         VerifyOrQuit(checksum.GetValue() == kTestVectorChecksum);
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)), );
     }
+
+    static void TestAddData(void)
+    {
+        // Verifies `AddData()` over buffers and message chunks, using
+        // all offsets/lengths (including odd ones) and splitting the
+        // data at odd boundaries.
+
+        static constexpr uint16_t kMaxSize = Buffer::kSize * 3 + 24;
+
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+        Message  *message;
+        uint8_t   bytes[kMaxSize];
+
+        printf("\nTestAddData\n");
+
+        VerifyOrQuit(instance != nullptr);
+
+        Random::NonCrypto::Fill(bytes);
+
+        message = instance->Get<MessagePool>().Allocate(Message::kTypeOther);
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(bytes, sizeof(bytes)));
+
+        for (uint16_t offset = 0; offset < 8; offset++)
+        {
+            for (uint16_t length = 0; offset + length <= kMaxSize; length++)
+            {
+                uint16_t    expected = CalculateChecksum(&bytes[offset], length);
+                uint16_t    split    = length / 3;
+                Checksum    checksum;
+                OffsetRange offsetRange;
+
+                checksum.AddData(&bytes[offset], length);
+                VerifyOrQuit(checksum.GetValue() == expected);
+
+                checksum = Checksum();
+                checksum.AddData(&bytes[offset], split);
+                checksum.AddData(&bytes[offset + split], length - split);
+                VerifyOrQuit(checksum.GetValue() == expected);
+
+                offsetRange.Init(offset, length);
+                checksum = Checksum();
+                checksum.AddData(*message, offsetRange);
+                VerifyOrQuit(checksum.GetValue() == expected);
+            }
+        }
+
+        message->Free();
+        testFreeInstance(instance);
+    }
+
+    static void TestAdjustChecksum(void)
+    {
+        // Replaces a random even-aligned region of a buffer with data
+        // of a (possibly) different length and verifies that the
+        // incrementally updated checksum field matches the one
+        // calculated over the new buffer.
+
+        static constexpr uint16_t kSize    = 80;
+        static constexpr uint16_t kMaxData = 16;
+
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+
+        printf("\nTestAdjustChecksum\n");
+
+        VerifyOrQuit(instance != nullptr);
+
+        for (uint16_t iter = 0; iter < 10000; iter++)
+        {
+            uint8_t  oldBytes[kSize];
+            uint8_t  newBytes[kSize + kMaxData];
+            uint8_t  newData[kMaxData];
+            uint16_t offset    = 2 * Random::NonCrypto::GenerateUpToExcluding<uint16_t>((kSize - kMaxData) / 2);
+            uint16_t oldLength = 2 * Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kMaxData / 2 + 1);
+            uint16_t newLength = 2 * Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kMaxData / 2 + 1);
+            uint16_t newSize   = kSize - oldLength + newLength;
+            uint16_t oldChecksum;
+            uint16_t newChecksum;
+            Checksum checksum;
+
+            Random::NonCrypto::Fill(oldBytes);
+            Random::NonCrypto::Fill(newData);
+
+            memcpy(newBytes, oldBytes, offset);
+            memcpy(&newBytes[offset], newData, newLength);
+            memcpy(&newBytes[offset + newLength], &oldBytes[offset + oldLength], kSize - offset - oldLength);
+
+            checksum.AddData(oldBytes, kSize);
+            oldChecksum = Checksum::ToFieldValue(checksum.GetValue());
+
+            checksum = Checksum();
+            checksum.AddData(newBytes, newSize);
+            newChecksum = Checksum::ToFieldValue(checksum.GetValue());
+
+            VerifyOrQuit(Checksum::AdjustChecksum(oldChecksum, &oldBytes[offset], oldLength, newData, newLength) ==
+                         newChecksum);
+
+            if ((oldLength == sizeof(uint16_t)) && (newLength == sizeof(uint16_t)))
+            {
+                VerifyOrQuit(Checksum::AdjustChecksum(oldChecksum, BigEndian::ReadUint16(&oldBytes[offset]),
+                                                      BigEndian::ReadUint16(newData)) == newChecksum);
+            }
+        }
+
+        testFreeInstance(instance);
+    }
+
 };
 
 #if OPENTHREAD_CONFIG_VERHOEFF_CHECKSUM_ENABLE
@@ -530,6 +637,8 @@ void TestVerhoeffChecksum(void)
 int main(void)
 {
     ot::ChecksumTester::TestExampleVector();
+    ot::ChecksumTester::TestAddData();
+    ot::ChecksumTester::TestAdjustChecksum();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
     ot::TestTcp4MessageChecksum();
@@ -27,6 +27,9 @@
  */
 
 #include "common/crc.hpp"
+#include "common/message.hpp"
+#include "common/random.hpp"
+#include "instance/instance.hpp"
 
 #include "test_platform.h"
 #include "test_util.hpp"
@@ -105,12 +108,91 @@ void TestCrc32(void)
     }
 }
 
+
+template <typename UintType>
+UintType CalculateBitwiseCrc(UintType aPolynomial, const uint8_t *aBytes, uint16_t aLength)
+{
+    // Reference bit-wise CRC computation.
+
+    static constexpr uint8_t  kBitShift = (sizeof(UintType) - 1) * 8;
+    static constexpr UintType kMsb      = static_cast<UintType>(1u << (sizeof(UintType) * 8 - 1));
+
+    UintType crc = 0;
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        crc ^= static_cast<UintType>(aBytes[i]) << kBitShift;
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & kMsb) ? static_cast<UintType>((crc << 1) ^ aPolynomial) : static_cast<UintType>(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+void TestCrcFeed(void)
+{
+    // `kOtherPolynomial` (CRC16-DNP) has no generated table and
+    // checks the bit-wise fallback.
+
+    static constexpr uint16_t kMaxSize         = Buffer::kSize * 3 + 24;
+    static constexpr uint16_t kOtherPolynomial = 0x3d65;
+
+    Instance *instance = static_cast<Instance *>(testInitInstance());
+    Message  *message;
+    uint8_t   bytes[kMaxSize];
+
+    printf("\nTestCrcFeed (slices: %u)\n", OPENTHREAD_CONFIG_CRC_TABLE_SLICES);
+
+    VerifyOrQuit(instance != nullptr);
+
+    Random::NonCrypto::Fill(bytes);
+
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeOther);
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->AppendBytes(bytes, sizeof(bytes)));
+
+    for (uint16_t offset = 0; offset < 4; offset++)
+    {
+        for (uint16_t length = 0; offset + length <= kMaxSize; length++)
+        {
+            CrcCalculator<uint16_t> ccitt(kCrc16CcittPolynomial);
+            CrcCalculator<uint16_t> ansi(kCrc16AnsiPolynomial);
+            CrcCalculator<uint32_t> crc32(kCrc32AnsiPolynomial);
+            CrcCalculator<uint16_t> other(kOtherPolynomial);
+            OffsetRange             offsetRange;
+            uint16_t                ccittCrc = CalculateBitwiseCrc(kCrc16CcittPolynomial, &bytes[offset], length);
+            uint16_t                ansiCrc  = CalculateBitwiseCrc(kCrc16AnsiPolynomial, &bytes[offset], length);
+            uint32_t                crc32Crc = CalculateBitwiseCrc(kCrc32AnsiPolynomial, &bytes[offset], length);
+            uint16_t                otherCrc = CalculateBitwiseCrc(kOtherPolynomial, &bytes[offset], length);
+
+            VerifyOrQuit(ccitt.FeedBytes(&bytes[offset], length) == ccittCrc);
+            VerifyOrQuit(ansi.FeedBytes(&bytes[offset], length) == ansiCrc);
+            VerifyOrQuit(crc32.FeedBytes(&bytes[offset], length) == crc32Crc);
+            VerifyOrQuit(other.FeedBytes(&bytes[offset], length) == otherCrc);
+
+            offsetRange.Init(offset, length);
+
+            VerifyOrQuit(CrcCalculator<uint16_t>(kCrc16CcittPolynomial).Feed(*message, offsetRange) == ccittCrc);
+            VerifyOrQuit(CrcCalculator<uint16_t>(kCrc16AnsiPolynomial).Feed(*message, offsetRange) == ansiCrc);
+            VerifyOrQuit(CrcCalculator<uint32_t>(kCrc32AnsiPolynomial).Feed(*message, offsetRange) == crc32Crc);
+            VerifyOrQuit(CrcCalculator<uint16_t>(kOtherPolynomial).Feed(*message, offsetRange) == otherCrc);
+        }
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestCrc16();
     ot::TestCrc32();
+    ot::TestCrcFeed();
     printf("All tests passed\n");
     return 0;
 }
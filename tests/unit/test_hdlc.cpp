@@ -586,6 +586,44 @@ void TestEncoderDecoder(void)
     decoder.Decode(&byte, sizeof(uint8_t));
     VerifyOrQuit(!decoderContext.mWasCalled);
 
+    // Test `Decoder` with a frame larger than the decoder buffer and ensure the next frame is decoded.
+
+    {
+        Spinel::FrameBuffer<sizeof(sOpenThreadText)> smallBuffer;
+
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(sMottoText, sizeof(sMottoText) - 1));
+        SuccessOrQuit(encoder.EndFrame());
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(sHelloText, sizeof(sHelloText) - 1));
+        SuccessOrQuit(encoder.EndFrame());
+
+        decoder.Init(smallBuffer, ProcessDecodedFrame, &decoderContext);
+
+        frame  = encoderBuffer.GetFrame();
+        length = encoderBuffer.GetLength();
+
+        decoderContext.mWasCalled = false;
+
+        do
+        {
+            decoder.Decode(frame++, sizeof(uint8_t));
+            length--;
+        } while (!decoderContext.mWasCalled && (length > 0));
+
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NO_BUFS, "Decoder::Decode() did not fail with full buffer");
+
+        smallBuffer.Clear();
+        decoderContext.mWasCalled = false;
+        decoder.Decode(frame, length);
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE);
+        VerifyOrQuit(smallBuffer.GetLength() == sizeof(sHelloText) - 1);
+        VerifyOrQuit(memcmp(smallBuffer.GetFrame(), sHelloText, smallBuffer.GetLength()) == 0);
+    }
+
     printf(" -- PASS\n");
 }
 
@@ -640,6 +678,100 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+uint16_t CalculateBitwiseFcs(const uint8_t *aData, uint16_t aLength)
+{
+    // Reference bit-wise FCS computation (RFC 1662).
+
+    static constexpr uint16_t kFcsPolynomial = 0x8408;
+
+    uint16_t fcs = 0xffff;
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        fcs ^= aData[i];
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            fcs = (fcs & 1) ? static_cast<uint16_t>((fcs >> 1) ^ kFcsPolynomial) : static_cast<uint16_t>(fcs >> 1);
+        }
+    }
+
+    return fcs ^ 0xffff;
+}
+
+void TestEncoderFcs(void)
+{
+    // Checks the FCS appended by `Encoder` against the bit-wise
+    // reference for random data of all lengths (up to 70 bytes) and
+    // start offsets, so that both the slice and the remaining bytes
+    // are covered when `HDLC_FCS_SLICES` is set.
+
+    static constexpr uint16_t kMaxLength = 70;
+    static constexpr uint16_t kMaxOffset = 8;
+
+    uint8_t                          data[kMaxOffset + kMaxLength];
+    Spinel::FrameBuffer<kBufferSize> encoderBuffer;
+    Spinel::FrameBuffer<kBufferSize> decoderBuffer;
+    DecoderContext                   decoderContext;
+    Hdlc::Encoder                    encoder(encoderBuffer);
+    Hdlc::Decoder                    decoder;
+
+    printf("Testing Hdlc::Encoder FCS against bit-wise computation");
+
+    decoder.Init(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+    for (uint8_t &byte : data)
+    {
+        byte = static_cast<uint8_t>(GetRandom(256));
+    }
+
+    for (uint16_t offset = 0; offset < kMaxOffset; offset++)
+    {
+        for (uint16_t length = 0; length <= kMaxLength; length++)
+        {
+            const uint8_t *frame;
+            uint16_t       frameLength;
+            uint8_t        unescaped[2 * kMaxLength + 4];
+            uint16_t       unescapedLength = 0;
+            uint16_t       fcs;
+
+            encoderBuffer.Clear();
+            decoderBuffer.Clear();
+
+            SuccessOrQuit(encoder.BeginFrame());
+            SuccessOrQuit(encoder.Encode(&data[offset], length));
+            SuccessOrQuit(encoder.EndFrame());
+
+            frame       = encoderBuffer.GetFrame();
+            frameLength = encoderBuffer.GetLength();
+
+            VerifyOrQuit(frame[0] == kFlagSequence);
+            VerifyOrQuit(frame[frameLength - 1] == kFlagSequence);
+
+            for (uint16_t i = 1; i < frameLength - 1; i++)
+            {
+                unescaped[unescapedLength++] = (frame[i] == kEscapeSequence) ? (frame[++i] ^ 0x20) : frame[i];
+            }
+
+            VerifyOrQuit(unescapedLength == length + sizeof(uint16_t));
+            VerifyOrQuit(memcmp(unescaped, &data[offset], length) == 0);
+
+            fcs = static_cast<uint16_t>(unescaped[length] | (unescaped[length + 1] << 8));
+            VerifyOrQuit(fcs == CalculateBitwiseFcs(&data[offset], length), "Encoder FCS does not match");
+
+            // The decoder checks the FCS over the same bytes.
+
+            decoderContext.mWasCalled = false;
+            decoder.Decode(frame, frameLength);
+            VerifyOrQuit(decoderContext.mWasCalled);
+            VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE);
+            VerifyOrQuit(decoderBuffer.GetLength() == length);
+        }
+    }
+
+    printf(" -- PASS\n");
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -649,6 +781,7 @@ int main(void)
     ot::Ncp::TestSpinelMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestEncoderFcs();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -0,0 +1,234 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/code_utils.hpp"
+#include "instance/instance.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD
+
+class UnitTester
+{
+public:
+    static void TestIndirectSenderQueueHead(void);
+
+private:
+    static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+    static constexpr uint16_t kMaxMessages = 256;
+
+    static void     AddChildren(Instance &aInstance, uint16_t aNumChildren);
+    static Message *NewQueuedMessage(Instance &aInstance, Message::Priority aPriority);
+    static void     ClearQueue(Instance &aInstance);
+    static void     VerifyQueueHeads(Instance &aInstance);
+
+    static const Message *FindByScan(Instance &aInstance, const Child &aChild)
+    {
+        // Reference lookup scanning the entire send queue.
+
+        const Message *match      = nullptr;
+        uint16_t       childIndex = aInstance.Get<ChildTable>().GetChildIndex(aChild);
+
+        for (const Message &message : aInstance.Get<MeshForwarder>().mSendQueue)
+        {
+            if (message.GetIndirectTxChildMask().Has(childIndex))
+            {
+                match = &message;
+                break;
+            }
+        }
+
+        return match;
+    }
+};
+
+void UnitTester::AddChildren(Instance &aInstance, uint16_t aNumChildren)
+{
+    ChildTable &childTable = aInstance.Get<ChildTable>();
+
+    childTable.Clear();
+
+    for (uint16_t i = 0; i < aNumChildren; i++)
+    {
+        Child *child = childTable.GetNewChild();
+
+        VerifyOrQuit(child != nullptr);
+        child->SetState(Neighbor::kStateValid);
+        child->SetRloc16(0x1001 + i);
+        child->SetDeviceMode(Mle::DeviceMode(0));
+    }
+}
+
+Message *UnitTester::NewQueuedMessage(Instance &aInstance, Message::Priority aPriority)
+{
+    Message *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6, 0, Message::Settings(aPriority));
+
+    if (message != nullptr)
+    {
+        SuccessOrQuit(message->SetLength(40));
+        aInstance.Get<MeshForwarder>().mSendQueue.Enqueue(*message);
+    }
+
+    return message;
+}
+
+void UnitTester::ClearQueue(Instance &aInstance)
+{
+    for (Child &child : aInstance.Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        aInstance.Get<MeshForwarder>().mIndirectSender.ClearAllMessagesForSleepyChild(child);
+    }
+
+    VerifyOrQuit(aInstance.Get<MeshForwarder>().mSendQueue.GetHead() == nullptr);
+}
+
+void UnitTester::VerifyQueueHeads(Instance &aInstance)
+{
+    IndirectSender &indirectSender = aInstance.Get<MeshForwarder>().mIndirectSender;
+
+    for (Child &child : aInstance.Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        const Message *expected = FindByScan(aInstance, child);
+
+        VerifyOrQuit(child.GetIndirectQueueHead() == expected);
+        VerifyOrQuit(indirectSender.FindQueuedMessageForSleepyChild(child, IndirectSender::AcceptAnyMessage) ==
+                     expected);
+        VerifyOrQuit((expected == nullptr) == (child.GetIndirectMessageCount() == 0));
+    }
+}
+
+void UnitTester::TestIndirectSenderQueueHead(void)
+{
+    static const Message::Priority kPriorities[] = {
+        Message::kPriorityLow,
+        Message::kPriorityNormal,
+        Message::kPriorityHigh,
+        Message::kPriorityNet,
+    };
+
+    Instance       *instance = static_cast<Instance *>(testInitInstance());
+    IndirectSender *indirectSender;
+    ChildTable     *childTable;
+    Message        *messages[kMaxMessages];
+    uint16_t        numMessages = 0;
+
+    VerifyOrQuit(instance != nullptr);
+
+    indirectSender = &instance->Get<MeshForwarder>().mIndirectSender;
+    childTable     = &instance->Get<ChildTable>();
+
+    AddChildren(*instance, kMaxChildren);
+
+    srand(0);
+
+    for (uint16_t iter = 0; iter < 4000; iter++)
+    {
+        uint16_t childIndex = static_cast<uint16_t>(rand()) % kMaxChildren;
+        Child   &child      = *childTable->GetChildAtIndex(childIndex);
+
+        switch (rand() % 4)
+        {
+        case 0:
+        case 1:
+        {
+            // Queue a new message of a random priority for the child.
+
+            Message *message;
+
+            VerifyOrExit(numMessages < kMaxMessages);
+            message = NewQueuedMessage(*instance, kPriorities[rand() % GetArrayLength(kPriorities)]);
+            VerifyOrExit(message != nullptr);
+
+            messages[numMessages++] = message;
+            indirectSender->AddMessageForSleepyChild(*message, child);
+            break;
+        }
+
+        case 2:
+            // Add an already queued message (possibly ahead of the
+            // child's current queue head) for the child.
+
+            VerifyOrExit(numMessages > 0);
+            indirectSender->AddMessageForSleepyChild(*messages[static_cast<uint16_t>(rand()) % numMessages], child);
+            break;
+
+        case 3:
+        {
+            // Remove a random queued message from the child, freeing
+            // it if no other child needs it.
+
+            Message *message;
+            uint16_t index;
+
+            VerifyOrExit(numMessages > 0);
+            index   = static_cast<uint16_t>(rand()) % numMessages;
+            message = messages[index];
+
+            IgnoreError(indirectSender->RemoveMessageFromSleepyChild(*message, child));
+
+            if (instance->Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message))
+            {
+                messages[index] = messages[--numMessages];
+            }
+
+            break;
+        }
+        }
+
+    exit:
+        VerifyQueueHeads(*instance);
+    }
+
+    ClearQueue(*instance);
+    VerifyQueueHeads(*instance);
+
+    testFreeInstance(instance);
+
+    printf("TestIndirectSenderQueueHead passed\n");
+}
+
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    ot::UnitTester::TestIndirectSenderQueueHead();
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,181 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include <openthread/config.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "common/code_utils.hpp"
+#include "instance/instance.hpp"
+#include "thread/key_manager.hpp"
+
+namespace ot {
+
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+
+static Mle::Key GetMleKeyFor(KeyManager &aKeyManager, uint32_t aKeySequence)
+{
+    // Gets the MLE key of `aKeySequence` by making it the current key
+    // sequence, then restores the original key sequence.
+
+    uint32_t keySequence;
+    Mle::Key key;
+
+    keySequence = aKeyManager.GetCurrentKeySequence();
+    aKeyManager.SetCurrentKeySequence(aKeySequence, KeyManager::kForceUpdate);
+    key = aKeyManager.GetCurrentMleKey().GetKey();
+    aKeyManager.SetCurrentKeySequence(keySequence, KeyManager::kForceUpdate);
+
+    return key;
+}
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+static Mac::Key GetTrelKeyFor(KeyManager &aKeyManager, uint32_t aKeySequence)
+{
+    uint32_t keySequence;
+    Mac::Key key;
+
+    keySequence = aKeyManager.GetCurrentKeySequence();
+    aKeyManager.SetCurrentKeySequence(aKeySequence, KeyManager::kForceUpdate);
+    key = aKeyManager.GetCurrentTrelMacKey().GetKey();
+    aKeyManager.SetCurrentKeySequence(keySequence, KeyManager::kForceUpdate);
+
+    return key;
+}
+#endif
+
+void TestKeyManagerAdjacentKeyCache(void)
+{
+    static constexpr uint32_t kKeySequence = 10;
+
+    Instance  *instance;
+    NetworkKey networkKey;
+    Mle::Key   prevMleKey;
+    Mle::Key   nextMleKey;
+    Mle::Key   otherMleKey;
+    uint32_t   numLookups = 0;
+
+    printf("TestKeyManagerAdjacentKeyCache\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    {
+        KeyManager &keyManager = instance->Get<KeyManager>();
+
+        for (uint8_t i = 0; i < NetworkKey::kSize; i++)
+        {
+            networkKey.m8[i] = i;
+        }
+
+        keyManager.SetNetworkKey(networkKey);
+        keyManager.SetCurrentKeySequence(kKeySequence, KeyManager::kForceUpdate);
+
+        prevMleKey  = GetMleKeyFor(keyManager, kKeySequence - 1);
+        nextMleKey  = GetMleKeyFor(keyManager, kKeySequence + 1);
+        otherMleKey = GetMleKeyFor(keyManager, kKeySequence + 5);
+
+        VerifyOrQuit(prevMleKey != nextMleKey);
+        VerifyOrQuit(keyManager.GetCurrentKeySequence() == kKeySequence);
+
+        keyManager.ResetKeyCacheCounters();
+
+        // The adjacent keys are computed once and then served from the cache.
+
+        for (uint8_t i = 0; i < 3; i++)
+        {
+            VerifyOrQuit(keyManager.GetTemporaryMleKey(kKeySequence - 1).GetKey() == prevMleKey);
+            VerifyOrQuit(keyManager.GetTemporaryMleKey(kKeySequence + 1).GetKey() == nextMleKey);
+            numLookups += 2;
+        }
+
+        VerifyOrQuit(keyManager.GetKeyCacheCounters().mHits + keyManager.GetKeyCacheCounters().mMisses == numLookups);
+        VerifyOrQuit(keyManager.GetKeyCacheCounters().mMisses <= 2);
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+        // The adjacent keys are already computed for the radio when
+        // the key sequence is set.
+        VerifyOrQuit(keyManager.GetKeyCacheCounters().mMisses == 0);
+#endif
+
+        // Other key sequences are not cached.
+
+        keyManager.ResetKeyCacheCounters();
+        VerifyOrQuit(keyManager.GetTemporaryMleKey(kKeySequence + 5).GetKey() == otherMleKey);
+        VerifyOrQuit(keyManager.GetKeyCacheCounters().mHits == 0);
+        VerifyOrQuit(keyManager.GetKeyCacheCounters().mMisses == 0);
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+        {
+            Mac::Key prevTrelKey = GetTrelKeyFor(keyManager, kKeySequence - 1);
+
+            keyManager.ResetKeyCacheCounters();
+            VerifyOrQuit(keyManager.GetTemporaryTrelMacKey(kKeySequence - 1).GetKey() == prevTrelKey);
+            VerifyOrQuit(keyManager.GetTemporaryTrelMacKey(kKeySequence - 1).GetKey() == prevTrelKey);
+            VerifyOrQuit(keyManager.GetKeyCacheCounters().mMisses == 1);
+            VerifyOrQuit(keyManager.GetKeyCacheCounters().mHits == 1);
+        }
+#endif
+
+        // Changing the key sequence moves the cache along.
+
+        keyManager.SetCurrentKeySequence(kKeySequence + 2, KeyManager::kForceUpdate);
+        VerifyOrQuit(keyManager.GetTemporaryMleKey(kKeySequence + 1).GetKey() == nextMleKey);
+        VerifyOrQuit(keyManager.GetTemporaryMleKey(kKeySequence + 3).GetKey() ==
+                     GetMleKeyFor(keyManager, kKeySequence + 3));
+
+        // Changing the network key invalidates the cache.
+
+        networkKey.m8[0] ^= 0xff;
+        keyManager.SetNetworkKey(networkKey);
+        keyManager.SetCurrentKeySequence(kKeySequence, KeyManager::kForceUpdate);
+
+        VerifyOrQuit(keyManager.GetTemporaryMleKey(kKeySequence - 1).GetKey() != prevMleKey);
+        VerifyOrQuit(keyManager.GetTemporaryMleKey(kKeySequence - 1).GetKey() ==
+                     GetMleKeyFor(keyManager, kKeySequence - 1));
+    }
+
+    testFreeInstance(instance);
+}
+
+#endif // !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    ot::TestKeyManagerAdjacentKeyCache();
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
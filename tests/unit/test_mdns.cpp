@@ -1761,7 +1761,7 @@ uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
 //----------------------------------------------------------------------------------------------------------------------
 // Heap allocation
 
-Array<void *, 500> sHeapAllocatedPtrs;
+Array<void *, 2000> sHeapAllocatedPtrs;
 
 #if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 
@@ -9008,6 +9008,261 @@ void TestLegacyUnicastResponse(void)
     testFreeInstance(sInstance);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+
+void TestQueryNameLookup(void)
+{
+    // Validates looking up hosts, services and service types by the
+    // name in a received query. More services are registered than
+    // there are buckets in the name indexes so that entries share
+    // buckets. Query names use a different letter case than the
+    // registered names. Unregistered and renamed entries are no longer
+    // found.
+
+    static constexpr uint16_t kNumServices     = 40;
+    static constexpr uint16_t kNumServiceTypes = 5;
+    static constexpr uint16_t kLabelSize       = 16;
+
+    Core             *mdns = InitTest();
+    Core::Host        hosts[2];
+    Core::Service     services[kNumServices];
+    Core::Service     renamedService;
+    Ip6::Address      hostAddresses[2];
+    char              instanceLabels[kNumServices][kLabelSize];
+    char              serviceTypes[kNumServiceTypes][kLabelSize];
+    const DnsMessage *dnsMsg;
+    uint16_t          heapAllocations;
+
+    Log("-------------------------------------------------------------------------------------------");
+    Log("TestQueryNameLookup");
+
+    AdvanceTime(1);
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+    SuccessOrQuit(mdns->SetEnabled(true, kInfraIfIndex));
+
+    SuccessOrQuit(hostAddresses[0].FromString("fd00::1:aaaa"));
+    SuccessOrQuit(hostAddresses[1].FromString("fd00::2:bbbb"));
+
+    for (uint16_t index = 0; index < GetArrayLength(hosts); index++)
+    {
+        ClearAllBytes(hosts[index]);
+        hosts[index].mHostName        = (index == 0) ? "hostA" : "hostB";
+        hosts[index].mAddresses       = &hostAddresses[index];
+        hosts[index].mAddressesLength = 1;
+        hosts[index].mTtl             = 1500;
+    }
+
+    for (uint16_t index = 0; index < kNumServiceTypes; index++)
+    {
+        snprintf(serviceTypes[index], kLabelSize, "_t%u._udp", index);
+    }
+
+    for (uint16_t index = 0; index < kNumServices; index++)
+    {
+        snprintf(instanceLabels[index], kLabelSize, "inst%u", index);
+
+        ClearAllBytes(services[index]);
+        services[index].mHostName        = hosts[index % 2].mHostName;
+        services[index].mServiceInstance = instanceLabels[index];
+        services[index].mServiceType     = serviceTypes[index % kNumServiceTypes];
+        services[index].mTxtData         = kTxtData1;
+        services[index].mTxtDataLength   = sizeof(kTxtData1);
+        services[index].mPort            = 1000 + index;
+        services[index].mTtl             = 1500;
+    }
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Register 2 hosts and %u services", kNumServices);
+
+    for (Core::Host &host : hosts)
+    {
+        SuccessOrQuit(mdns->RegisterHost(host, 0, nullptr));
+    }
+
+    for (Core::Service &service : services)
+    {
+        SuccessOrQuit(mdns->RegisterService(service, 0, nullptr));
+    }
+
+    // Let probes and announcements finish.
+    AdvanceTime(20000);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Query SRV of every service using upper-case names");
+
+    for (uint16_t index = 0; index < kNumServices; index++)
+    {
+        DnsNameString name;
+
+        name.Append("INST%u._T%u._UDP.LOCAL.", index, index % kNumServiceTypes);
+
+        sDnsMessages.Clear();
+        SendQuery(name.AsCString(), ResourceRecord::kTypeSrv);
+        AdvanceTime(200);
+
+        dnsMsg = sDnsMessages.GetHead();
+        VerifyOrQuit(dnsMsg != nullptr);
+        VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+
+        VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() == 1);
+        dnsMsg->Validate(services[index], kInAnswerSection, kCheckSrv);
+        dnsMsg->Validate(hosts[index % 2], kInAdditionalSection);
+    }
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Query AAAA of the hosts using mixed-case names");
+
+    // Wait so that the AAAA records (included in the SRV responses)
+    // were not multicast within the last second.
+
+    AdvanceTime(2000);
+
+    sDnsMessages.Clear();
+    SendQuery("HoStA.local.", ResourceRecord::kTypeAaaa);
+    SendQuery("hOsTb.LoCaL.", ResourceRecord::kTypeAaaa);
+    AdvanceTime(200);
+
+    dnsMsg = sDnsMessages.GetHead();
+    VerifyOrQuit(dnsMsg != nullptr);
+    VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+
+    VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() == 2);
+    dnsMsg->Validate(hosts[0], kInAnswerSection);
+    dnsMsg->Validate(hosts[1], kInAnswerSection);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Browse every service type using upper-case names");
+
+    for (uint16_t typeIndex = 0; typeIndex < kNumServiceTypes; typeIndex++)
+    {
+        DnsNameString name;
+
+        name.Append("_T%u._UDP.local.", typeIndex);
+
+        sDnsMessages.Clear();
+        SendQuery(name.AsCString(), ResourceRecord::kTypePtr);
+        AdvanceTime(200);
+
+        dnsMsg = sDnsMessages.GetHead();
+        VerifyOrQuit(dnsMsg != nullptr);
+        VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+
+        VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() == kNumServices / kNumServiceTypes);
+
+        for (uint16_t index = typeIndex; index < kNumServices; index += kNumServiceTypes)
+        {
+            dnsMsg->Validate(services[index], kInAnswerSection, kCheckPtr);
+        }
+    }
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Query a name that is not registered and a registered instance with a different type");
+
+    AdvanceTime(2000);
+
+    sDnsMessages.Clear();
+    SendQuery("inst40._t0._udp.local.", ResourceRecord::kTypeSrv);
+    SendQuery("inst1._t0._udp.local.", ResourceRecord::kTypeSrv);
+    SendQuery("_t5._udp.local.", ResourceRecord::kTypePtr);
+    SendQuery("hostC.local.", ResourceRecord::kTypeAaaa);
+    AdvanceTime(2000);
+    VerifyOrQuit(sDnsMessages.IsEmpty());
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Rename `inst7` by unregistering it and registering `Renamed7` with the same type");
+
+    renamedService                  = services[7];
+    renamedService.mServiceInstance = "Renamed7";
+
+    SuccessOrQuit(mdns->UnregisterService(services[7]));
+    SuccessOrQuit(mdns->RegisterService(renamedService, 0, nullptr));
+
+    AdvanceTime(20000);
+
+    sDnsMessages.Clear();
+    SendQuery("inst7._t2._udp.local.", ResourceRecord::kTypeSrv);
+    AdvanceTime(2000);
+    VerifyOrQuit(sDnsMessages.IsEmpty());
+
+    sDnsMessages.Clear();
+    SendQuery("RENAMED7._t2._udp.local.", ResourceRecord::kTypeSrv);
+    AdvanceTime(200);
+
+    dnsMsg = sDnsMessages.GetHead();
+    VerifyOrQuit(dnsMsg != nullptr);
+    VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+    VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() == 1);
+    dnsMsg->Validate(renamedService, kInAnswerSection, kCheckSrv);
+
+    sDnsMessages.Clear();
+    SendQuery("_t2._udp.local.", ResourceRecord::kTypePtr);
+    AdvanceTime(200);
+
+    dnsMsg = sDnsMessages.GetHead();
+    VerifyOrQuit(dnsMsg != nullptr);
+    VerifyOrQuit(dnsMsg->GetNext() == nullptr);
+    VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() == kNumServices / kNumServiceTypes);
+    dnsMsg->Validate(renamedService, kInAnswerSection, kCheckPtr);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Unregister all services of type `_t3._udp` and validate they are no longer found");
+
+    for (uint16_t index = 3; index < kNumServices; index += kNumServiceTypes)
+    {
+        SuccessOrQuit(mdns->UnregisterService(services[index]));
+    }
+
+    AdvanceTime(20000);
+
+    sDnsMessages.Clear();
+    SendQuery("_T3._udp.local.", ResourceRecord::kTypePtr);
+    SendQuery("inst3._t3._udp.local.", ResourceRecord::kTypeSrv);
+    SendQuery("inst38._t3._udp.local.", ResourceRecord::kTypeSrv);
+    AdvanceTime(2000);
+    VerifyOrQuit(sDnsMessages.IsEmpty());
+
+    // Services sharing a bucket with the removed ones are still found.
+
+    sDnsMessages.Clear();
+    SendQuery("inst39._t4._udp.local.", ResourceRecord::kTypeSrv);
+    AdvanceTime(200);
+
+    dnsMsg = sDnsMessages.GetHead();
+    VerifyOrQuit(dnsMsg != nullptr);
+    VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() == 1);
+    dnsMsg->Validate(services[39], kInAnswerSection, kCheckSrv);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Unregister `hostB` and validate it is no longer found");
+
+    SuccessOrQuit(mdns->UnregisterHost(hosts[1]));
+
+    AdvanceTime(20000);
+
+    sDnsMessages.Clear();
+    SendQuery("HOSTB.local.", ResourceRecord::kTypeAaaa);
+    AdvanceTime(2000);
+    VerifyOrQuit(sDnsMessages.IsEmpty());
+
+    sDnsMessages.Clear();
+    SendQuery("HOSTA.local.", ResourceRecord::kTypeAaaa);
+    AdvanceTime(200);
+
+    dnsMsg = sDnsMessages.GetHead();
+    VerifyOrQuit(dnsMsg != nullptr);
+    VerifyOrQuit(dnsMsg->mHeader.GetAnswerCount() == 1);
+    dnsMsg->Validate(hosts[0], kInAnswerSection);
+
+    sDnsMessages.Clear();
+    SuccessOrQuit(mdns->SetEnabled(false, kInfraIfIndex));
+    VerifyOrQuit(sHeapAllocatedPtrs.GetLength() <= heapAllocations);
+
+    Log("End of test");
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace Multicast
 } // namespace Dns
 } // namespace ot
@@ -9041,6 +9296,7 @@ int main(void)
     ot::Dns::Multicast::TestRecordQuerierForAny();
     ot::Dns::Multicast::TestPassiveCache();
     ot::Dns::Multicast::TestLegacyUnicastResponse();
+    ot::Dns::Multicast::TestQueryNameLookup();
 
     printf("All tests passed\n");
 #else
@@ -446,6 +446,94 @@ public:
         message->Free();
         testFreeInstance(instance);
     }
+
+    static void TestRandomAccess(void)
+    {
+        // Verifies reads at scattered offsets interleaved with changes
+        // to the buffer chain (shrinking, growing and prepending) which
+        // must invalidate any cached position in the message.
+
+        static constexpr uint16_t kMaxSize = (Buffer::kSize * 6);
+        static constexpr uint16_t kNumIter = 2000;
+
+        Instance *instance;
+        Message  *message;
+        uint8_t   writeBuffer[kMaxSize];
+        uint8_t   expected[kMaxSize * 2];
+        uint8_t   readBuffer[kMaxSize];
+        uint16_t  length;
+
+        printf("TestRandomAccess()\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        Random::NonCrypto::FillBuffer(writeBuffer, kMaxSize);
+
+        VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6, 0)) != nullptr);
+        SuccessOrQuit(message->AppendBytes(writeBuffer, kMaxSize));
+        memcpy(expected, writeBuffer, kMaxSize);
+        length = kMaxSize;
+
+        for (uint16_t iter = 0; iter < kNumIter; iter++)
+        {
+            uint16_t offset    = Random::NonCrypto::GenerateInClosedRange<uint16_t>(0, length);
+            uint16_t maxRead   = length - offset;
+            uint16_t readSize  = Random::NonCrypto::GenerateInClosedRange<uint16_t>(0, maxRead);
+            uint8_t  operation = Random::NonCrypto::GenerateUpToExcluding<uint8_t>(16);
+
+            SuccessOrQuit(message->Read(offset, readBuffer, readSize));
+            VerifyOrQuit(memcmp(readBuffer, &expected[offset], readSize) == 0);
+            VerifyOrQuit(message->CompareBytes(offset, &expected[offset], readSize));
+
+            switch (operation)
+            {
+            case 0:
+                // Shrink the message (may free buffers).
+                length = Random::NonCrypto::GenerateInClosedRange<uint16_t>(0, length);
+                SuccessOrQuit(message->SetLength(length));
+                break;
+
+            case 1:
+                // Grow the message back to its full size.
+                SuccessOrQuit(message->SetLength(kMaxSize));
+                message->WriteBytes(length, &writeBuffer[length], kMaxSize - length);
+                memcpy(&expected[length], &writeBuffer[length], kMaxSize - length);
+                length = kMaxSize;
+                break;
+
+            case 2:
+                // Prepend bytes (may insert buffers after the head).
+                if (length + kMaxSize / 4 <= kMaxSize)
+                {
+                    SuccessOrQuit(message->PrependBytes(writeBuffer, kMaxSize / 4));
+                    memmove(&expected[kMaxSize / 4], expected, length);
+                    memcpy(expected, writeBuffer, kMaxSize / 4);
+                    length += kMaxSize / 4;
+                }
+                break;
+
+            case 3:
+                // Remove a header (increases the reserved length).
+                if (message->GetReserved() < Buffer::kSize * 2)
+                {
+                    offset = Min<uint16_t>(length, Buffer::kSize + 7);
+                    message->RemoveHeader(offset);
+                    memmove(expected, &expected[offset], length - offset);
+                    length -= offset;
+                }
+                break;
+
+            default:
+                break;
+            }
+
+            VerifyOrQuit(message->GetLength() == length);
+        }
+
+        message->Free();
+        testFreeInstance(instance);
+    }
 };
 
 void TestAppender(void)
@@ -537,6 +625,341 @@ void TestAppender(void)
     testFreeInstance(instance);
 }
 
+void TestMessageReader(void)
+{
+    static constexpr uint16_t kMaxSize     = (Buffer::kSize * 5 + 17);
+    static constexpr uint16_t kOffsetStep  = 37;
+    static constexpr uint16_t kMaxReadSize = 19;
+
+    static const uint16_t kReserveLengths[] = {0, 33, 400};
+
+    Instance *instance;
+    Message  *message;
+    uint8_t   writeBuffer[kMaxSize];
+    uint8_t   readBuffer[kMaxSize];
+
+    printf("TestMessageReader\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMaxSize);
+
+    for (uint16_t reservedLength : kReserveLengths)
+    {
+        VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6, reservedLength)) != nullptr);
+        SuccessOrQuit(message->AppendBytes(writeBuffer, kMaxSize));
+
+        // Read the full range using varying read sizes, alternating
+        // between `ReadBytes()` and `Skip()`.
+
+        for (uint16_t offset = 0; offset <= kMaxSize; offset += kOffsetStep)
+        {
+            for (uint16_t readSize = 1; readSize <= kMaxReadSize; readSize++)
+            {
+                OffsetRange offsetRange;
+                bool        skip = false;
+
+                offsetRange.InitFromRange(offset, kMaxSize);
+
+                MessageReader reader(*message, offsetRange);
+
+                VerifyOrQuit(reader.GetOffset() == offset);
+                VerifyOrQuit(reader.GetRemainingLength() == kMaxSize - offset);
+
+                while (reader.GetRemainingLength() > 0)
+                {
+                    uint16_t readOffset = reader.GetOffset();
+                    uint16_t length     = Min(readSize, reader.GetRemainingLength());
+
+                    if (skip)
+                    {
+                        SuccessOrQuit(reader.Skip(length));
+                    }
+                    else
+                    {
+                        SuccessOrQuit(reader.ReadBytes(readBuffer, length));
+                        VerifyOrQuit(memcmp(readBuffer, &writeBuffer[readOffset], length) == 0);
+                    }
+
+                    VerifyOrQuit(reader.GetOffset() == readOffset + length);
+                    skip = !skip;
+                }
+
+                VerifyOrQuit(reader.GetOffset() == kMaxSize);
+                VerifyOrQuit(reader.ReadBytes(readBuffer, 1) == kErrorParse);
+                VerifyOrQuit(reader.Skip(1) == kErrorParse);
+                SuccessOrQuit(reader.Skip(0));
+            }
+        }
+
+        // Read a sub-range and verify the reader is unchanged on error.
+
+        {
+            OffsetRange offsetRange;
+            uint32_t    value;
+
+            offsetRange.Init(Buffer::kSize - 3, Buffer::kSize + 2);
+
+            {
+                MessageReader reader(*message, offsetRange);
+
+                SuccessOrQuit(reader.Skip(Buffer::kSize));
+                VerifyOrQuit(reader.GetRemainingLength() == 2);
+                VerifyOrQuit(reader.Read(value) == kErrorParse);
+                VerifyOrQuit(reader.GetRemainingLength() == 2);
+                VerifyOrQuit(reader.GetOffset() == offsetRange.GetOffset() + Buffer::kSize);
+                SuccessOrQuit(reader.ReadBytes(readBuffer, 2));
+                VerifyOrQuit(memcmp(readBuffer, &writeBuffer[offsetRange.GetOffset() + Buffer::kSize], 2) == 0);
+                VerifyOrQuit(reader.GetRemainingLength() == 0);
+            }
+
+            // Range past the end of message is limited to message length.
+
+            offsetRange.Init(kMaxSize - 4, 100);
+
+            {
+                MessageReader reader(*message, offsetRange);
+
+                VerifyOrQuit(reader.GetRemainingLength() == 4);
+                SuccessOrQuit(reader.Read(value));
+                VerifyOrQuit(memcmp(&value, &writeBuffer[kMaxSize - 4], sizeof(value)) == 0);
+            }
+
+            offsetRange.Init(kMaxSize + 10, 100);
+
+            {
+                MessageReader reader(*message, offsetRange);
+
+                VerifyOrQuit(reader.GetRemainingLength() == 0);
+                VerifyOrQuit(reader.Read(value) == kErrorParse);
+            }
+        }
+
+        // Reader from message offset to its end.
+
+        message->SetOffset(kMaxSize / 2);
+
+        {
+            MessageReader reader(*message);
+
+            VerifyOrQuit(reader.GetOffset() == kMaxSize / 2);
+            VerifyOrQuit(reader.GetRemainingLength() == kMaxSize - kMaxSize / 2);
+            SuccessOrQuit(reader.ReadBytes(readBuffer, reader.GetRemainingLength()));
+            VerifyOrQuit(memcmp(readBuffer, &writeBuffer[kMaxSize / 2], kMaxSize - kMaxSize / 2) == 0);
+        }
+
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+void TestMessageBufferInfo(void)
+{
+    Instance            *instance;
+    MessagePool         *messagePool;
+    Message             *message;
+    MessageQueue         queue;
+    Instance::BufferInfo info;
+    uint8_t              numBuffers;
+    uint16_t             numAllocated = 0;
+    uint8_t              bytes[Buffer::kSize * 3];
+
+    printf("TestMessageBufferInfo\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool = &instance->Get<MessagePool>();
+
+    memset(bytes, 0xaa, sizeof(bytes));
+
+    instance->ResetBufferInfo();
+    instance->GetBufferInfo(info);
+    VerifyOrQuit(info.mNumAllocFailures == 0);
+    VerifyOrQuit(info.mIp6Messages.mNumBuffers == 0);
+    VerifyOrQuit(info.m6loMessages.mNumBuffers == 0);
+    VerifyOrQuit(info.mOtherMessages.mNumBuffers == 0);
+
+    // Buffers are accounted to the message type as they are added,
+    // moved on `SetType()` and released when freed or shrunk.
+
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+    SuccessOrQuit(message->AppendBytes(bytes, sizeof(bytes)));
+    numBuffers = message->GetBufferCount();
+    VerifyOrQuit(numBuffers > 1);
+
+    instance->GetBufferInfo(info);
+    VerifyOrQuit(info.mIp6Messages.mNumBuffers == numBuffers);
+    VerifyOrQuit(info.mIp6Messages.mMaxUsedBuffers == numBuffers);
+    VerifyOrQuit(info.m6loMessages.mNumBuffers == 0);
+
+    message->SetType(Message::kType6lowpan);
+
+    instance->GetBufferInfo(info);
+    VerifyOrQuit(info.mIp6Messages.mNumBuffers == 0);
+    VerifyOrQuit(info.mIp6Messages.mMaxUsedBuffers == numBuffers);
+    VerifyOrQuit(info.m6loMessages.mNumBuffers == numBuffers);
+    VerifyOrQuit(info.m6loMessages.mMaxUsedBuffers == numBuffers);
+
+    SuccessOrQuit(message->SetLength(0));
+
+    instance->GetBufferInfo(info);
+    VerifyOrQuit(info.m6loMessages.mNumBuffers == 1);
+    VerifyOrQuit(info.m6loMessages.mMaxUsedBuffers == numBuffers);
+
+    message->Free();
+
+    instance->GetBufferInfo(info);
+    VerifyOrQuit(info.m6loMessages.mNumBuffers == 0);
+    VerifyOrQuit(info.mMaxUsedBuffers >= numBuffers);
+
+    // Exhaust the message pool and check the allocation failure counters.
+
+    while ((message = messagePool->Allocate(Message::kTypeOther)) != nullptr)
+    {
+        queue.Enqueue(*message);
+        numAllocated++;
+        VerifyOrQuit(numAllocated <= messagePool->GetTotalBufferCount());
+    }
+
+    instance->GetBufferInfo(info);
+    VerifyOrQuit(info.mOtherMessages.mNumBuffers == numAllocated);
+    VerifyOrQuit(info.mOtherMessages.mMaxUsedBuffers == numAllocated);
+    VerifyOrQuit(info.mOtherMessages.mNumAllocFailures == 1);
+    VerifyOrQuit(info.mIp6Messages.mNumAllocFailures == 0);
+    VerifyOrQuit(info.mNumAllocFailures == 1);
+    VerifyOrQuit(info.mMaxUsedBuffers >= numAllocated);
+
+    queue.DequeueAndFreeAll();
+
+    instance->GetBufferInfo(info);
+    VerifyOrQuit(info.mOtherMessages.mNumBuffers == 0);
+    VerifyOrQuit(info.mOtherMessages.mMaxUsedBuffers == numAllocated);
+
+    instance->ResetBufferInfo();
+    instance->GetBufferInfo(info);
+    VerifyOrQuit(info.mNumAllocFailures == 0);
+    VerifyOrQuit(info.mOtherMessages.mNumAllocFailures == 0);
+    VerifyOrQuit(info.mOtherMessages.mMaxUsedBuffers == 0);
+    VerifyOrQuit(info.mIp6Messages.mMaxUsedBuffers == 0);
+
+    testFreeInstance(instance);
+}
+
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+
+void TestMessageLargeBuffers(void)
+{
+    static constexpr uint16_t kLength         = 1280;
+    static constexpr uint16_t kPrependLength  = 40;
+    static constexpr uint16_t kNumSmallOnly   = kLength / Buffer::kSize;
+    static constexpr uint16_t kNumLargeBuffer = OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS;
+
+    Instance            *instance;
+    MessagePool         *messagePool;
+    Message             *message;
+    MessageQueue         queue;
+    Instance::BufferInfo info;
+    uint16_t             numUsed;
+    uint8_t              writeBuffer[kLength + kPrependLength];
+    uint8_t              readBuffer[kLength + kPrependLength];
+
+    printf("TestMessageLargeBuffers\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    messagePool = &instance->Get<MessagePool>();
+
+    // Large buffers are counted as one buffer in the free and total
+    // buffer counts.
+
+    VerifyOrQuit(messagePool->GetTotalBufferCount() == OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS + kNumLargeBuffer);
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == messagePool->GetTotalBufferCount());
+
+    for (uint16_t i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    for (uint8_t iteration = 0; iteration < 2; iteration++)
+    {
+        // The first `kNumLargeBuffer` messages use large buffers and
+        // so need fewer buffers. Once all large buffers are in use,
+        // the next message falls back to regular buffers. The second
+        // iteration checks that freed large buffers are reused.
+
+        numUsed = 0;
+
+        for (uint16_t i = 0; i <= kNumLargeBuffer; i++)
+        {
+            uint16_t length = kLength;
+
+            VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+            SuccessOrQuit(message->SetLength(kLength));
+            message->WriteBytes(0, &writeBuffer[kPrependLength], kLength);
+
+            if (i < kNumLargeBuffer)
+            {
+                VerifyOrQuit(message->GetBufferCount() < kNumSmallOnly);
+            }
+            else
+            {
+                VerifyOrQuit(message->GetBufferCount() > kNumSmallOnly);
+            }
+
+            if (i % 2 == 0)
+            {
+                SuccessOrQuit(message->PrependBytes(writeBuffer, kPrependLength));
+                length += kPrependLength;
+            }
+
+            VerifyOrQuit(message->GetLength() == length);
+            VerifyOrQuit(message->ReadBytes(0, readBuffer, length) == length);
+            VerifyOrQuit(memcmp(readBuffer, &writeBuffer[kLength + kPrependLength - length], length) == 0);
+            VerifyOrQuit(message->CompareBytes(0, &writeBuffer[kLength + kPrependLength - length], length));
+
+            // Read across the end of the large buffer using small reads at
+            // different offsets.
+
+            for (uint16_t offset = 0; offset + 3 <= length; offset += 37)
+            {
+                SuccessOrQuit(message->Read(offset, readBuffer, 3));
+                VerifyOrQuit(memcmp(readBuffer, &writeBuffer[kLength + kPrependLength - length + offset], 3) == 0);
+            }
+
+            queue.Enqueue(*message);
+
+            numUsed += message->GetBufferCount();
+            VerifyOrQuit(messagePool->GetFreeBufferCount() == messagePool->GetTotalBufferCount() - numUsed);
+            VerifyOrQuit(messagePool->GetMaxUsedBufferCount() >= numUsed);
+        }
+
+        instance->GetBufferInfo(info);
+        VerifyOrQuit(info.mIp6Messages.mNumBuffers == numUsed);
+
+        queue.DequeueAndFreeAll();
+
+        instance->GetBufferInfo(info);
+        VerifyOrQuit(info.mIp6Messages.mNumBuffers == 0);
+        VerifyOrQuit(messagePool->GetFreeBufferCount() == messagePool->GetTotalBufferCount());
+
+        // Shrinking a message releases its large buffer.
+
+        VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+        SuccessOrQuit(message->SetLength(kLength));
+        SuccessOrQuit(message->SetLength(1));
+        VerifyOrQuit(message->GetBufferCount() == 1);
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+
 } // namespace ot
 
 int main(void)
@@ -550,6 +973,12 @@ int main(void)
 
     ot::UnitTester::TestCloning();
     ot::TestAppender();
+    ot::TestMessageReader();
+    ot::UnitTester::TestRandomAccess();
+    ot::TestMessageBufferInfo();
+#if OPENTHREAD_CONFIG_NUM_MESSAGE_LARGE_BUFFERS > 0
+    ot::TestMessageLargeBuffers();
+#endif
 
     printf("All tests passed\n");
     return 0;
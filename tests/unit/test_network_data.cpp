@@ -1065,6 +1065,138 @@ void TestNetworkDataDsnSrpAnycastSeqNumSelection(void)
     testFreeInstance(instance);
 }
 
+void TestNetworkDataRouteLookup(void)
+{
+    struct TestCase
+    {
+        const char *mSource;
+        const char *mDestination;
+        Error       mError;
+        uint16_t    mRloc16;
+    };
+
+    const uint8_t kNetworkData1[] = {
+        // fd00:1::/64 - BR entries 0x1000 (default route) and 0x2000 (high pref, default route)
+        0x03, 0x14, 0x00, 0x40, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, //
+        0x05, 0x08, 0x10, 0x00, 0x33, 0x00, 0x20, 0x00, 0x73, 0x00,             //
+
+        // fd00:2::/64 - BR entry 0x3000 (no default route)
+        0x03, 0x10, 0x00, 0x40, 0xfd, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, //
+        0x05, 0x04, 0x30, 0x00, 0x31, 0x00,                                     //
+
+        // ::/0 - Route entries 0x4000 (med pref) and 0x5000 (low pref)
+        0x03, 0x0a, 0x00, 0x00,                         //
+        0x01, 0x06, 0x40, 0x00, 0x00, 0x50, 0x00, 0xc0, //
+
+        // 2001:db8::/32 - Route entry 0x6000
+        0x03, 0x0b, 0x00, 0x20, 0x20, 0x01, 0x0d, 0xb8, //
+        0x01, 0x03, 0x60, 0x00, 0x00,                   //
+
+        // 2001:db8:1::/48 - Route entry 0x7000 (low pref)
+        0x03, 0x0d, 0x00, 0x30, 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, //
+        0x01, 0x03, 0x70, 0x00, 0xc0,                               //
+
+        // fd00:3::/64 (domain 1) - BR entry 0x8000 (default route)
+        0x03, 0x10, 0x01, 0x40, 0xfd, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, //
+        0x05, 0x04, 0x80, 0x00, 0x33, 0x00,                                     //
+
+        // 2001:db8:2::/48 (domain 1) - Route entry 0x9000
+        0x03, 0x0d, 0x01, 0x30, 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x02, //
+        0x01, 0x03, 0x90, 0x00, 0x00,                               //
+
+        // fd00:4::/64 (domain 2) - BR entries 0xa000 (default route), 0xb000 (high pref, default route)
+        // and 0xc000 (high pref, no default route)
+        0x03, 0x18, 0x02, 0x40, 0xfd, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, //
+        0x05, 0x0c, 0xa0, 0x00, 0x33, 0x00, 0xb0, 0x00, 0x73, 0x00, 0xc0, 0x00, //
+        0x71, 0x00,                                                             //
+    };
+
+    const uint8_t kNetworkData2[] = {
+        // fd00:1::/64 - BR entries 0x1000 (default route) and 0x2000 (high pref, default route)
+        0x03, 0x14, 0x00, 0x40, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, //
+        0x05, 0x08, 0x10, 0x00, 0x33, 0x00, 0x20, 0x00, 0x73, 0x00,             //
+
+        // ::/0 - Route entry 0x5000 (low pref)
+        0x03, 0x07, 0x00, 0x00,       //
+        0x01, 0x03, 0x50, 0x00, 0xc0, //
+    };
+
+    const TestCase kTestCases1[] = {
+        {"fd00:1::1", "2001:db8:1::1", kErrorNone, 0x7000}, // Longest match external route
+        {"fd00:1::1", "2001:db8:5::1", kErrorNone, 0x6000}, //
+        {"fd00:1::1", "2600::1", kErrorNone, 0x4000},       // Higher preference external route
+        {"fd00:2::1", "2001:db8:1::1", kErrorNone, 0x7000}, //
+        {"fd00:3::1", "2001:db8:2::1", kErrorNone, 0x9000}, // External route in domain 1
+        {"fd00:3::1", "2001:db8:1::1", kErrorNone, 0x8000}, // Default route in domain 1
+        {"fd00:4::1", "2600::1", kErrorNone, 0xb000},       // Higher preference default route
+        {"fd00:9::1", "2600::1", kErrorNoRoute, 0},         // Source matches no prefix
+    };
+
+    const TestCase kTestCases2[] = {
+        {"fd00:1::1", "2001:db8:1::1", kErrorNone, 0x5000},
+        {"fd00:3::1", "2001:db8:2::1", kErrorNoRoute, 0},
+    };
+
+    struct TestInfo
+    {
+        const uint8_t  *mNetworkData;
+        uint8_t         mNetworkDataLength;
+        const TestCase *mTestCases;
+        uint8_t         mNumTestCases;
+    };
+
+    const TestInfo kTests[] = {
+        {kNetworkData1, sizeof(kNetworkData1), kTestCases1, GetArrayLength(kTestCases1)},
+        {kNetworkData2, sizeof(kNetworkData2), kTestCases2, GetArrayLength(kTestCases2)},
+    };
+
+    Instance *instance;
+    uint8_t   version = 0;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataRouteLookup()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+
+    for (const TestInfo &test : kTests)
+    {
+        Message    *message = instance->Get<MessagePool>().Allocate(Message::kTypeOther);
+        OffsetRange offsetRange;
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(test.mNetworkData, test.mNetworkDataLength));
+        offsetRange.InitFromMessageFullLength(*message);
+
+        version++;
+        SuccessOrQuit(instance->Get<Leader>().SetNetworkData(version, version, kFullSet, *message, offsetRange));
+        message->Free();
+
+        for (uint8_t index = 0; index < test.mNumTestCases; index++)
+        {
+            const TestCase &testCase = test.mTestCases[index];
+            Ip6::Address    source;
+            Ip6::Address    destination;
+            uint16_t        rloc16 = 0;
+
+            SuccessOrQuit(source.FromString(testCase.mSource));
+            SuccessOrQuit(destination.FromString(testCase.mDestination));
+
+            VerifyOrQuit(instance->Get<Leader>().RouteLookup(source, destination, rloc16) == testCase.mError);
+
+            printf("\n %s -> %s : %s 0x%04x", testCase.mSource, testCase.mDestination, ErrorToString(testCase.mError),
+                   rloc16);
+
+            if (testCase.mError == kErrorNone)
+            {
+                VerifyOrQuit(rloc16 == testCase.mRloc16);
+            }
+        }
+    }
+
+    testFreeInstance(instance);
+}
+
 } // namespace NetworkData
 } // namespace ot
 
@@ -1076,6 +1208,7 @@ int main(void)
 #endif
     ot::NetworkData::TestNetworkDataDsnSrpServices();
     ot::NetworkData::TestNetworkDataDsnSrpAnycastSeqNumSelection();
+    ot::NetworkData::TestNetworkDataRouteLookup();
 
     printf("\nAll tests passed\n");
     return 0;
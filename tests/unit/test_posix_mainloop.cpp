@@ -0,0 +1,385 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "common/code_utils.hpp"
+#include "posix/platform/mainloop.hpp"
+
+namespace ot {
+namespace Posix {
+namespace Mainloop {
+
+// Owns a datagram socket pair whose first socket is watched, the
+// same way `InfraNetif` and `MdnsSocket` own their sockets.
+class TestSource : public Source
+{
+public:
+    TestSource(void)
+        : mWatcher(*this)
+        , mWatcherToStop(nullptr)
+        , mMaxReceivesPerEvent(0)
+        , mNumEvents(0)
+        , mNumReadable(0)
+        , mNumWritable(0)
+        , mNumReceived(0)
+    {
+        mFds[0] = -1;
+        mFds[1] = -1;
+    }
+
+    void Open(void)
+    {
+        VerifyOrQuit(socketpair(AF_UNIX, SOCK_DGRAM, 0, mFds) == 0);
+        mWatcher.Start(mFds[0], kEventReadable);
+    }
+
+    void Close(void)
+    {
+        mWatcher.Stop();
+        close(mFds[0]);
+        close(mFds[1]);
+        mFds[0] = -1;
+        mFds[1] = -1;
+    }
+
+    void Send(void) { VerifyOrQuit(send(mFds[1], "x", 1, 0) == 1); }
+
+    void ResetCounters(void)
+    {
+        mNumEvents   = 0;
+        mNumReadable = 0;
+        mNumWritable = 0;
+        mNumReceived = 0;
+    }
+
+    void HandleFdEvents(FdWatcher &aWatcher, uint32_t aEvents) override
+    {
+        char buffer[16];
+
+        VerifyOrQuit(&aWatcher == &mWatcher);
+        VerifyOrQuit(mWatcher.IsWatching());
+
+        mNumEvents++;
+
+        if (aEvents & kEventWritable)
+        {
+            mNumWritable++;
+        }
+
+        if (aEvents & kEventReadable)
+        {
+            mNumReadable++;
+
+            // Reads all the pending data, or at most
+            // `mMaxReceivesPerEvent` datagrams if it is not zero.
+            for (uint32_t i = 0; (mMaxReceivesPerEvent == 0) || (i < mMaxReceivesPerEvent); i++)
+            {
+                if (recv(mFds[0], buffer, sizeof(buffer), MSG_DONTWAIT) <= 0)
+                {
+                    break;
+                }
+
+                mNumReceived++;
+            }
+        }
+
+        if (mWatcherToStop != nullptr)
+        {
+            mWatcherToStop->Stop();
+        }
+    }
+
+    FdWatcher  mWatcher;
+    FdWatcher *mWatcherToStop;
+    uint32_t   mMaxReceivesPerEvent;
+    int        mFds[2];
+    uint32_t   mNumEvents;
+    uint32_t   mNumReadable;
+    uint32_t   mNumWritable;
+    uint32_t   mNumReceived;
+};
+
+static void RunMainloopIteration(void)
+{
+    Context context;
+
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+    context.mMaxFd           = -1;
+    context.mTimeout.tv_sec  = 0;
+    context.mTimeout.tv_usec = 10000;
+
+    Manager::Get().Update(context);
+
+    if (select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+               &context.mTimeout) < 0)
+    {
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+    }
+
+    Manager::Get().Process(context);
+}
+
+void TestFdWatcherReadable(void)
+{
+    TestSource source;
+
+    printf("\nTestFdWatcherReadable\n");
+
+    source.Open();
+    VerifyOrQuit(source.mWatcher.IsWatching());
+    VerifyOrQuit(source.mWatcher.GetFd() == source.mFds[0]);
+
+    // All the pending data is handled with a single event.
+
+    source.Send();
+    source.Send();
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 1);
+    VerifyOrQuit(source.mNumReceived == 2);
+
+    // No events without new data.
+
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 1);
+
+    source.Send();
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 2);
+    VerifyOrQuit(source.mNumReceived == 3);
+
+    // No events once stopped, until started again.
+
+    source.mWatcher.Stop();
+    VerifyOrQuit(!source.mWatcher.IsWatching());
+    VerifyOrQuit(source.mWatcher.GetFd() == -1);
+
+    source.Send();
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 2);
+
+    source.mWatcher.Start(source.mFds[0], kEventReadable);
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 3);
+    VerifyOrQuit(source.mNumReceived == 4);
+
+    source.Close();
+}
+
+void TestFdWatcherBoundedRead(void)
+{
+    TestSource source;
+
+    printf("\nTestFdWatcherBoundedRead\n");
+
+    // The handler reads at most two datagrams per event. The watcher
+    // reports the socket again on each iteration until all the
+    // pending data is read.
+
+    source.Open();
+    source.mMaxReceivesPerEvent = 2;
+
+    for (int i = 0; i < 5; i++)
+    {
+        source.Send();
+    }
+
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 1);
+    VerifyOrQuit(source.mNumReceived == 2);
+
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 2);
+    VerifyOrQuit(source.mNumReceived == 4);
+
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 3);
+    VerifyOrQuit(source.mNumReceived == 5);
+
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 3);
+
+    source.Close();
+}
+
+void TestFdWatcherReplaceFd(void)
+{
+    TestSource source;
+    int        oldFds[2];
+
+    printf("\nTestFdWatcherReplaceFd\n");
+
+    source.Open();
+
+    // Replace the socket while watched. The new socket may reuse
+    // the fd number of the closed one.
+
+    oldFds[0] = source.mFds[0];
+    oldFds[1] = source.mFds[1];
+    source.mWatcher.Stop();
+    close(oldFds[0]);
+
+    VerifyOrQuit(socketpair(AF_UNIX, SOCK_DGRAM, 0, source.mFds) == 0);
+    close(oldFds[1]);
+    source.mWatcher.Start(source.mFds[0], kEventReadable);
+    VerifyOrQuit(source.mWatcher.GetFd() == source.mFds[0]);
+
+    source.Send();
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumReceived == 1);
+
+    // Replace it again, with a new fd number this time. `Start()`
+    // stops watching the previous fd.
+
+    oldFds[0] = source.mFds[0];
+    oldFds[1] = source.mFds[1];
+    VerifyOrQuit(socketpair(AF_UNIX, SOCK_DGRAM, 0, source.mFds) == 0);
+    source.mWatcher.Start(source.mFds[0], kEventReadable);
+    close(oldFds[0]);
+    close(oldFds[1]);
+
+    source.Send();
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumReceived == 2);
+
+    source.Close();
+}
+
+void TestFdWatcherSetEvents(void)
+{
+    TestSource source;
+
+    printf("\nTestFdWatcherSetEvents\n");
+
+    // A datagram socket is always writable, but this is reported
+    // only while the writable event is watched.
+
+    source.Open();
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 0);
+
+    source.mWatcher.SetEvents(kEventReadable | kEventWritable);
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumWritable == 1);
+    VerifyOrQuit(source.mNumReadable == 0);
+
+    source.mWatcher.SetEvents(kEventReadable);
+    source.ResetCounters();
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 0);
+
+    // An event which is still active is reported on every iteration
+    // while it is watched.
+
+    source.mWatcher.SetEvents(kEventReadable | kEventWritable);
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumWritable == 1);
+
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumWritable == 2);
+
+    // Readable and writable events are reported together.
+
+    source.Send();
+    source.mWatcher.SetEvents(kEventReadable | kEventWritable);
+    source.ResetCounters();
+    RunMainloopIteration();
+    VerifyOrQuit(source.mNumEvents == 1);
+    VerifyOrQuit(source.mNumReadable == 1);
+    VerifyOrQuit(source.mNumWritable == 1);
+    VerifyOrQuit(source.mNumReceived == 1);
+
+    source.Close();
+
+    // Setting the events of a stopped watcher does nothing.
+
+    source.mWatcher.SetEvents(kEventReadable);
+    VerifyOrQuit(!source.mWatcher.IsWatching());
+}
+
+void TestFdWatcherStopFromHandler(void)
+{
+    TestSource source1;
+    TestSource source2;
+
+    printf("\nTestFdWatcherStopFromHandler\n");
+
+    // The handler of `source1` stops the watcher of `source2` while
+    // both have pending events in the same iteration. The stopped
+    // watcher must not be notified.
+
+    source2.Open();
+    source1.Open();
+    source1.mWatcherToStop = &source2.mWatcher;
+
+    source1.Send();
+    source2.Send();
+    RunMainloopIteration();
+
+    VerifyOrQuit(source1.mNumReceived == 1);
+    VerifyOrQuit(source2.mNumEvents == 0);
+    VerifyOrQuit(!source2.mWatcher.IsWatching());
+
+    // A watcher stopping itself.
+
+    source1.mWatcherToStop = &source1.mWatcher;
+    source1.Send();
+    RunMainloopIteration();
+
+    VerifyOrQuit(source1.mNumReceived == 2);
+    VerifyOrQuit(!source1.mWatcher.IsWatching());
+
+    source1.Close();
+    source2.Close();
+}
+
+} // namespace Mainloop
+} // namespace Posix
+} // namespace ot
+
+int main(void)
+{
+    ot::Posix::Mainloop::TestFdWatcherReadable();
+    ot::Posix::Mainloop::TestFdWatcherBoundedRead();
+    ot::Posix::Mainloop::TestFdWatcherReplaceFd();
+    ot::Posix::Mainloop::TestFdWatcherSetEvents();
+    ot::Posix::Mainloop::TestFdWatcherStopFromHandler();
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
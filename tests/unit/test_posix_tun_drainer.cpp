@@ -0,0 +1,237 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include <openthread/platform/time.h>
+
+#include "common/code_utils.hpp"
+#include "common/num_utils.hpp"
+#include "posix/platform/tun_drainer.hpp"
+
+static uint64_t sNow;
+
+uint64_t otPlatTimeGet(void) { return sNow; }
+
+namespace ot {
+namespace Posix {
+
+// Simulates a TUN device with a number of pending packets, and
+// OpenThread with a number of free message buffers (one per packet).
+class FakeTun
+{
+public:
+    static constexpr uint64_t kReadTimeUs = 10;
+
+    void Reset(uint16_t aNumPending, uint16_t aNumBuffers)
+    {
+        mNumPending = aNumPending;
+        mNumBuffers = aNumBuffers;
+        mNumReads   = 0;
+    }
+
+    static TunDrainer::ReadResult HandleRead(void *aContext) { return static_cast<FakeTun *>(aContext)->Read(); }
+
+    uint16_t mNumPending;
+    uint16_t mNumBuffers;
+    uint16_t mNumReads;
+
+private:
+    TunDrainer::ReadResult Read(void)
+    {
+        TunDrainer::ReadResult result = TunDrainer::kReadNone;
+
+        mNumReads++;
+        sNow += kReadTimeUs;
+
+        VerifyOrExit(mNumPending > 0);
+        mNumPending--;
+
+        VerifyOrExit(mNumBuffers > 0, result = TunDrainer::kReadPacketNoBufs);
+        mNumBuffers--;
+
+        result = TunDrainer::kReadPacket;
+
+    exit:
+        return result;
+    }
+};
+
+static void VerifyReadCounters(const TunDrainer &aDrainer,
+                               uint32_t          aReadWakeups,
+                               uint32_t          aReadPackets,
+                               uint32_t          aReadMaxPacketsPerWakeup)
+{
+    const otSysNetifTunCounters &counters = aDrainer.GetCounters();
+
+    printf(" wakeups:%lu, packets:%lu, max-per-wakeup:%lu\n", ToUlong(counters.mReadWakeups),
+           ToUlong(counters.mReadPackets), ToUlong(counters.mReadMaxPacketsPerWakeup));
+
+    VerifyOrQuit(counters.mReadWakeups == aReadWakeups);
+    VerifyOrQuit(counters.mReadPackets == aReadPackets);
+    VerifyOrQuit(counters.mReadMaxPacketsPerWakeup == aReadMaxPacketsPerWakeup);
+}
+
+void TestTunDrainerBatches(void)
+{
+    static constexpr uint16_t kBatchSize = 8;
+
+    TunDrainer drainer(kBatchSize);
+    FakeTun    tun;
+    uint64_t   startTime;
+
+    printf("\nTestTunDrainerBatches\n");
+
+    // Fewer pending packets than the batch size: all are read and
+    // reading stops at the first empty read.
+
+    tun.Reset(/* aNumPending */ 3, /* aNumBuffers */ 100);
+    startTime = sNow;
+    drainer.Drain(FakeTun::HandleRead, &tun);
+
+    VerifyOrQuit(tun.mNumPending == 0);
+    VerifyOrQuit(tun.mNumReads == 4);
+    VerifyReadCounters(drainer, 1, 3, 3);
+    VerifyOrQuit(drainer.GetCounters().mReadTimeUs == sNow - startTime);
+
+    // More pending packets than the batch size: at most a batch is
+    // read per wakeup, the rest is left for the next wakeups.
+
+    tun.Reset(/* aNumPending */ 20, /* aNumBuffers */ 100);
+
+    drainer.Drain(FakeTun::HandleRead, &tun);
+    VerifyOrQuit(tun.mNumPending == 12);
+    VerifyOrQuit(tun.mNumReads == kBatchSize);
+    VerifyReadCounters(drainer, 2, 11, kBatchSize);
+
+    drainer.Drain(FakeTun::HandleRead, &tun);
+    VerifyOrQuit(tun.mNumPending == 4);
+    VerifyReadCounters(drainer, 3, 19, kBatchSize);
+
+    drainer.Drain(FakeTun::HandleRead, &tun);
+    VerifyOrQuit(tun.mNumPending == 0);
+    VerifyReadCounters(drainer, 4, 23, kBatchSize);
+
+    // A wakeup with nothing to read (e.g., a read error) is counted
+    // without any packets.
+
+    tun.Reset(/* aNumPending */ 0, /* aNumBuffers */ 100);
+    drainer.Drain(FakeTun::HandleRead, &tun);
+    VerifyOrQuit(tun.mNumReads == 1);
+    VerifyReadCounters(drainer, 5, 23, kBatchSize);
+
+    VerifyOrQuit(drainer.GetCounters().mReadTimeUs == sNow - startTime);
+}
+
+void TestTunDrainerNoBufs(void)
+{
+    TunDrainer drainer(/* aBatchSize */ 8);
+    FakeTun    tun;
+
+    printf("\nTestTunDrainerNoBufs\n");
+
+    // Reading stops as soon as a packet is dropped due to lack of
+    // message buffers. The dropped packet is still counted as read.
+
+    tun.Reset(/* aNumPending */ 5, /* aNumBuffers */ 2);
+    drainer.Drain(FakeTun::HandleRead, &tun);
+
+    VerifyOrQuit(tun.mNumReads == 3);
+    VerifyOrQuit(tun.mNumPending == 2);
+    VerifyReadCounters(drainer, 1, 3, 3);
+
+    tun.mNumBuffers = 100;
+    drainer.Drain(FakeTun::HandleRead, &tun);
+
+    VerifyOrQuit(tun.mNumPending == 0);
+    VerifyReadCounters(drainer, 2, 5, 3);
+}
+
+void TestTunDrainerSinglePacketBatch(void)
+{
+    TunDrainer drainer(/* aBatchSize */ 1);
+    FakeTun    tun;
+
+    printf("\nTestTunDrainerSinglePacketBatch\n");
+
+    tun.Reset(/* aNumPending */ 3, /* aNumBuffers */ 100);
+
+    for (uint32_t wakeups = 1; wakeups <= 3; wakeups++)
+    {
+        drainer.Drain(FakeTun::HandleRead, &tun);
+        VerifyReadCounters(drainer, wakeups, wakeups, 1);
+    }
+
+    VerifyOrQuit(tun.mNumReads == 3);
+    VerifyOrQuit(tun.mNumPending == 0);
+}
+
+void TestTunDrainerWriteCountersAndReset(void)
+{
+    TunDrainer                   drainer(/* aBatchSize */ 8);
+    FakeTun                      tun;
+    const otSysNetifTunCounters &counters = drainer.GetCounters();
+
+    printf("\nTestTunDrainerWriteCountersAndReset\n");
+
+    drainer.RecordWrite(/* aIsWritten */ true, /* aTimeUs */ 5);
+    drainer.RecordWrite(/* aIsWritten */ true, /* aTimeUs */ 6);
+    drainer.RecordWrite(/* aIsWritten */ false, /* aTimeUs */ 7);
+
+    VerifyOrQuit(counters.mWritePackets == 2);
+    VerifyOrQuit(counters.mWriteTimeUs == 18);
+
+    tun.Reset(/* aNumPending */ 2, /* aNumBuffers */ 100);
+    drainer.Drain(FakeTun::HandleRead, &tun);
+    VerifyReadCounters(drainer, 1, 2, 2);
+
+    drainer.ResetCounters();
+
+    VerifyReadCounters(drainer, 0, 0, 0);
+    VerifyOrQuit(counters.mReadTimeUs == 0);
+    VerifyOrQuit(counters.mWritePackets == 0);
+    VerifyOrQuit(counters.mWriteTimeUs == 0);
+}
+
+} // namespace Posix
+} // namespace ot
+
+int main(void)
+{
+    ot::Posix::TestTunDrainerBatches();
+    ot::Posix::TestTunDrainerNoBufs();
+    ot::Posix::TestTunDrainerSinglePacketBatch();
+    ot::Posix::TestTunDrainerWriteCountersAndReset();
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
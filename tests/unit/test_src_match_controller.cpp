@@ -0,0 +1,658 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include <openthread/config.h>
+
+#include "common/code_utils.hpp"
+#include "instance/instance.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD
+
+static constexpr uint16_t kMaxFakeEntries = 64;
+
+struct FakeSrcMatchEntry
+{
+    bool         mIsShort;
+    uint16_t     mShortAddress;
+    otExtAddress mExtAddress;
+};
+
+static FakeSrcMatchEntry sFakeTable[kMaxFakeEntries];
+static uint16_t          sFakeTableLength;
+static uint16_t          sFakeTableCapacity;
+static bool              sSupportsUpdate;
+static uint16_t          sNumUpdateCalls;
+static uint16_t          sNumPerEntryCalls;
+
+static void ResetFakeTable(bool aSupportsUpdate, uint16_t aCapacity)
+{
+    sFakeTableLength   = 0;
+    sFakeTableCapacity = aCapacity;
+    sSupportsUpdate    = aSupportsUpdate;
+    sNumUpdateCalls    = 0;
+    sNumPerEntryCalls  = 0;
+}
+
+static int FindFakeEntry(bool aIsShort, uint16_t aShortAddress, const otExtAddress *aExtAddress)
+{
+    int index = -1;
+
+    for (uint16_t i = 0; i < sFakeTableLength; i++)
+    {
+        const FakeSrcMatchEntry &entry = sFakeTable[i];
+
+        if (entry.mIsShort != aIsShort)
+        {
+            continue;
+        }
+
+        if (aIsShort ? (entry.mShortAddress == aShortAddress)
+                     : (memcmp(entry.mExtAddress.m8, aExtAddress->m8, sizeof(otExtAddress)) == 0))
+        {
+            index = i;
+            break;
+        }
+    }
+
+    return index;
+}
+
+static otError AddFakeEntry(bool aIsShort, uint16_t aShortAddress, const otExtAddress *aExtAddress)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(FindFakeEntry(aIsShort, aShortAddress, aExtAddress) < 0);
+    VerifyOrExit(sFakeTableLength < sFakeTableCapacity, error = OT_ERROR_NO_BUFS);
+
+    sFakeTable[sFakeTableLength].mIsShort      = aIsShort;
+    sFakeTable[sFakeTableLength].mShortAddress = aShortAddress;
+
+    if (!aIsShort)
+    {
+        sFakeTable[sFakeTableLength].mExtAddress = *aExtAddress;
+    }
+
+    sFakeTableLength++;
+
+exit:
+    return error;
+}
+
+static otError ClearFakeEntry(bool aIsShort, uint16_t aShortAddress, const otExtAddress *aExtAddress)
+{
+    otError error = OT_ERROR_NONE;
+    int     index = FindFakeEntry(aIsShort, aShortAddress, aExtAddress);
+
+    VerifyOrExit(index >= 0, error = OT_ERROR_NO_ADDRESS);
+    sFakeTable[index] = sFakeTable[--sFakeTableLength];
+
+exit:
+    return error;
+}
+
+static void ClearFakeEntries(bool aIsShort)
+{
+    for (uint16_t i = 0; i < sFakeTableLength;)
+    {
+        if (sFakeTable[i].mIsShort == aIsShort)
+        {
+            sFakeTable[i] = sFakeTable[--sFakeTableLength];
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+extern "C" {
+
+otError otPlatRadioAddSrcMatchShortEntry(otInstance *, uint16_t aShortAddress)
+{
+    sNumPerEntryCalls++;
+    return AddFakeEntry(true, aShortAddress, nullptr);
+}
+
+otError otPlatRadioAddSrcMatchExtEntry(otInstance *, const otExtAddress *aExtAddress)
+{
+    sNumPerEntryCalls++;
+    return AddFakeEntry(false, 0, aExtAddress);
+}
+
+otError otPlatRadioClearSrcMatchShortEntry(otInstance *, uint16_t aShortAddress)
+{
+    sNumPerEntryCalls++;
+    return ClearFakeEntry(true, aShortAddress, nullptr);
+}
+
+otError otPlatRadioClearSrcMatchExtEntry(otInstance *, const otExtAddress *aExtAddress)
+{
+    sNumPerEntryCalls++;
+    return ClearFakeEntry(false, 0, aExtAddress);
+}
+
+void otPlatRadioClearSrcMatchShortEntries(otInstance *) { ClearFakeEntries(/* aIsShort */ true); }
+
+void otPlatRadioClearSrcMatchExtEntries(otInstance *) { ClearFakeEntries(/* aIsShort */ false); }
+
+otError otPlatRadioUpdateSrcMatchEntries(otInstance *, const otRadioSrcMatchEntry *aEntries, uint16_t aNumEntries)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(sSupportsUpdate, error = OT_ERROR_NOT_IMPLEMENTED);
+    VerifyOrExit(aNumEntries > 0);
+
+    sNumUpdateCalls++;
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        const otRadioSrcMatchEntry &entry = aEntries[i];
+
+        if (entry.mIsAdd)
+        {
+            SuccessOrExit(error = AddFakeEntry(entry.mIsShort, entry.mShortAddress, &entry.mExtAddress));
+        }
+        else
+        {
+            IgnoreError(ClearFakeEntry(entry.mIsShort, entry.mShortAddress, &entry.mExtAddress));
+        }
+    }
+
+exit:
+    return error;
+}
+
+} // extern "C"
+
+class UnitTester
+{
+public:
+    static void TestSrcMatchBatchedUpdates(void);
+    static void TestSrcMatchBatchOverflow(void);
+    static void TestSrcMatchAddWithQueuedClears(void);
+    static void TestSrcMatchDeferredAdditions(void);
+    static void TestSrcMatchReenableAddsPendingTogether(void);
+    static void TestSrcMatchWithoutBatchSupport(void);
+
+private:
+    static constexpr uint16_t kNumChildren = 10;
+
+    static void AddChildren(Instance &aInstance, uint16_t aNumChildren);
+    static bool IsInFakeTable(const Child &aChild);
+
+    static SourceMatchController &GetController(Instance &aInstance)
+    {
+        return aInstance.Get<MeshForwarder>().mIndirectSender.mSourceMatchController;
+    }
+
+    static Child &GetChild(Instance &aInstance, uint16_t aIndex)
+    {
+        return *aInstance.Get<ChildTable>().GetChildAtIndex(aIndex);
+    }
+};
+
+void UnitTester::AddChildren(Instance &aInstance, uint16_t aNumChildren)
+{
+    ChildTable &childTable = aInstance.Get<ChildTable>();
+
+    childTable.Clear();
+
+    for (uint16_t i = 0; i < aNumChildren; i++)
+    {
+        Child           *child = childTable.GetNewChild();
+        Mac::ExtAddress  extAddress;
+
+        VerifyOrQuit(child != nullptr);
+        child->SetState(Neighbor::kStateValid);
+        child->SetRloc16(0x1001 + i);
+        child->SetDeviceMode(Mle::DeviceMode(0));
+
+        extAddress.Clear();
+        extAddress.m8[0] = 0x12;
+        extAddress.m8[7] = static_cast<uint8_t>(i);
+        child->SetExtAddress(extAddress);
+    }
+}
+
+bool UnitTester::IsInFakeTable(const Child &aChild)
+{
+    Mac::ExtAddress extAddress;
+
+    // The radio platform is given extended addresses in little-endian order.
+    extAddress.Set(aChild.GetExtAddress().m8, Mac::ExtAddress::kReverseByteOrder);
+
+    return FindFakeEntry(aChild.IsIndirectSourceMatchShort(), aChild.GetRloc16(), &extAddress) >= 0;
+}
+
+void UnitTester::TestSrcMatchBatchedUpdates(void)
+{
+    Instance *instance;
+
+    printf("TestSrcMatchBatchedUpdates\n");
+
+    ResetFakeTable(/* aSupportsUpdate */ true, kMaxFakeEntries);
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    {
+        SourceMatchController &controller = GetController(*instance);
+
+        AddChildren(*instance, kNumChildren);
+        otTaskletsProcess(instance);
+
+        // The first entry enables source matching.
+
+        controller.IncrementMessageCount(GetChild(*instance, 0));
+        VerifyOrQuit(controller.IsEnabled());
+        VerifyOrQuit(sFakeTableLength == 1);
+        VerifyOrQuit(sNumUpdateCalls == 1);
+
+        // Further additions are given to the radio immediately using
+        // the update API.
+
+        for (uint16_t i = 1; i < kNumChildren; i++)
+        {
+            controller.IncrementMessageCount(GetChild(*instance, i));
+            VerifyOrQuit(IsInFakeTable(GetChild(*instance, i)));
+            VerifyOrQuit(sNumUpdateCalls == i + 1);
+        }
+
+        VerifyOrQuit(sFakeTableLength == kNumChildren);
+        VerifyOrQuit(sNumPerEntryCalls == 0);
+
+        for (uint16_t i = 0; i < kNumChildren; i++)
+        {
+            VerifyOrQuit(IsInFakeTable(GetChild(*instance, i)));
+        }
+
+        // Clearing and re-adding an entry before the update cancels out.
+
+        controller.DecrementMessageCount(GetChild(*instance, 3));
+        controller.IncrementMessageCount(GetChild(*instance, 3));
+        otTaskletsProcess(instance);
+
+        VerifyOrQuit(sNumUpdateCalls == kNumChildren);
+        VerifyOrQuit(IsInFakeTable(GetChild(*instance, 3)));
+
+        // Switching to the short address clears the extended one in
+        // the same update which adds the short one.
+
+        controller.SetSrcMatchAsShort(GetChild(*instance, 1), true);
+
+        VerifyOrQuit(sNumUpdateCalls == kNumChildren + 1);
+        VerifyOrQuit(sFakeTableLength == kNumChildren);
+        VerifyOrQuit(IsInFakeTable(GetChild(*instance, 1)));
+        VerifyOrQuit(FindFakeEntry(true, GetChild(*instance, 1).GetRloc16(), nullptr) >= 0);
+
+        // Clearing more entries than can be queued flushes the queue.
+
+        for (uint16_t i = 0; i < kNumChildren; i++)
+        {
+            controller.ResetMessageCount(GetChild(*instance, i));
+        }
+
+        VerifyOrQuit(sNumUpdateCalls == kNumChildren + 2);
+        VerifyOrQuit(sFakeTableLength == kNumChildren - SourceMatchController::kMaxQueuedClears);
+
+        otTaskletsProcess(instance);
+
+        VerifyOrQuit(sNumUpdateCalls == kNumChildren + 3);
+        VerifyOrQuit(sFakeTableLength == 0);
+        VerifyOrQuit(sNumPerEntryCalls == 0);
+    }
+
+    testFreeInstance(instance);
+}
+
+void UnitTester::TestSrcMatchBatchOverflow(void)
+{
+    static constexpr uint16_t kCapacity = 4;
+
+    Instance *instance;
+
+    printf("TestSrcMatchBatchOverflow\n");
+
+    ResetFakeTable(/* aSupportsUpdate */ true, kCapacity);
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    {
+        SourceMatchController &controller = GetController(*instance);
+
+        AddChildren(*instance, kNumChildren);
+        otTaskletsProcess(instance);
+
+        for (uint16_t i = 0; i < kCapacity; i++)
+        {
+            controller.IncrementMessageCount(GetChild(*instance, i));
+        }
+
+        VerifyOrQuit(controller.IsEnabled());
+
+        // The update fails when the table is full, the table is then
+        // rebuilt and source matching is disabled.
+
+        controller.IncrementMessageCount(GetChild(*instance, kCapacity));
+        VerifyOrQuit(!controller.IsEnabled());
+
+        controller.IncrementMessageCount(GetChild(*instance, kCapacity + 1));
+        VerifyOrQuit(!controller.IsEnabled());
+        VerifyOrQuit(sFakeTableLength == kCapacity);
+
+        for (uint16_t i = 0; i < kCapacity; i++)
+        {
+            VerifyOrQuit(IsInFakeTable(GetChild(*instance, i)));
+        }
+
+        // Freeing up space adds the remaining entries and enables
+        // source matching again.
+
+        controller.ResetMessageCount(GetChild(*instance, 0));
+        VerifyOrQuit(!controller.IsEnabled());
+
+        controller.ResetMessageCount(GetChild(*instance, 1));
+        VerifyOrQuit(controller.IsEnabled());
+        VerifyOrQuit(sFakeTableLength == kCapacity);
+
+        for (uint16_t i = 2; i <= kCapacity + 1; i++)
+        {
+            VerifyOrQuit(IsInFakeTable(GetChild(*instance, i)));
+        }
+
+        // Updates are batched again.
+
+        controller.ResetMessageCount(GetChild(*instance, 2));
+        VerifyOrQuit(sFakeTableLength == kCapacity);
+
+        otTaskletsProcess(instance);
+        VerifyOrQuit(sFakeTableLength == kCapacity - 1);
+    }
+
+    testFreeInstance(instance);
+}
+
+void UnitTester::TestSrcMatchAddWithQueuedClears(void)
+{
+    static constexpr uint16_t kCapacity = 4;
+
+    Instance *instance;
+
+    printf("TestSrcMatchAddWithQueuedClears\n");
+
+    ResetFakeTable(/* aSupportsUpdate */ true, kCapacity);
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    {
+        SourceMatchController &controller = GetController(*instance);
+
+        AddChildren(*instance, kNumChildren);
+        otTaskletsProcess(instance);
+
+        for (uint16_t i = 0; i < kCapacity; i++)
+        {
+            controller.IncrementMessageCount(GetChild(*instance, i));
+        }
+
+        VerifyOrQuit(sFakeTableLength == kCapacity);
+
+        // The removals are queued, so the table is still full.
+
+        controller.ResetMessageCount(GetChild(*instance, 0));
+        controller.ResetMessageCount(GetChild(*instance, 1));
+        VerifyOrQuit(sFakeTableLength == kCapacity);
+        VerifyOrQuit(IsInFakeTable(GetChild(*instance, 0)));
+
+        // An addition is in the table as soon as the message count is
+        // incremented, without processing the tasklets. The queued
+        // removals are applied first to make room for it.
+
+        controller.IncrementMessageCount(GetChild(*instance, kCapacity));
+
+        VerifyOrQuit(controller.IsEnabled());
+        VerifyOrQuit(IsInFakeTable(GetChild(*instance, kCapacity)));
+        VerifyOrQuit(!IsInFakeTable(GetChild(*instance, 0)));
+        VerifyOrQuit(!IsInFakeTable(GetChild(*instance, 1)));
+        VerifyOrQuit(sFakeTableLength == kCapacity - 1);
+
+        controller.IncrementMessageCount(GetChild(*instance, 0));
+
+        VerifyOrQuit(IsInFakeTable(GetChild(*instance, 0)));
+        VerifyOrQuit(sFakeTableLength == kCapacity);
+
+        otTaskletsProcess(instance);
+        VerifyOrQuit(sFakeTableLength == kCapacity);
+    }
+
+    testFreeInstance(instance);
+}
+
+void UnitTester::TestSrcMatchDeferredAdditions(void)
+{
+    Instance *instance;
+
+    printf("TestSrcMatchDeferredAdditions\n");
+
+    ResetFakeTable(/* aSupportsUpdate */ true, kMaxFakeEntries);
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    {
+        SourceMatchController &controller = GetController(*instance);
+
+        AddChildren(*instance, kNumChildren);
+        otTaskletsProcess(instance);
+
+        controller.IncrementMessageCount(GetChild(*instance, 0));
+        VerifyOrQuit(controller.IsEnabled());
+        VerifyOrQuit(sNumUpdateCalls == 1);
+
+        // The additions for all the other children (e.g., a multicast
+        // frame queued for all sleepy children) are given to the
+        // radio in a single call.
+
+        controller.DeferAdditions();
+
+        for (uint16_t i = 1; i < kNumChildren; i++)
+        {
+            controller.IncrementMessageCount(GetChild(*instance, i));
+        }
+
+        VerifyOrQuit(sNumUpdateCalls == 1);
+        VerifyOrQuit(sFakeTableLength == 1);
+
+        controller.ApplyDeferredAdditions();
+
+        VerifyOrQuit(sNumUpdateCalls == 2);
+        VerifyOrQuit(sFakeTableLength == kNumChildren);
+
+        for (uint16_t i = 0; i < kNumChildren; i++)
+        {
+            VerifyOrQuit(IsInFakeTable(GetChild(*instance, i)));
+        }
+
+        // With nested deferrals, the additions are applied by the
+        // outermost call, together with the queued removals.
+
+        for (uint16_t i = 1; i < kNumChildren; i++)
+        {
+            controller.ResetMessageCount(GetChild(*instance, i));
+        }
+
+        otTaskletsProcess(instance);
+        VerifyOrQuit(sFakeTableLength == 1);
+
+        controller.ResetMessageCount(GetChild(*instance, 0));
+
+        controller.DeferAdditions();
+        controller.DeferAdditions();
+
+        for (uint16_t i = 1; i < kNumChildren; i++)
+        {
+            controller.IncrementMessageCount(GetChild(*instance, i));
+        }
+
+        controller.ApplyDeferredAdditions();
+        VerifyOrQuit(sFakeTableLength == 1);
+
+        sNumUpdateCalls = 0;
+        controller.ApplyDeferredAdditions();
+
+        VerifyOrQuit(sNumUpdateCalls == 1);
+        VerifyOrQuit(sFakeTableLength == kNumChildren - 1);
+        VerifyOrQuit(!IsInFakeTable(GetChild(*instance, 0)));
+
+        otTaskletsProcess(instance);
+        VerifyOrQuit(sNumUpdateCalls == 1);
+        VerifyOrQuit(sNumPerEntryCalls == 0);
+    }
+
+    testFreeInstance(instance);
+}
+
+void UnitTester::TestSrcMatchReenableAddsPendingTogether(void)
+{
+    static constexpr uint16_t kCapacity = 4;
+
+    Instance *instance;
+
+    printf("TestSrcMatchReenableAddsPendingTogether\n");
+
+    ResetFakeTable(/* aSupportsUpdate */ true, kCapacity);
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    {
+        SourceMatchController &controller = GetController(*instance);
+
+        AddChildren(*instance, kNumChildren);
+        otTaskletsProcess(instance);
+
+        // Fill the table, the remaining children stay pending and
+        // source matching is disabled.
+
+        for (uint16_t i = 0; i < kNumChildren; i++)
+        {
+            controller.IncrementMessageCount(GetChild(*instance, i));
+        }
+
+        VerifyOrQuit(!controller.IsEnabled());
+        VerifyOrQuit(sFakeTableLength == kCapacity);
+
+        // Once there is enough space, freeing up an entry adds all the
+        // pending children with a single update call.
+
+        sFakeTableCapacity = kMaxFakeEntries;
+        sNumUpdateCalls    = 0;
+        sNumPerEntryCalls  = 0;
+
+        controller.ResetMessageCount(GetChild(*instance, 0));
+
+        VerifyOrQuit(controller.IsEnabled());
+        VerifyOrQuit(sNumUpdateCalls == 1);
+        VerifyOrQuit(sNumPerEntryCalls == 1);
+        VerifyOrQuit(sFakeTableLength == kNumChildren - 1);
+
+        for (uint16_t i = 1; i < kNumChildren; i++)
+        {
+            VerifyOrQuit(IsInFakeTable(GetChild(*instance, i)));
+        }
+    }
+
+    testFreeInstance(instance);
+}
+
+void UnitTester::TestSrcMatchWithoutBatchSupport(void)
+{
+    Instance *instance;
+
+    printf("TestSrcMatchWithoutBatchSupport\n");
+
+    ResetFakeTable(/* aSupportsUpdate */ false, kMaxFakeEntries);
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    {
+        SourceMatchController &controller = GetController(*instance);
+
+        AddChildren(*instance, kNumChildren);
+        otTaskletsProcess(instance);
+
+        // Every change is applied immediately, one entry at a time.
+
+        for (uint16_t i = 0; i < kNumChildren; i++)
+        {
+            controller.IncrementMessageCount(GetChild(*instance, i));
+            VerifyOrQuit(sFakeTableLength == i + 1);
+        }
+
+        VerifyOrQuit(sNumPerEntryCalls == kNumChildren);
+
+        controller.ResetMessageCount(GetChild(*instance, 0));
+        VerifyOrQuit(sFakeTableLength == kNumChildren - 1);
+        VerifyOrQuit(!IsInFakeTable(GetChild(*instance, 0)));
+
+        otTaskletsProcess(instance);
+        VerifyOrQuit(sNumUpdateCalls == 0);
+    }
+
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    ot::UnitTester::TestSrcMatchBatchedUpdates();
+    ot::UnitTester::TestSrcMatchBatchOverflow();
+    ot::UnitTester::TestSrcMatchAddWithQueuedClears();
+    ot::UnitTester::TestSrcMatchDeferredAdditions();
+    ot::UnitTester::TestSrcMatchReenableAddsPendingTogether();
+    ot::UnitTester::TestSrcMatchWithoutBatchSupport();
+#endif
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
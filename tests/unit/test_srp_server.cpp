@@ -472,6 +472,21 @@ void TestSrpServerBase(void)
     VerifyOrQuit(service1.GetState() == Srp::Client::kRemoved);
     VerifyOrQuit(service2.GetState() == Srp::Client::kRegistered);
 
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate the signature verification counters.
+
+    {
+        const Srp::Server::SignatureVerifyCounters &counters = srpServer->GetSignatureVerifyCounters();
+
+        Log("Signature verify counters: verified:%lu, failed:%lu, cache-hits:%lu, total-latency:%lu, max-latency:%lu",
+            ToUlong(counters.mNumVerified), ToUlong(counters.mNumFailed), ToUlong(counters.mNumCacheHits),
+            ToUlong(counters.mTotalLatency), ToUlong(counters.mMaxLatency));
+
+        VerifyOrQuit(counters.mNumVerified + counters.mNumCacheHits == 3);
+        VerifyOrQuit(counters.mNumFailed == 0);
+        VerifyOrQuit(counters.mMaxLatency <= counters.mTotalLatency);
+    }
+
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     // Disable SRP server, verify that all heap allocations by SRP server
     // are freed.
@@ -834,6 +849,385 @@ void TestSrpServerClientRemove(bool aShouldRemoveKeyLease)
     Log("End of TestSrpServerClientRemove");
 }
 
+void TestSrpServerLeaseExpiry(void)
+{
+    // Validate that SRP server expires the lease and then the key
+    // lease of a host and its services when the client stops
+    // refreshing its registration.
+
+    Srp::Server                *srpServer;
+    Srp::Client                *srpClient;
+    Srp::Client::Service        service1;
+    Srp::Client::Service        service2;
+    const Srp::Server::Host    *host;
+    const Srp::Server::Service *service;
+    uint16_t                    heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerLeaseExpiry");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    PrepareService1(service1);
+    PrepareService2(service2);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP client with short lease and key lease intervals.
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(15 * 1000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    srpClient->SetLeaseInterval(60);
+    srpClient->SetKeyLeaseInterval(120);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register two services.
+
+    SuccessOrQuit(srpClient->AddService(service1));
+    SuccessOrQuit(srpClient->AddService(service2));
+
+    sUpdateHandlerMode       = kAccept;
+    sProcessedUpdateCallback = false;
+    sProcessedClientCallback = false;
+
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(sProcessedClientCallback);
+    VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+
+    VerifyOrQuit(service1.GetState() == Srp::Client::kRegistered);
+    VerifyOrQuit(service2.GetState() == Srp::Client::kRegistered);
+    ValidateHost(*srpServer, kHostName);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host->GetLease() == 60);
+    VerifyOrQuit(host->GetKeyLease() == 120);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Stop the client so it no longer refreshes its registration.
+
+    srpClient->Stop();
+
+    AdvanceTime(30 * 1000);
+
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(!host->IsDeleted());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate that the host and its services are removed (but their
+    // names are retained) after the lease expires.
+
+    sProcessedUpdateCallback = false;
+
+    AdvanceTime(31 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+
+    ValidateHost(*srpServer, kHostName);
+    host = srpServer->GetNextHost(nullptr);
+    VerifyOrQuit(host->IsDeleted());
+
+    service = host->GetServices().GetHead();
+    VerifyOrQuit(service != nullptr);
+
+    for (; service != nullptr; service = service->GetNext())
+    {
+        VerifyOrQuit(service->IsDeleted());
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate that the host is fully removed after the key lease expires.
+
+    AdvanceTime(30 * 1000);
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) != nullptr);
+
+    AdvanceTime(30 * 1000);
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server, verify that all heap allocations by SRP server
+    // are freed.
+
+    Log("Disabling SRP server");
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerLeaseExpiry");
+}
+
+enum HostLeaseState : uint8_t
+{
+    kHostActive,       // Host and its services are registered.
+    kHostLeaseExpired, // Host and its services are deleted but their names are retained.
+    kHostRemoved,      // Host is fully removed.
+};
+
+const Srp::Server::Host *FindHost(Srp::Server &aServer, const char *aHostName)
+{
+    const Srp::Server::Host *host = nullptr;
+
+    while ((host = aServer.GetNextHost(host)) != nullptr)
+    {
+        const char *name = host->GetFullName();
+
+        if (StringStartsWith(name, aHostName, kStringCaseInsensitiveMatch) && (name[strlen(aHostName)] == '.'))
+        {
+            break;
+        }
+    }
+
+    return host;
+}
+
+void ValidateHostLeaseState(Srp::Server &aServer, const char *aHostName, HostLeaseState aState)
+{
+    const Srp::Server::Host *host = FindHost(aServer, aHostName);
+
+    Log("ValidateHostLeaseState(%s, %u)", aHostName, aState);
+
+    if (aState == kHostRemoved)
+    {
+        VerifyOrQuit(host == nullptr);
+        ExitNow();
+    }
+
+    VerifyOrQuit(host != nullptr);
+    VerifyOrQuit(host->IsDeleted() == (aState == kHostLeaseExpired));
+    VerifyOrQuit(!host->GetServices().IsEmpty());
+
+    for (const Srp::Server::Service &service : host->GetServices())
+    {
+        VerifyOrQuit(service.IsDeleted() == (aState == kHostLeaseExpired));
+    }
+
+exit:
+    return;
+}
+
+void TestSrpServerMultiHostLeaseExpiry(void)
+{
+    // Validate the lease and key lease expiry order of several hosts
+    // registered with different lease intervals. The hosts are
+    // registered in an order different from their expiry order, one
+    // host is removed while in the middle of the server's lease queue,
+    // and an expired lease moves a host further down the queue to its
+    // key lease expiry time.
+
+    struct HostInfo
+    {
+        const char *mName;
+        const char *mInstanceLabel;
+        uint32_t    mLease;
+        uint32_t    mKeyLease;
+    };
+
+    // Hosts are registered in this order, 2 seconds apart. The last
+    // host is removed by the client right after its registration.
+
+    static const HostInfo kHosts[] = {
+        {"host-a", "instance-a", 60, 300},
+        {"host-b", "instance-b", 30, 90},
+        {"host-d", "instance-d", 120, 150},
+        {"host-c", "instance-c", 45, 200},
+    };
+
+    static constexpr uint16_t kNumHosts = GetArrayLength(kHosts);
+
+    struct Checkpoint
+    {
+        uint32_t       mTime; // In seconds since the start of registrations.
+        HostLeaseState mStates[kNumHosts];
+    };
+
+    // Host `i` is registered within [2*i, 2*i + 2] seconds. Each
+    // checkpoint is at least one second away from any lease or key
+    // lease expiration.
+
+    static const Checkpoint kCheckpoints[] = {
+        {31, {kHostActive, kHostActive, kHostActive, kHostRemoved}},
+        {36, {kHostActive, kHostLeaseExpired, kHostActive, kHostRemoved}},
+        {59, {kHostActive, kHostLeaseExpired, kHostActive, kHostRemoved}},
+        {63, {kHostLeaseExpired, kHostLeaseExpired, kHostActive, kHostRemoved}},
+        {91, {kHostLeaseExpired, kHostLeaseExpired, kHostActive, kHostRemoved}},
+        {95, {kHostLeaseExpired, kHostRemoved, kHostActive, kHostRemoved}},
+        {123, {kHostLeaseExpired, kHostRemoved, kHostActive, kHostRemoved}},
+        {127, {kHostLeaseExpired, kHostRemoved, kHostLeaseExpired, kHostRemoved}},
+        {153, {kHostLeaseExpired, kHostRemoved, kHostLeaseExpired, kHostRemoved}},
+        {157, {kHostLeaseExpired, kHostRemoved, kHostRemoved, kHostRemoved}},
+        {299, {kHostLeaseExpired, kHostRemoved, kHostRemoved, kHostRemoved}},
+        {303, {kHostRemoved, kHostRemoved, kHostRemoved, kHostRemoved}},
+    };
+
+    Srp::Server         *srpServer;
+    Srp::Client         *srpClient;
+    Srp::Client::Service services[kNumHosts];
+    uint32_t             startTime;
+    uint16_t             heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerMultiHostLeaseExpiry");
+
+    InitTest();
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP client.
+
+    srpClient->SetCallback(HandleSrpClientCallback, sInstance);
+
+    srpClient->EnableAutoStartMode(nullptr, nullptr);
+    AdvanceTime(15 * 1000);
+    VerifyOrQuit(srpClient->IsRunning());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Register the hosts one after the other. The client forgets the
+    // previous host (without removing it from the server) before
+    // registering the next one, so it does not refresh it.
+
+    sUpdateHandlerMode = kAccept;
+    startTime          = sNow;
+
+    for (uint16_t index = 0; index < kNumHosts; index++)
+    {
+        const HostInfo &info = kHosts[index];
+
+        if (index > 0)
+        {
+            srpClient->ClearHostAndServices();
+        }
+
+        SuccessOrQuit(srpClient->SetHostName(info.mName));
+        SuccessOrQuit(srpClient->EnableAutoHostAddress());
+        srpClient->SetLeaseInterval(info.mLease);
+        srpClient->SetKeyLeaseInterval(info.mKeyLease);
+
+        PrepareService1(services[index]);
+        services[index].mInstanceName = info.mInstanceLabel;
+        SuccessOrQuit(srpClient->AddService(services[index]));
+
+        sProcessedUpdateCallback = false;
+        sProcessedClientCallback = false;
+
+        AdvanceTime(2 * 1000);
+
+        VerifyOrQuit(sProcessedUpdateCallback);
+        VerifyOrQuit(sProcessedClientCallback);
+        VerifyOrQuit(sLastClientCallbackError == kErrorNone);
+        VerifyOrQuit(services[index].GetState() == Srp::Client::kRegistered);
+
+        VerifyOrQuit(FindHost(*srpServer, info.mName)->GetLease() == info.mLease);
+        VerifyOrQuit(FindHost(*srpServer, info.mName)->GetKeyLease() == info.mKeyLease);
+    }
+
+    for (const HostInfo &info : kHosts)
+    {
+        ValidateHostLeaseState(*srpServer, info.mName, kHostActive);
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Remove the last registered host along with its key lease, then
+    // stop the client.
+
+    sProcessedUpdateCallback = false;
+
+    SuccessOrQuit(srpClient->RemoveHostAndServices(/* aShouldRemoveKeyLease */ true));
+    AdvanceTime(2 * 1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    ValidateHostLeaseState(*srpServer, kHosts[kNumHosts - 1].mName, kHostRemoved);
+
+    srpClient->Stop();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Validate the expiry order.
+
+    for (const Checkpoint &checkpoint : kCheckpoints)
+    {
+        uint32_t time = startTime + checkpoint.mTime * 1000;
+
+        VerifyOrQuit(time > sNow);
+        AdvanceTime(time - sNow);
+
+        Log("Checkpoint at %lu sec", ToUlong(checkpoint.mTime));
+
+        for (uint16_t index = 0; index < kNumHosts; index++)
+        {
+            ValidateHostLeaseState(*srpServer, kHosts[index].mName, checkpoint.mStates[index]);
+        }
+    }
+
+    VerifyOrQuit(srpServer->GetNextHost(nullptr) == nullptr);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Disable SRP server, verify that all heap allocations by SRP server
+    // are freed.
+
+    Log("Disabling SRP server");
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerMultiHostLeaseExpiry");
+}
+
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
 void TestUpdateLeaseShortVariant(void)
 {
@@ -1610,6 +2004,238 @@ void TestSrpServerFastStartMode(void)
 
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+
+static constexpr uint16_t kMaxCapturedUpdateLength = 1280;
+
+static uint8_t  sCapturedUpdate[kMaxCapturedUpdateLength];
+static uint16_t sCapturedUpdateLength;
+static uint16_t sNumSuccessResponses;
+static uint16_t sNumErrorResponses;
+
+void HandleCaptureUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    // Captures the first SRP update message (from SRP client) and
+    // counts the responses (from SRP server).
+
+    const Message    &message = AsCoreType(aMessage);
+    Dns::UpdateHeader header;
+
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    VerifyOrQuit(aContext == nullptr);
+    SuccessOrQuit(message.Read(0, header));
+
+    if (header.GetType() == Dns::UpdateHeader::kTypeResponse)
+    {
+        if (header.GetResponseCode() == Dns::UpdateHeader::kResponseSuccess)
+        {
+            sNumSuccessResponses++;
+        }
+        else
+        {
+            sNumErrorResponses++;
+        }
+    }
+    else if (sCapturedUpdateLength == 0)
+    {
+        VerifyOrQuit(message.GetLength() <= kMaxCapturedUpdateLength);
+        sCapturedUpdateLength = message.GetLength();
+        SuccessOrQuit(message.Read(0, sCapturedUpdate, sCapturedUpdateLength));
+    }
+}
+
+void SendCapturedUpdate(Ip6::Udp::Socket &aSocket, const Ip6::MessageInfo &aServerMsgInfo, uint16_t aMessageId)
+{
+    // Sends the captured SRP update with a given message ID. Since
+    // the SIG(0) signature covers the DNS header, the signature of
+    // the sent message is only valid when `aMessageId` matches the
+    // message ID of the captured update.
+
+    Message          *message = aSocket.NewMessage();
+    Dns::UpdateHeader header;
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->AppendBytes(sCapturedUpdate, sCapturedUpdateLength));
+
+    SuccessOrQuit(message->Read(0, header));
+    header.SetMessageId(aMessageId);
+    message->Write(0, header);
+
+    SuccessOrQuit(aSocket.SendTo(*message, aServerMsgInfo));
+}
+
+void TestSrpServerAsyncVerify(void)
+{
+    // Validate that signature verifications are queued and processed
+    // in batches of `OPENTHREAD_CONFIG_SRP_SERVER_VERIFY_BATCH_SIZE`
+    // from a tasklet, that a duplicate of a queued update is dropped,
+    // and that the queued verifications are freed when the server is
+    // disabled.
+
+    static constexpr uint16_t kCapturePort    = 53535;
+    static constexpr uint16_t kNumInvalid     = 5;
+    static constexpr uint16_t kBatchSize      = OPENTHREAD_CONFIG_SRP_SERVER_VERIFY_BATCH_SIZE;
+    static constexpr uint16_t kNumUpdates     = kNumInvalid + 1;
+    static constexpr uint16_t kMinNumRuns     = (kNumUpdates + kBatchSize - 1) / kBatchSize;
+    static constexpr uint16_t kMessageIdDelta = 0x100;
+
+    Srp::Server                                *srpServer;
+    Srp::Client                                *srpClient;
+    Srp::Client::Service                        service;
+    Ip6::SockAddr                               captureSockAddr;
+    Ip6::MessageInfo                            serverMsgInfo;
+    Dns::UpdateHeader                           capturedHeader;
+    const Srp::Server::SignatureVerifyCounters *counters;
+    uint32_t                                    numProcessed;
+    uint16_t                                    numRuns;
+    uint16_t                                    heapAllocations;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpServerAsyncVerify");
+
+    InitTest();
+
+    Ip6::Udp::Socket udpSocket(*sInstance, HandleCaptureUdpReceive, nullptr);
+
+    srpServer = &sInstance->Get<Srp::Server>();
+    srpClient = &sInstance->Get<Srp::Client>();
+    counters  = &srpServer->GetSignatureVerifyCounters();
+
+    heapAllocations = sHeapAllocatedPtrs.GetLength();
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Start SRP server.
+
+    SuccessOrQuit(srpServer->SetAddressMode(Srp::Server::kAddressModeUnicast));
+    srpServer->SetServiceHandler(HandleSrpServerUpdate, sInstance);
+    sUpdateHandlerMode = kAccept;
+
+    srpServer->SetEnabled(true);
+    AdvanceTime(10000);
+    VerifyOrQuit(srpServer->GetState() == Srp::Server::kStateRunning);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Capture an SRP update from the client, sent to a local socket
+    // instead of the SRP server.
+
+    sCapturedUpdateLength = 0;
+    sNumSuccessResponses  = 0;
+    sNumErrorResponses    = 0;
+
+    SuccessOrQuit(udpSocket.Open(Ip6::kNetifThreadInternal));
+    SuccessOrQuit(udpSocket.Bind(kCapturePort));
+
+    captureSockAddr.SetAddress(sInstance->Get<Mle::Mle>().GetMeshLocalRloc());
+    captureSockAddr.SetPort(kCapturePort);
+    SuccessOrQuit(srpClient->Start(captureSockAddr));
+
+    SuccessOrQuit(srpClient->SetHostName(kHostName));
+    SuccessOrQuit(srpClient->EnableAutoHostAddress());
+
+    PrepareService1(service);
+    SuccessOrQuit(srpClient->AddService(service));
+
+    AdvanceTime(1000);
+
+    VerifyOrQuit(sCapturedUpdateLength != 0);
+    srpClient->Stop();
+
+    memcpy(&capturedHeader, sCapturedUpdate, sizeof(capturedHeader));
+
+    serverMsgInfo.SetPeerAddr(sInstance->Get<Mle::Mle>().GetMeshLocalRloc());
+    serverMsgInfo.SetPeerPort(srpServer->GetPort());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Send the captured update twice along with copies with a
+    // different message ID (invalid signature). Validate that the
+    // verifications are processed in batches and that the duplicate
+    // is dropped.
+
+    ProcessRadioTxAndTasklets();
+
+    SendCapturedUpdate(udpSocket, serverMsgInfo, capturedHeader.GetMessageId());
+    SendCapturedUpdate(udpSocket, serverMsgInfo, capturedHeader.GetMessageId());
+
+    for (uint16_t index = 1; index <= kNumInvalid; index++)
+    {
+        SendCapturedUpdate(udpSocket, serverMsgInfo, capturedHeader.GetMessageId() + index * kMessageIdDelta);
+    }
+
+    sProcessedUpdateCallback = false;
+    numRuns                  = 0;
+
+    // The first run delivers the updates to the server, which queues
+    // them without verifying any signature.
+
+    otTaskletsProcess(sInstance);
+    VerifyOrQuit(counters->mNumVerified + counters->mNumFailed + counters->mNumCacheHits == 0);
+
+    while (otTaskletsArePending(sInstance))
+    {
+        uint32_t prevNumProcessed = counters->mNumVerified + counters->mNumFailed + counters->mNumCacheHits;
+
+        otTaskletsProcess(sInstance);
+
+        numProcessed = counters->mNumVerified + counters->mNumFailed + counters->mNumCacheHits;
+        VerifyOrQuit(numProcessed - prevNumProcessed <= kBatchSize);
+
+        if (numProcessed != prevNumProcessed)
+        {
+            numRuns++;
+        }
+    }
+
+    Log("Signature verify counters: verified:%lu, failed:%lu, cache-hits:%lu, runs:%u",
+        ToUlong(counters->mNumVerified), ToUlong(counters->mNumFailed), ToUlong(counters->mNumCacheHits), numRuns);
+
+    VerifyOrQuit(counters->mNumVerified + counters->mNumCacheHits == 1);
+    VerifyOrQuit(counters->mNumFailed == kNumInvalid);
+    VerifyOrQuit(numRuns >= kMinNumRuns);
+
+    AdvanceTime(1000);
+
+    VerifyOrQuit(sProcessedUpdateCallback);
+    VerifyOrQuit(FindHost(*srpServer, kHostName) != nullptr);
+    VerifyOrQuit(sNumSuccessResponses == 1);
+    VerifyOrQuit(sNumErrorResponses == kNumInvalid);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Queue more updates and disable the server before their
+    // signatures are verified.
+
+    numProcessed = counters->mNumVerified + counters->mNumFailed + counters->mNumCacheHits;
+
+    for (uint16_t index = 1; index <= kNumInvalid; index++)
+    {
+        SendCapturedUpdate(udpSocket, serverMsgInfo, capturedHeader.GetMessageId() - index * kMessageIdDelta);
+    }
+
+    otTaskletsProcess(sInstance);
+
+    Log("Disabling SRP server with queued verifications");
+
+    srpServer->SetEnabled(false);
+    AdvanceTime(100);
+
+    VerifyOrQuit(counters->mNumVerified + counters->mNumFailed + counters->mNumCacheHits == numProcessed);
+    VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+    SuccessOrQuit(udpSocket.Close());
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Finalize OT instance and validate all heap allocations are freed.
+
+    Log("Finalizing OT instance");
+    FinalizeTest();
+
+    VerifyOrQuit(sHeapAllocatedPtrs.IsEmpty());
+
+    Log("End of TestSrpServerAsyncVerify");
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+
 #endif // ENABLE_SRP_TEST
 
 } // namespace ot
@@ -1622,6 +2248,8 @@ int main(void)
     ot::TestSrpServerIgnore();
     ot::TestSrpServerClientRemove(/* aShouldRemoveKeyLease */ true);
     ot::TestSrpServerClientRemove(/* aShouldRemoveKeyLease */ false);
+    ot::TestSrpServerLeaseExpiry();
+    ot::TestSrpServerMultiHostLeaseExpiry();
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     ot::TestUpdateLeaseShortVariant();
     ot::TestSrpClientDelayedResponse();
@@ -1631,6 +2259,9 @@ int main(void)
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
     ot::TestSrpServerFastStartMode();
 #endif
+#if OPENTHREAD_CONFIG_SRP_SERVER_ASYNC_VERIFY_ENABLE
+    ot::TestSrpServerAsyncVerify();
+#endif
 
     printf("All tests passed\n");
 #else
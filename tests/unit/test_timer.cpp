@@ -32,6 +32,7 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/num_utils.hpp"
+#include "common/random.hpp"
 #include "common/timer.hpp"
 #include "instance/instance.hpp"
 
@@ -98,6 +99,7 @@ public:
     explicit TestTimer(Instance &aInstance)
         : TimerType(aInstance, TestTimer::HandleTimerFired)
         , mFiredCounter(0)
+        , mFiredTime(0)
     {
     }
 
@@ -107,16 +109,20 @@ public:
     {
         sCallCount[kCallCountIndexTimerHandler]++;
         mFiredCounter++;
+        mFiredTime = sNow;
     }
 
     uint32_t GetFiredCounter(void) { return mFiredCounter; }
 
+    uint32_t GetFiredTime(void) { return mFiredTime; }
+
     void ResetFiredCounter(void) { mFiredCounter = 0; }
 
     static void RemoveAll(Instance &aInstance) { TimerType::RemoveAll(aInstance); }
 
 private:
     uint32_t mFiredCounter; //< Number of times timer has been fired so far
+    uint32_t mFiredTime;    //< The time when the timer was last fired
 };
 
 template <typename TimerType> void AlarmFired(otInstance *aInstance);
@@ -578,6 +584,116 @@ template <typename TimerType> int TestTenTimers(void)
     return 0;
 }
 
+/**
+ * Test the TimerScheduler's behavior with many timers randomly started, re-started and stopped.
+ */
+template <typename TimerType> void ManyTimers(uint32_t aTimeShift)
+{
+    static constexpr uint16_t kNumTimers      = 400;
+    static constexpr uint16_t kNumRestarts    = 2000;
+    static constexpr uint32_t kMaxIntervals[] = {50, 5000, 5000000, Timer::kMaxDelay};
+
+    Instance             *instance = testInitInstance();
+    TestTimer<TimerType> *timers[kNumTimers];
+
+    printf("TestManyTimers() with aTimeShift=%-10u ", aTimeShift);
+
+    TestTimer<TimerType>::RemoveAll(*instance);
+    InitCounters();
+
+    sNow = aTimeShift;
+
+    for (TestTimer<TimerType> *&timer : timers)
+    {
+        timer = new TestTimer<TimerType>(*instance);
+    }
+
+    for (uint16_t i = 0; i < kNumRestarts; i++)
+    {
+        TestTimer<TimerType> &timer       = *timers[Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kNumTimers)];
+        uint32_t              maxInterval = kMaxIntervals[i % GetArrayLength(kMaxIntervals)];
+
+        switch (Random::NonCrypto::GenerateUpToExcluding<uint8_t>(8))
+        {
+        case 0:
+            timer.Stop();
+            break;
+        case 1:
+            // Start with a fire time in the past.
+            timer.StartAt(Time(sNow - Random::NonCrypto::GenerateUpToExcluding<uint32_t>(100)), 0);
+            break;
+        default:
+            timer.Start(Random::NonCrypto::GenerateUpToExcluding<uint32_t>(maxInterval));
+            break;
+        }
+
+        sNow += Random::NonCrypto::GenerateUpToExcluding<uint32_t>(3);
+    }
+
+    // Fire all timers and verify they fire in order and at their fire time.
+
+    while (sTimerOn)
+    {
+        TestTimer<TimerType> *firedTimer = nullptr;
+        uint32_t              firedCount = sCallCount[kCallCountIndexTimerHandler];
+
+        if (static_cast<int32_t>(sPlatT0 + sPlatDt - sNow) > 0)
+        {
+            sNow = sPlatT0 + sPlatDt;
+        }
+
+        AlarmFired<TimerType>(instance);
+
+        VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == firedCount + 1);
+
+        for (TestTimer<TimerType> *timer : timers)
+        {
+            if (timer->GetFiredCounter() != 0)
+            {
+                VerifyOrQuit(firedTimer == nullptr);
+                firedTimer = timer;
+            }
+        }
+
+        VerifyOrQuit(firedTimer != nullptr);
+        VerifyOrQuit(!firedTimer->IsRunning());
+        VerifyOrQuit(firedTimer->GetFiredTime() == sNow);
+        VerifyOrQuit(firedTimer->GetFireTime() <= Time(sNow));
+
+        for (TestTimer<TimerType> *timer : timers)
+        {
+            if (timer->IsRunning())
+            {
+                VerifyOrQuit(!(timer->GetFireTime() < firedTimer->GetFireTime()));
+            }
+        }
+
+        firedTimer->ResetFiredCounter();
+    }
+
+    for (TestTimer<TimerType> *timer : timers)
+    {
+        VerifyOrQuit(!timer->IsRunning());
+        delete timer;
+    }
+
+    printf("--> PASSED\n");
+
+    testFreeInstance(instance);
+}
+
+template <typename TimerType> int TestManyTimers(void)
+{
+    const uint32_t kTimeShift[] = {0, 0U - 1000U, Timer::kMaxDelay + 1020U};
+
+    for (uint32_t timeShift : kTimeShift)
+    {
+        ManyTimers<TimerType>(timeShift);
+    }
+
+    return 0;
+}
+
 /**
  * Test the `Timer::Time` class.
  */
@@ -676,6 +792,7 @@ template <typename TimerType> void RunTimerTests(void)
     TestOneTimer<TimerType>();
     TestTwoTimers<TimerType>();
     TestTenTimers<TimerType>();
+    TestManyTimers<TimerType>();
 }
 
 } // namespace ot
@@ -487,12 +487,107 @@ void TestTlvInfo(void)
     testFreeInstance(instance);
 }
 
+void TestTlvFindInLargeMessage(void)
+{
+    // Checks `Tlv::Info::FindIn()` on a message spanning many buffers
+    // with TLVs crossing buffer boundaries.
+
+    static constexpr uint8_t  kNumTlvs       = 200;
+    static constexpr uint8_t  kMaxValueLen   = 12;
+    static constexpr uint8_t  kMissingType   = 250;
+    static constexpr uint16_t kMessageOffset = 5;
+
+    Instance   *instance;
+    Message    *message;
+    Tlv         tlv;
+    ExtendedTlv extTlv;
+    Tlv::Info   info;
+    uint16_t    offsets[kNumTlvs];
+    uint8_t     value[kMaxValueLen];
+
+    printf("TestTlvFindInLargeMessage\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr);
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeOther);
+    VerifyOrQuit(message != nullptr);
+
+    // Bytes before the message offset look like a TLV of `kMissingType`
+    // which `FindIn()` must not see.
+
+    tlv.SetType(kMissingType);
+    tlv.SetLength(3);
+    SuccessOrQuit(message->Append(tlv));
+    SuccessOrQuit(message->Append<uint8_t>(0));
+    SuccessOrQuit(message->Append<uint16_t>(0));
+    VerifyOrQuit(message->GetLength() == kMessageOffset);
+    message->SetOffset(kMessageOffset);
+
+    for (uint8_t type = 0; type < kNumTlvs; type++)
+    {
+        uint8_t len = type % kMaxValueLen;
+
+        offsets[type] = message->GetLength();
+
+        if (type % 3 == 0)
+        {
+            extTlv.SetType(type);
+            extTlv.SetLength(len);
+            SuccessOrQuit(message->Append(extTlv));
+        }
+        else
+        {
+            tlv.SetType(type);
+            tlv.SetLength(len);
+            SuccessOrQuit(message->Append(tlv));
+        }
+
+        memset(value, type, len);
+        SuccessOrQuit(message->AppendBytes(value, len));
+    }
+
+    VerifyOrQuit(message->GetLength() > 4 * Buffer::kSize);
+
+    for (uint8_t type = 0; type < kNumTlvs; type++)
+    {
+        uint8_t len = type % kMaxValueLen;
+
+        SuccessOrQuit(info.FindIn(*message, type));
+        VerifyOrQuit(info.GetType() == type);
+        VerifyOrQuit(info.IsExtended() == (type % 3 == 0));
+        VerifyOrQuit(info.GetLength() == len);
+        VerifyOrQuit(info.GetTlvOffset() == offsets[type]);
+        VerifyOrQuit(info.GetValueOffset() == offsets[type] + (info.IsExtended() ? sizeof(ExtendedTlv) : sizeof(Tlv)));
+        VerifyOrQuit(info.GetTlvOffsetRange().GetEndOffset() == info.GetValueOffsetRange().GetEndOffset());
+
+        memset(value, 0, sizeof(value));
+        SuccessOrQuit(message->Read(info.GetValueOffsetRange(), value, len));
+
+        for (uint8_t i = 0; i < len; i++)
+        {
+            VerifyOrQuit(value[i] == type);
+        }
+    }
+
+    VerifyOrQuit(info.FindIn(*message, kMissingType) == kErrorNotFound);
+
+    // Truncate the message in the middle of the last TLV value.
+
+    SuccessOrQuit(message->SetLength(message->GetLength() - 1));
+    VerifyOrQuit(info.FindIn(*message, kNumTlvs - 1) == kErrorNotFound);
+    SuccessOrQuit(info.FindIn(*message, kNumTlvs - 2));
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestTlv();
     ot::TestTlvInfo();
+    ot::TestTlvFindInLargeMessage();
     printf("All tests passed\n");
     return 0;
 }
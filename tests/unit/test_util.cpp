@@ -29,6 +29,9 @@
 #include "test_util.hpp"
 
 #include <ctype.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
 
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength)
 {
@@ -66,3 +69,63 @@ void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBuff
 
     printf("    %s\n", charBuff);
 }
+
+uint64_t GetMonotonicTimeUsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_nsec) / 1000;
+}
+
+void KeepBenchmarkResult(uint64_t aValue)
+{
+    static volatile uint64_t sSink;
+
+    sSink = sSink + aValue;
+}
+
+void BenchmarkReport::BeginRow(const char *aLabelFormat, ...)
+{
+    char    label[64];
+    va_list args;
+
+    if (!mHeaderPrinted)
+    {
+        printf("%-*s", GetColumnWidth(mLabelName), mLabelName);
+
+        for (uint8_t i = 0; i < mNumColumns; i++)
+        {
+            printf("  %*s", GetColumnWidth(mColumnNames[i]), mColumnNames[i]);
+        }
+
+        printf("\n");
+        mHeaderPrinted = true;
+    }
+
+    va_start(args, aLabelFormat);
+    vsnprintf(label, sizeof(label), aLabelFormat, args);
+    va_end(args);
+
+    printf("%-*s", GetColumnWidth(mLabelName), label);
+    mColumn = 0;
+}
+
+void BenchmarkReport::AddValue(double aValue)
+{
+    if (mColumn < mNumColumns)
+    {
+        printf("  %*.1f", GetColumnWidth(mColumnNames[mColumn]), aValue);
+        mColumn++;
+    }
+}
+
+void BenchmarkReport::EndRow(void) { printf("\n"); }
+
+int BenchmarkReport::GetColumnWidth(const char *aName)
+{
+    int width = static_cast<int>(strlen(aName));
+
+    return (width < kMinColumnWidth) ? kMinColumnWidth : width;
+}
@@ -42,4 +42,142 @@
  */
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength);
 
+/**
+ * Returns the current time from a monotonic clock in microseconds.
+ *
+ * Intended to measure the elapsed time in benchmark tests.
+ *
+ * @returns The current monotonic time in microseconds.
+ */
+uint64_t GetMonotonicTimeUsec(void);
+
+/**
+ * Measures the time spent in benchmark loops.
+ *
+ * The elapsed time accumulates over `Start()`/`Stop()` pairs until `Reset()` is called, so a timer can measure a loop
+ * as a whole or only selected calls inside it.
+ */
+class BenchmarkTimer
+{
+public:
+    /**
+     * Initializes the timer with zero elapsed time.
+     */
+    BenchmarkTimer(void) { Reset(); }
+
+    /**
+     * Clears the accumulated elapsed time.
+     */
+    void Reset(void) { mElapsedUsec = 0; }
+
+    /**
+     * Starts measuring.
+     */
+    void Start(void) { mStartUsec = GetMonotonicTimeUsec(); }
+
+    /**
+     * Stops measuring and adds the time since `Start()` to the elapsed time.
+     */
+    void Stop(void) { mElapsedUsec += GetMonotonicTimeUsec() - mStartUsec; }
+
+    /**
+     * Returns the accumulated elapsed time in microseconds.
+     *
+     * The returned value is at least one so that it can be used as a divisor.
+     *
+     * @returns The elapsed time in microseconds.
+     */
+    uint64_t GetElapsedUsec(void) const { return (mElapsedUsec == 0) ? 1 : mElapsedUsec; }
+
+    /**
+     * Returns the average time per operation in nanoseconds.
+     *
+     * @param[in] aNumOps  The number of operations performed during the elapsed time.
+     *
+     * @returns The average time per operation in nanoseconds.
+     */
+    double GetNsPerOp(uint64_t aNumOps) const { return GetElapsedUsec() * 1000.0 / aNumOps; }
+
+    /**
+     * Returns the throughput in MB/s (10^6 bytes per second).
+     *
+     * @param[in] aNumBytes  The number of bytes processed during the elapsed time.
+     *
+     * @returns The throughput in MB/s.
+     */
+    double GetMbPerSec(uint64_t aNumBytes) const { return static_cast<double>(aNumBytes) / GetElapsedUsec(); }
+
+private:
+    uint64_t mStartUsec;
+    uint64_t mElapsedUsec;
+};
+
+/**
+ * Consumes a value computed in a benchmark loop so that the compiler cannot optimize out the computation.
+ *
+ * @param[in] aValue  The computed value.
+ */
+void KeepBenchmarkResult(uint64_t aValue);
+
+/**
+ * Prints a benchmark result table.
+ *
+ * Each result row is printed by `BeginRow()`, one `AddValue()` per column, and `EndRow()`. The header row is printed
+ * before the first row.
+ */
+class BenchmarkReport
+{
+public:
+    static constexpr uint8_t kMaxColumns = 4; ///< Maximum number of value columns.
+
+    /**
+     * Initializes the report.
+     *
+     * The column names are not copied and must remain valid while the report is used.
+     *
+     * @param[in] aLabelName    The name of the row label column.
+     * @param[in] aColumnNames  An array of value column names.
+     */
+    template <uint8_t kNumColumns>
+    BenchmarkReport(const char *aLabelName, const char *const (&aColumnNames)[kNumColumns])
+        : mLabelName(aLabelName)
+        , mColumnNames(aColumnNames)
+        , mNumColumns(kNumColumns)
+        , mColumn(0)
+        , mHeaderPrinted(false)
+    {
+        static_assert(kNumColumns <= kMaxColumns, "too many columns");
+    }
+
+    /**
+     * Starts a new row.
+     *
+     * @param[in] aLabelFormat  The format string for the row label (printf style), followed by its arguments.
+     */
+    void BeginRow(const char *aLabelFormat, ...);
+
+    /**
+     * Prints the value of the next column in the current row.
+     *
+     * @param[in] aValue  The value.
+     */
+    void AddValue(double aValue);
+
+    /**
+     * Ends the current row.
+     */
+    void EndRow(void);
+
+private:
+    static constexpr int kMinColumnWidth = 10;
+
+    static int GetColumnWidth(const char *aName);
+
+    const char        *mLabelName;
+    const char *const *mColumnNames;
+    uint8_t            mNumColumns;
+    uint8_t            mColumn;
+    bool               mHeaderPrinted;
+};
+
 #endif // OT_UNIT_TEST_UTIL_HPP_
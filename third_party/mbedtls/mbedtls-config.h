@@ -67,6 +67,16 @@
 #define MBEDTLS_ECP_NIST_OPTIM
 #define MBEDTLS_ENTROPY_C
 #define MBEDTLS_HAVE_ASM
+
+#if OPENTHREAD_CONFIG_CRYPTO_AES_HW_ACCEL_ENABLE
+#if defined(__x86_64__) || defined(__amd64__)
+#define MBEDTLS_AESNI_C
+#endif
+#if (MBEDTLS_VERSION_NUMBER >= 0x03040000) && defined(__aarch64__) && \
+    (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+#define MBEDTLS_AESCE_C
+#endif
+#endif
 #define MBEDTLS_HMAC_DRBG_C
 #define MBEDTLS_MD_C
 #define MBEDTLS_SHA224_C